@@ -16,13 +16,17 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/actors/actor-devel.h>
 #include <dali/public-api/actors/actor-enumerations.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 // Internal headers are allowed here
 #include <dali/internal/event/actors/actor-impl.h>
+#include <dali/internal/update/nodes/node.h>
 
 using namespace Dali;
 
@@ -36,6 +40,123 @@ void utc_dali_internal_actor_impl_cleanup()
   test_return_value = TET_PASS;
 }
 
+namespace
+{
+struct DepthTreeEntry
+{
+  Actor    actor;
+  int32_t  expectedDepth; ///< The depth index of a full rebuild without gaps
+  uint32_t sortedDepth;   ///< The actual sorted depth
+};
+
+/**
+ * Numbers the actors in render order, as the depth tree did before it left gaps between the depth indices.
+ */
+void TraverseDepthTree(Actor actor, int32_t& depthIndex, std::vector<DepthTreeEntry>& entries)
+{
+  auto& actorImpl = GetImplementation(actor);
+  entries.push_back({actor, depthIndex, actorImpl.GetSortingDepth()});
+
+  std::vector<Actor> children;
+  for(uint32_t i = 0u; i < actor.GetChildCount(); ++i)
+  {
+    children.push_back(actor.GetChildAt(i));
+  }
+  std::stable_sort(children.begin(), children.end(), [](const Actor& lhs, const Actor& rhs)
+                   { return lhs.GetProperty<int32_t>(Actor::Property::DEPTH_INDEX) < rhs.GetProperty<int32_t>(Actor::Property::DEPTH_INDEX); });
+
+  if(actor.GetProperty<int32_t>(DevelActor::Property::CHILDREN_DEPTH_INDEX_POLICY) == DevelActor::ChildrenDepthIndexPolicy::INCREASE)
+  {
+    for(auto& child : children)
+    {
+      ++depthIndex;
+      TraverseDepthTree(child, depthIndex, entries);
+    }
+  }
+  else
+  {
+    int32_t       maxDepthIndex   = depthIndex;
+    const int32_t childDepthIndex = ++depthIndex;
+    for(auto& child : children)
+    {
+      depthIndex = childDepthIndex;
+      TraverseDepthTree(child, depthIndex, entries);
+      maxDepthIndex = std::max(maxDepthIndex, depthIndex);
+    }
+    depthIndex = maxDepthIndex;
+  }
+}
+
+/**
+ * Checks that the sorted depths of the actors are in the same order as a full rebuild without gaps,
+ * and that the nodes have the same depth as their actor.
+ */
+bool CheckDepthTree(TestApplication& application)
+{
+  std::vector<DepthTreeEntry> entries;
+  int32_t                     depthIndex = 1;
+  TraverseDepthTree(application.GetScene().GetRootLayer(), depthIndex, entries);
+
+  for(auto& entry : entries)
+  {
+    if(GetImplementation(entry.actor).GetNode().GetDepthIndex() != entry.sortedDepth)
+    {
+      tet_printf("The node of actor %d has another depth\n", entry.actor.GetProperty<int32_t>(Actor::Property::ID));
+      return false;
+    }
+  }
+
+  std::stable_sort(entries.begin(), entries.end(), [](const DepthTreeEntry& lhs, const DepthTreeEntry& rhs)
+                   { return lhs.expectedDepth < rhs.expectedDepth; });
+  for(std::size_t i = 1u; i < entries.size(); ++i)
+  {
+    const bool expectedEqual = entries[i - 1u].expectedDepth == entries[i].expectedDepth;
+    if((expectedEqual && entries[i - 1u].sortedDepth != entries[i].sortedDepth) ||
+       (!expectedEqual && entries[i - 1u].sortedDepth >= entries[i].sortedDepth))
+    {
+      tet_printf("Actor %d is not sorted after actor %d\n", entries[i].actor.GetProperty<int32_t>(Actor::Property::ID), entries[i - 1u].actor.GetProperty<int32_t>(Actor::Property::ID));
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Creates a row of a list, with two children.
+ */
+Actor CreateRow()
+{
+  Actor row = Actor::New();
+  row.Add(Actor::New());
+  row.Add(Actor::New());
+  return row;
+}
+
+Actor CreateList(uint32_t rowCount)
+{
+  Actor list = Actor::New();
+  for(uint32_t i = 0u; i < rowCount; ++i)
+  {
+    list.Add(CreateRow());
+  }
+  return list;
+}
+
+std::vector<uint32_t> GetSortingDepths(Actor list)
+{
+  std::vector<uint32_t> depths;
+  for(uint32_t i = 0u; i < list.GetChildCount(); ++i)
+  {
+    Actor row       = list.GetChildAt(i);
+    Actor lastChild = row.GetChildAt(row.GetChildCount() - 1u);
+    depths.push_back(GetImplementation(row).GetSortingDepth());
+    depths.push_back(GetImplementation(lastChild).GetSortingDepth());
+  }
+  return depths;
+}
+
+} // namespace
+
 int UtcDaliActorImplGetOffScreenRenderTasks(void)
 {
   TestApplication application;
@@ -101,3 +222,179 @@ int UtcDaliActorImplGetOffScreenRenderTasks(void)
 
   END_TEST;
 }
+
+int UtcDaliActorImplDepthTreeInsertP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Check that inserting a row only numbers the new actors\n");
+
+  Actor list = CreateList(100u);
+  application.GetScene().Add(list);
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK(CheckDepthTree(application));
+
+  const std::vector<uint32_t> depths = GetSortingDepths(list);
+
+  // Insert a row in the middle, and another one at the end
+  Actor row = CreateRow();
+  list.Add(row);
+  row.LowerBelow(list.GetChildAt(50u));
+  list.Add(CreateRow());
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK(CheckDepthTree(application));
+
+  std::vector<uint32_t> newDepths = GetSortingDepths(list);
+  newDepths.erase(newDepths.begin() + 100, newDepths.begin() + 102); // inserted
+  newDepths.resize(newDepths.size() - 2u);                           // appended
+  DALI_TEST_CHECK(newDepths == depths);
+
+  END_TEST;
+}
+
+int UtcDaliActorImplDepthTreeRemoveP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Check that removing a row does not renumber the other actors\n");
+
+  Actor list = CreateList(10u);
+  application.GetScene().Add(list);
+  application.SendNotification();
+  application.Render();
+
+  std::vector<uint32_t> depths = GetSortingDepths(list);
+
+  list.GetChildAt(3u).Unparent();
+  list.GetChildAt(0u).GetChildAt(1u).Unparent();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK(CheckDepthTree(application));
+
+  std::vector<uint32_t> newDepths = GetSortingDepths(list);
+  depths.erase(depths.begin() + 6, depths.begin() + 8);
+  DALI_TEST_EQUALS(newDepths.size(), depths.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(std::equal(newDepths.begin() + 2, newDepths.end(), depths.begin() + 2));
+
+  END_TEST;
+}
+
+int UtcDaliActorImplDepthTreeGapExhaustedP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Check that the rows are renumbered when the gaps are exhausted\n");
+
+  Actor list = CreateList(10u);
+  application.GetScene().Add(list);
+  application.SendNotification();
+  application.Render();
+
+  // Keep inserting rows in the same place, and a child in the first row
+  bool sorted = true;
+  for(uint32_t i = 0u; i < 20u; ++i)
+  {
+    Actor row = CreateRow();
+    list.Add(row);
+    row.LowerBelow(list.GetChildAt(1u));
+    list.GetChildAt(0u).GetChildAt(0u).Add(CreateRow());
+
+    application.SendNotification();
+    application.Render();
+    sorted = sorted && CheckDepthTree(application);
+  }
+  DALI_TEST_CHECK(sorted);
+  DALI_TEST_EQUALS(list.GetChildCount(), 30u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliActorImplDepthTreeReorderP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Check the depth tree when the render order of the actors changes\n");
+
+  Actor list = CreateList(10u);
+  application.GetScene().Add(list);
+  application.SendNotification();
+  application.Render();
+
+  bool sorted = true;
+
+  list.GetChildAt(2u).RaiseToTop();
+  list.GetChildAt(5u).LowerToBottom();
+  application.SendNotification();
+  application.Render();
+  sorted = sorted && CheckDepthTree(application);
+
+  list.GetChildAt(4u).SetProperty(Actor::Property::DEPTH_INDEX, 10);
+  list.GetChildAt(6u).SetProperty(Actor::Property::DEPTH_INDEX, -10);
+  application.SendNotification();
+  application.Render();
+  sorted = sorted && CheckDepthTree(application);
+
+  // The children of the first row share their depth, then a grandchild is added
+  list.GetChildAt(0u).SetProperty(DevelActor::Property::CHILDREN_DEPTH_INDEX_POLICY, DevelActor::ChildrenDepthIndexPolicy::EQUAL);
+  application.SendNotification();
+  application.Render();
+  sorted = sorted && CheckDepthTree(application);
+
+  list.GetChildAt(0u).GetChildAt(1u).Add(CreateRow());
+  application.SendNotification();
+  application.Render();
+  sorted = sorted && CheckDepthTree(application);
+
+  // Moved to another parent
+  list.GetChildAt(1u).Add(list.GetChildAt(9u));
+  application.SendNotification();
+  application.Render();
+  sorted = sorted && CheckDepthTree(application);
+
+  DALI_TEST_CHECK(sorted);
+
+  END_TEST;
+}
+
+int UtcDaliActorImplTransformPropertyInputChangedP(void)
+{
+  TestApplication application;
+
+  tet_infoline("Check that the transform properties only report a change in the frames they changed\n");
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  auto RenderFrames = [&application](uint32_t frameCount)
+  {
+    for(uint32_t i = 0u; i < frameCount; ++i)
+    {
+      application.SendNotification();
+      application.Render();
+    }
+  };
+
+  const Property::Index properties[] = {Actor::Property::POSITION, Actor::Property::SIZE, Actor::Property::SCALE, Actor::Property::ORIENTATION};
+  const Property::Value values[]     = {Vector3(10.0f, 20.0f, 0.0f), Vector3(30.0f, 40.0f, 0.0f), Vector3(2.0f, 2.0f, 1.0f), Quaternion(Radian(1.0f), Vector3::ZAXIS)};
+
+  for(uint32_t i = 0u; i < sizeof(properties) / sizeof(properties[0]); ++i)
+  {
+    const Internal::PropertyInputImpl* input = GetImplementation(actor).GetSceneObjectInputProperty(properties[i]);
+    DALI_TEST_CHECK(input);
+
+    RenderFrames(4u);
+    DALI_TEST_CHECK(!input->InputChanged());
+
+    actor.SetProperty(properties[i], values[i]);
+    RenderFrames(1u);
+    DALI_TEST_CHECK(input->InputChanged());
+
+    RenderFrames(4u);
+    DALI_TEST_CHECK(!input->InputChanged());
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Internal headers are allowed here
+#include <dali/internal/render/common/damaged-rects-coalescer.h>
+
+using namespace Dali;
+using Dali::Internal::Render::CoalesceDamagedRects;
+
+namespace
+{
+int64_t GetTotalArea(const std::vector<BoundsInteger>& rects)
+{
+  int64_t area = 0;
+  for(const auto& rect : rects)
+  {
+    area += static_cast<int64_t>(rect.width) * rect.height;
+  }
+  return area;
+}
+
+int64_t GetCoveredArea(const std::vector<BoundsInteger>& rects)
+{
+  // Counts the covered pixels of the bounding box one by one
+  BoundsInteger boundingBox = rects[0];
+  for(const auto& rect : rects)
+  {
+    boundingBox.Merge(rect);
+  }
+  std::vector<bool> covered(static_cast<size_t>(boundingBox.width) * boundingBox.height, false);
+  for(const auto& rect : rects)
+  {
+    for(int32_t y = rect.y; y < rect.y + rect.height; ++y)
+    {
+      for(int32_t x = rect.x; x < rect.x + rect.width; ++x)
+      {
+        covered[static_cast<size_t>(y - boundingBox.y) * boundingBox.width + (x - boundingBox.x)] = true;
+      }
+    }
+  }
+  return std::count(covered.begin(), covered.end(), true);
+}
+
+int64_t GetBoundingBoxArea(const std::vector<BoundsInteger>& rects)
+{
+  BoundsInteger boundingBox = rects[0];
+  for(const auto& rect : rects)
+  {
+    boundingBox.Merge(rect);
+  }
+  return static_cast<int64_t>(boundingBox.width) * boundingBox.height;
+}
+
+bool AreDisjoint(const std::vector<BoundsInteger>& rects)
+{
+  for(uint32_t i = 0u; i < rects.size(); ++i)
+  {
+    for(uint32_t j = i + 1u; j < rects.size(); ++j)
+    {
+      if(rects[i].Intersects(rects[j]))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool CoversAll(const std::vector<BoundsInteger>& coalescedRects, const std::vector<BoundsInteger>& damagedRects)
+{
+  for(const auto& damagedRect : damagedRects)
+  {
+    bool covered = false;
+    for(const auto& rect : coalescedRects)
+    {
+      covered = covered || rect.Contains(damagedRect);
+    }
+    if(!covered)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<BoundsInteger> CreateClusteredRects(uint32_t clusterCount, uint32_t rectsPerCluster, uint32_t seed)
+{
+  std::mt19937                           random(seed);
+  std::uniform_int_distribution<int32_t> offset(0, 80);
+  std::uniform_int_distribution<int32_t> size(8, 48);
+  std::vector<BoundsInteger>             rects;
+  for(uint32_t cluster = 0u; cluster < clusterCount; ++cluster)
+  {
+    // Clusters along the diagonal of a 1920x1920 surface, far apart from each other
+    const int32_t origin = static_cast<int32_t>(cluster) * 1920 / static_cast<int32_t>(clusterCount);
+    for(uint32_t i = 0u; i < rectsPerCluster; ++i)
+    {
+      rects.push_back(BoundsInteger(origin + offset(random), origin + offset(random), size(random), size(random)));
+    }
+  }
+  return rects;
+}
+
+} // namespace
+
+void utc_dali_internal_damaged_rects_coalescer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_damaged_rects_coalescer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliDamagedRectsCoalescerOverlappingRectsP(void)
+{
+  tet_infoline("Check that overlapping rects are merged, even if the maximum count is not reached");
+
+  std::vector<BoundsInteger> rects = {BoundsInteger(0, 0, 32, 32), BoundsInteger(16, 16, 32, 32), BoundsInteger(200, 200, 16, 16)};
+
+  const float ratio = CoalesceDamagedRects(rects, 8u);
+  DALI_TEST_EQUALS(rects.size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[0], BoundsInteger(0, 0, 48, 48), TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[1], BoundsInteger(200, 200, 16, 16), TEST_LOCATION);
+  DALI_TEST_EQUALS(ratio, static_cast<float>(48 * 48 + 16 * 16) / static_cast<float>(32 * 32 * 2 - 16 * 16 + 16 * 16), TEST_LOCATION);
+
+  // Adjacent rects do not overlap
+  rects = {BoundsInteger(0, 0, 16, 16), BoundsInteger(16, 0, 16, 16), BoundsInteger(0, 16, 16, 16)};
+  DALI_TEST_EQUALS(CoalesceDamagedRects(rects, 4u), 1.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects.size(), 3u, TEST_LOCATION);
+
+  // A rect merged with another one may overlap a third one
+  rects = {BoundsInteger(0, 0, 16, 16), BoundsInteger(20, 0, 16, 8), BoundsInteger(12, 12, 16, 16)};
+  CoalesceDamagedRects(rects, 4u);
+  DALI_TEST_EQUALS(rects.size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[0], BoundsInteger(0, 0, 36, 28), TEST_LOCATION);
+
+  // The overlapping area is counted once, so rects covering each other do not lower the ratio below 1
+  rects = {BoundsInteger(0, 0, 32, 32), BoundsInteger(0, 0, 32, 32), BoundsInteger(8, 8, 16, 16)};
+  DALI_TEST_EQUALS(CoalesceDamagedRects(rects, 4u), 1.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects.size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[0], BoundsInteger(0, 0, 32, 32), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamagedRectsCoalescerMaximumCountP(void)
+{
+  tet_infoline("Check that the rects are merged into the maximum count, choosing the cheapest merges");
+
+  std::vector<BoundsInteger> rects = {BoundsInteger(0, 0, 16, 16), BoundsInteger(32, 0, 16, 16), BoundsInteger(500, 500, 16, 16), BoundsInteger(500, 532, 16, 16)};
+
+  CoalesceDamagedRects(rects, 2u);
+  DALI_TEST_EQUALS(rects.size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[0], BoundsInteger(0, 0, 48, 16), TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[1], BoundsInteger(500, 500, 16, 48), TEST_LOCATION);
+
+  CoalesceDamagedRects(rects, 1u);
+  DALI_TEST_EQUALS(rects.size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[0], BoundsInteger(0, 0, 516, 548), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamagedRectsCoalescerEmptyRectsN(void)
+{
+  tet_infoline("Check that empty rects are dropped");
+
+  std::vector<BoundsInteger> rects;
+  DALI_TEST_EQUALS(CoalesceDamagedRects(rects, 4u), 1.0f, TEST_LOCATION);
+  DALI_TEST_CHECK(rects.empty());
+
+  rects = {BoundsInteger(0, 0, 0, 16), BoundsInteger(10, 10, 16, 0)};
+  DALI_TEST_EQUALS(CoalesceDamagedRects(rects, 4u), 1.0f, TEST_LOCATION);
+  DALI_TEST_CHECK(rects.empty());
+
+  rects = {BoundsInteger(0, 0, 0, 16), BoundsInteger(10, 10, 16, 16)};
+  DALI_TEST_EQUALS(CoalesceDamagedRects(rects, 4u), 1.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects.size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(rects[0], BoundsInteger(10, 10, 16, 16), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamagedRectsCoalescerOverdrawP(void)
+{
+  tet_infoline("Measure the pixels saved by the merged rects, compared with the bounding box of the damaged rects");
+
+  for(const uint32_t maximumCount : {4u, 8u})
+  {
+    for(const uint32_t rectsPerCluster : {4u, 16u, 64u})
+    {
+      const std::vector<BoundsInteger> damagedRects = CreateClusteredRects(4u, rectsPerCluster, rectsPerCluster);
+      std::vector<BoundsInteger>       rects        = damagedRects;
+
+      const float ratio = CoalesceDamagedRects(rects, maximumCount);
+
+      DALI_TEST_CHECK(rects.size() <= maximumCount);
+      DALI_TEST_CHECK(AreDisjoint(rects));
+      DALI_TEST_CHECK(CoversAll(rects, damagedRects));
+
+      const int64_t coalescedArea   = GetTotalArea(rects);
+      const int64_t boundingBoxArea = GetBoundingBoxArea(damagedRects);
+      DALI_TEST_EQUALS(ratio, static_cast<float>(coalescedArea) / static_cast<float>(GetCoveredArea(damagedRects)), 0.001f, TEST_LOCATION);
+
+      // Each cluster fits in a 128x128 box, so the merged rects must be far smaller than the bounding box of the frame
+      DALI_TEST_CHECK(coalescedArea <= 4 * 128 * 128);
+      DALI_TEST_CHECK(coalescedArea * 10 < boundingBoxArea);
+
+      tet_printf("%u rects into %u : %lld pixels instead of %lld for the bounding box (damaged area ratio %.2f)\n", static_cast<uint32_t>(damagedRects.size()), static_cast<uint32_t>(rects.size()), static_cast<long long>(coalescedArea), static_cast<long long>(boundingBoxArea), ratio);
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliDamagedRectsCoalescerRandomRectsP(void)
+{
+  tet_infoline("Check that random rects are merged into disjoint rects covering them");
+
+  std::mt19937                           random(7u);
+  std::uniform_int_distribution<int32_t> position(0, 1000);
+  std::uniform_int_distribution<int32_t> size(1, 200);
+
+  for(uint32_t iteration = 0u; iteration < 20u; ++iteration)
+  {
+    std::vector<BoundsInteger> damagedRects;
+    for(uint32_t i = 0u; i < 100u; ++i)
+    {
+      damagedRects.push_back(BoundsInteger(position(random), position(random), size(random), size(random)));
+    }
+
+    for(const uint32_t maximumCount : {1u, 4u, 8u})
+    {
+      std::vector<BoundsInteger> rects = damagedRects;
+      const float                ratio = CoalesceDamagedRects(rects, maximumCount);
+      DALI_TEST_CHECK(!rects.empty() && rects.size() <= maximumCount);
+      DALI_TEST_EQUALS(ratio, static_cast<float>(GetTotalArea(rects)) / static_cast<float>(GetCoveredArea(damagedRects)), 0.001f, TEST_LOCATION);
+      DALI_TEST_CHECK(ratio >= 1.0f);
+      DALI_TEST_CHECK(AreDisjoint(rects));
+      DALI_TEST_CHECK(CoversAll(rects, damagedRects));
+    }
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+
+#include <chrono>
+
+// Internal headers are allowed here
+#include <dali/internal/event/animation/key-frame-channel.h>
+
+using namespace Dali;
+using namespace Dali::Internal;
+
+namespace
+{
+/**
+ * The evaluation which the segment cursor and the cubic segments replace, used as a reference.
+ */
+template<typename V>
+V ReferenceGetValue(const KeyFrameChannel<V>& channel, float progress, Dali::Animation::Interpolation interpolation)
+{
+  const auto& values = channel.mValues;
+  V           interpolatedV{};
+
+  if(progress >= values.back().GetProgress())
+  {
+    return values.back().GetValue();
+  }
+
+  auto end   = std::lower_bound(values.begin(), values.end(), progress, [](const auto& element, const float& progress)
+                              { return element.GetProgress() <= progress; });
+  auto start = end - 1;
+
+  float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
+  if(interpolation == Dali::Animation::LINEAR)
+  {
+    Interpolate(interpolatedV, start->GetValue(), end->GetValue(), frameProgress);
+  }
+  else
+  {
+    V prev = (start != values.begin()) ? (start - 1)->GetValue() : start->GetValue() + (start->GetValue() - (start + 1)->GetValue());
+    V next = (end != values.end() - 1) ? (end + 1)->GetValue() : end->GetValue() + (end->GetValue() - (end - 1)->GetValue());
+    CubicInterpolate(interpolatedV, prev, start->GetValue(), end->GetValue(), next, frameProgress);
+  }
+  return interpolatedV;
+}
+
+KeyFrameChannel<Vector3> CreateChannel(uint32_t keyFrameCount)
+{
+  KeyFrameChannel<Vector3> channel;
+  for(uint32_t i = 0u; i < keyFrameCount; ++i)
+  {
+    const float progress = static_cast<float>(i) / static_cast<float>(keyFrameCount - 1u);
+    channel.mValues.push_back({progress, Vector3(sinf(progress * 50.0f), cosf(progress * 30.0f), static_cast<float>(i % 7u))});
+  }
+  return channel;
+}
+
+} // namespace
+
+void utc_dali_internal_key_frame_channel_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_key_frame_channel_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliKeyFrameChannelGetValueMatchesReferenceP(void)
+{
+  KeyFrameChannel<Vector3> channel = CreateChannel(100u);
+  channel.CalculateCubicSegments();
+
+  // Forward with small steps, backward, and random jumps, as a looping or seeking animation does.
+  std::vector<float> progresses;
+  for(uint32_t i = 0u; i <= 1000u; ++i)
+  {
+    progresses.push_back(static_cast<float>(i) / 1000.0f);
+  }
+  for(uint32_t i = 0u; i <= 100u; ++i)
+  {
+    progresses.push_back(1.0f - static_cast<float>(i) / 100.0f);
+  }
+  for(uint32_t i = 0u; i < 100u; ++i)
+  {
+    progresses.push_back(static_cast<float>((i * 37u) % 101u) / 101.0f);
+  }
+
+  bool identical = true;
+  for(float progress : progresses)
+  {
+    identical = identical && channel.GetValue(progress, Dali::Animation::LINEAR) == ReferenceGetValue(channel, progress, Dali::Animation::LINEAR);
+    identical = identical && channel.GetValue(progress, Dali::Animation::CUBIC) == ReferenceGetValue(channel, progress, Dali::Animation::CUBIC);
+  }
+  DALI_TEST_CHECK(identical);
+
+  END_TEST;
+}
+
+int UtcDaliKeyFrameChannelGetValueWithoutCubicSegmentsP(void)
+{
+  KeyFrameChannel<int32_t> channel;
+  channel.mValues.push_back({0.0f, 0});
+  channel.mValues.push_back({0.5f, 10});
+  channel.mValues.push_back({0.5f, 20});
+  channel.mValues.push_back({1.0f, 40});
+
+  // Same values with and without the precalculated coefficients
+  std::vector<int32_t> values;
+  for(uint32_t i = 0u; i <= 20u; ++i)
+  {
+    values.push_back(channel.GetValue(static_cast<float>(i) / 20.0f, Dali::Animation::CUBIC));
+  }
+
+  channel.CalculateCubicSegments();
+  DALI_TEST_EQUALS(channel.mCubicSegments.size(), 3u, TEST_LOCATION);
+  for(uint32_t i = 0u; i <= 20u; ++i)
+  {
+    DALI_TEST_EQUALS(channel.GetValue(static_cast<float>(i) / 20.0f, Dali::Animation::CUBIC), values[i], TEST_LOCATION);
+  }
+
+  // The last of the key frames at the same progress is used
+  DALI_TEST_EQUALS(channel.GetValue(0.5f, Dali::Animation::LINEAR), 20, TEST_LOCATION);
+
+  // The coefficients are not used once they no longer match the key frames
+  channel.mValues.push_back({2.0f, 50});
+  DALI_TEST_EQUALS(channel.GetValue(1.5f, Dali::Animation::CUBIC), ReferenceGetValue(channel, 1.5f, Dali::Animation::CUBIC), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliKeyFrameChannelGetValueBenchmarkP(void)
+{
+  using Clock = std::chrono::steady_clock;
+
+  constexpr uint32_t KEY_FRAME_COUNT = 5000u;
+  constexpr uint32_t SAMPLE_COUNT    = 200000u;
+
+  KeyFrameChannel<Vector3> channel = CreateChannel(KEY_FRAME_COUNT);
+  channel.CalculateCubicSegments();
+
+  // Samples of a playing animation : the progress moves forward a little at each frame.
+  Vector3 referenceSum;
+  auto    start = Clock::now();
+  for(uint32_t i = 0u; i < SAMPLE_COUNT; ++i)
+  {
+    referenceSum += ReferenceGetValue(channel, static_cast<float>(i) / SAMPLE_COUNT, Dali::Animation::CUBIC);
+  }
+  const auto referenceTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  Vector3 sum;
+  start = Clock::now();
+  for(uint32_t i = 0u; i < SAMPLE_COUNT; ++i)
+  {
+    sum += channel.GetValue(static_cast<float>(i) / SAMPLE_COUNT, Dali::Animation::CUBIC);
+  }
+  const auto cursorTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  DALI_TEST_EQUALS(sum, referenceSum, TEST_LOCATION);
+
+  tet_printf("%u key frames, %u cubic samples : lower_bound %lld us, segment cursor %lld us\n", KEY_FRAME_COUNT, SAMPLE_COUNT, static_cast<long long>(referenceTime), static_cast<long long>(cursorTime));
+
+  END_TEST;
+}
@@ -21,8 +21,10 @@
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 using namespace Dali;
 
@@ -64,6 +66,34 @@ Matrix CalculateFinalProjectionMatrix(Matrix projection, uint32_t mProjectionRot
   return finalProjection;
 }
 
+// Random transform matrix, like the world matrices of the scene graph.
+Matrix RandomTransformMatrix()
+{
+  Vector3    position    = Vector3(Dali::Random::Range(-50.0f, 50.0f), Dali::Random::Range(-50.0f, 50.0f), Dali::Random::Range(-50.0f, 50.0f));
+  Vector3    axis        = Vector3(Dali::Random::Range(1.0f, 50.0f), Dali::Random::Range(-50.0f, 50.0f), Dali::Random::Range(-50.0f, 50.0f));
+  Quaternion orientation = Quaternion(Radian(Dali::Random::Range(0.0f, 5.0f)), axis);
+  Vector3    scale       = Vector3(Dali::Random::Range(0.1f, 5.0f), Dali::Random::Range(0.1f, 5.0f), Dali::Random::Range(0.1f, 5.0f));
+
+  Matrix matrix;
+  matrix.SetTransformComponents(scale, orientation, position);
+  return matrix;
+}
+
+// Perspective projection matrix, with only the elements which a perspective projection uses.
+Matrix PerspectiveProjectionMatrix(uint32_t rotation)
+{
+  Matrix projection(false);
+  float* m = projection.AsFloat();
+  std::fill(m, m + 16, 0.0f);
+  m[0]  = 1.5f;
+  m[5]  = -2.0f;
+  m[10] = -1.02f;
+  m[11] = -1.0f;
+  m[14] = -20.2f;
+
+  return CalculateFinalProjectionMatrix(projection, rotation);
+}
+
 } // namespace
 
 void utc_dali_internal_matrix_utils_startup(void)
@@ -304,6 +334,47 @@ int UtcDaliMatrixUtilsMultiplyAssignMatrix02P(void)
   END_TEST;
 }
 
+int UtcDaliMatrixUtilsMultiplyProjectionMatricesP(void)
+{
+  tet_infoline("Batched multiplication of matrices by a projection matrix\n");
+
+  constexpr uint32_t COUNT = 100u;
+
+  for(uint32_t rotation = 0u; rotation < 360u; rotation += 90u)
+  {
+    const Matrix projection = PerspectiveProjectionMatrix(rotation);
+
+    std::vector<Matrix>        modelViews;
+    std::vector<const Matrix*> lhs;
+    for(uint32_t i = 0u; i < COUNT; ++i)
+    {
+      modelViews.push_back(RandomTransformMatrix());
+    }
+    for(uint32_t i = 0u; i < COUNT; ++i)
+    {
+      lhs.push_back(&modelViews[i]);
+    }
+
+    std::vector<Matrix> results(COUNT, Matrix(false));
+    Internal::MatrixUtils::MultiplyProjectionMatrices(results.data(), lhs.data(), projection, COUNT);
+
+    bool identical = true;
+    for(uint32_t i = 0u; i < COUNT; ++i)
+    {
+      Matrix expect;
+      Internal::MatrixUtils::MultiplyProjectionMatrix(expect, modelViews[i], projection);
+      identical = identical && (expect == results[i]);
+
+      Matrix full;
+      Internal::MatrixUtils::Multiply(full, modelViews[i], projection);
+      DALI_TEST_EQUALS(results[i], full, 0.01f, TEST_LOCATION);
+    }
+    DALI_TEST_CHECK(identical);
+  }
+
+  END_TEST;
+}
+
 // Dali::Matrix3
 
 int UtcDaliMatrixUtilsMultiplyMatrix3P(void)
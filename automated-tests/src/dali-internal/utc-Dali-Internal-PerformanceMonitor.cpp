@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/render/common/performance-monitor.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Internal headers are allowed here
+
+using namespace Dali;
+using Dali::Internal::PerformanceMonitor;
+
+void utc_dali_internal_performance_monitor_startup(void)
+{
+  test_return_value = TET_UNDEF;
+  PerformanceMonitor::SetEnabled(true);
+  PerformanceMonitor::Reset();
+}
+
+void utc_dali_internal_performance_monitor_cleanup(void)
+{
+  PerformanceMonitor::Reset();
+  PerformanceMonitor::SetEnabled(false);
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliInternalPerformanceMonitorCountersP(void)
+{
+  tet_infoline("Counters are accumulated per frame and reported as percentiles");
+
+  for(uint32_t frame = 1u; frame <= 100u; ++frame)
+  {
+    PerformanceMonitor::Increase(PerformanceMonitor::ANIMATORS_APPLIED, frame);
+    PerformanceMonitor::Increase(PerformanceMonitor::ANIMATORS_APPLIED, frame);
+    PerformanceMonitor::NextFrame();
+  }
+
+  PerformanceMonitor::Statistics statistics = PerformanceMonitor::GetStatistics(PerformanceMonitor::ANIMATORS_APPLIED);
+  DALI_TEST_EQUALS(statistics.frames, 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.max, 200.0, 0.001, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.mean, 101.0, 0.001, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.p50, 100.0, 0.001, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.p95, 190.0, 0.001, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.p99, 198.0, 0.001, TEST_LOCATION);
+
+  // A frame without any increase is still recorded, as zero.
+  PerformanceMonitor::NextFrame();
+  statistics = PerformanceMonitor::GetStatistics(PerformanceMonitor::ANIMATORS_APPLIED);
+  DALI_TEST_EQUALS(statistics.frames, 101u, TEST_LOCATION);
+
+  // Frame interval is recorded from the second frame onwards.
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::FRAME_RATE).frames, 100u, TEST_LOCATION);
+
+  // Never used metrics have no frame.
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::CONSTRAINTS_SKIPPED).frames, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalPerformanceMonitorTimersP(void)
+{
+  tet_infoline("Timers of different threads are recorded into the same histogram");
+
+  PerformanceMonitor::Start(PerformanceMonitor::UPDATE_NODES);
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  PerformanceMonitor::End(PerformanceMonitor::UPDATE_NODES);
+  PerformanceMonitor::NextFrame();
+
+  std::thread renderThread([]()
+                           {
+    PerformanceMonitor::Start(PerformanceMonitor::DRAW_NODES);
+    PerformanceMonitor::End(PerformanceMonitor::DRAW_NODES);
+    PerformanceMonitor::Flush(); });
+  renderThread.join();
+
+  const PerformanceMonitor::Statistics updateNodes = PerformanceMonitor::GetStatistics(PerformanceMonitor::UPDATE_NODES);
+  DALI_TEST_EQUALS(updateNodes.frames, 1u, TEST_LOCATION);
+  DALI_TEST_GREATER(updateNodes.p50, 1000.0, TEST_LOCATION); // microseconds
+
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::DRAW_NODES).frames, 1u, TEST_LOCATION);
+
+  // Flush doesn't record a frame interval.
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::FRAME_RATE).frames, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalPerformanceMonitorWorkerP(void)
+{
+  tet_infoline("Counters of worker threads are added to the next update frame");
+
+  PerformanceMonitor::Increase(PerformanceMonitor::ANIMATORS_APPLIED, 1u);
+
+  std::thread workerThread([]()
+                           {
+    PerformanceMonitor::Increase(PerformanceMonitor::ANIMATORS_APPLIED, 10u);
+    PerformanceMonitor::Increase(PerformanceMonitor::CONSTRAINTS_APPLIED, 5u);
+    PerformanceMonitor::FlushWorker(); });
+  workerThread.join();
+
+  // Nothing is recorded until the update thread starts the next frame.
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::ANIMATORS_APPLIED).frames, 0u, TEST_LOCATION);
+
+  // The render thread doesn't take the values of the workers.
+  std::thread renderThread([]()
+                           { PerformanceMonitor::Flush(); });
+  renderThread.join();
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::CONSTRAINTS_APPLIED).frames, 0u, TEST_LOCATION);
+
+  PerformanceMonitor::NextFrame();
+
+  PerformanceMonitor::Statistics statistics = PerformanceMonitor::GetStatistics(PerformanceMonitor::ANIMATORS_APPLIED);
+  DALI_TEST_EQUALS(statistics.frames, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.max, 11.0, 0.001, TEST_LOCATION);
+
+  statistics = PerformanceMonitor::GetStatistics(PerformanceMonitor::CONSTRAINTS_APPLIED);
+  DALI_TEST_EQUALS(statistics.frames, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.max, 5.0, 0.001, TEST_LOCATION);
+
+  // A metric used by a worker is recorded every update frame afterwards, even as zero.
+  PerformanceMonitor::NextFrame();
+  statistics = PerformanceMonitor::GetStatistics(PerformanceMonitor::CONSTRAINTS_APPLIED);
+  DALI_TEST_EQUALS(statistics.frames, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.p50, 0.0, 0.001, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalPerformanceMonitorDumpP(void)
+{
+  tet_infoline("Dump the statistics as CSV and JSON");
+
+  PerformanceMonitor::Increase(PerformanceMonitor::CONSTRAINTS_APPLIED, 7u);
+  PerformanceMonitor::NextFrame();
+
+  const std::string csv = PerformanceMonitor::Dump(PerformanceMonitor::Format::CSV);
+  DALI_TEST_CHECK(csv.find("metric,unit,frames,mean,p50,p95,p99,max") == 0u);
+  DALI_TEST_CHECK(csv.find("CONSTRAINTS_APPLIED,count,1,7.000,7.000,7.000,7.000,7.000") != std::string::npos);
+  DALI_TEST_CHECK(csv.find("UPDATE_NODES") == std::string::npos);
+
+  const std::string json = PerformanceMonitor::Dump(PerformanceMonitor::Format::JSON);
+  DALI_TEST_CHECK(json.find("{\"metrics\":[{\"name\":\"CONSTRAINTS_APPLIED\",\"unit\":\"count\",\"frames\":1") == 0u);
+
+  const std::string path = (std::filesystem::temp_directory_path() / "test_performance_monitor.json").string();
+  DALI_TEST_CHECK(PerformanceMonitor::DumpToFile(path, PerformanceMonitor::Format::JSON));
+
+  std::ifstream     file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  DALI_TEST_EQUALS(contents.str(), json, TEST_LOCATION);
+  std::remove(path.c_str());
+
+  DALI_TEST_CHECK(!PerformanceMonitor::DumpToFile("/non-existent-directory/dump.csv", PerformanceMonitor::Format::CSV));
+
+  PerformanceMonitor::Reset();
+  DALI_TEST_EQUALS(PerformanceMonitor::GetStatistics(PerformanceMonitor::CONSTRAINTS_APPLIED).frames, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliInternalPerformanceMonitorDumpToEnvironmentPathP(void)
+{
+  tet_infoline("Dump into the file named by DALI_PERFORMANCE_MONITOR_DUMP, in the format of its extension");
+
+  PerformanceMonitor::Increase(PerformanceMonitor::CONSTRAINTS_APPLIED, 3u);
+  PerformanceMonitor::NextFrame();
+
+  unsetenv("DALI_PERFORMANCE_MONITOR_DUMP");
+  DALI_TEST_CHECK(!PerformanceMonitor::DumpToEnvironmentPath());
+
+  const std::string jsonPath = (std::filesystem::temp_directory_path() / "test_performance_monitor_env.json").string();
+  const std::string csvPath  = (std::filesystem::temp_directory_path() / "test_performance_monitor_env.csv").string();
+  for(const auto& [path, format] : {std::make_pair(jsonPath, PerformanceMonitor::Format::JSON), std::make_pair(csvPath, PerformanceMonitor::Format::CSV)})
+  {
+    setenv("DALI_PERFORMANCE_MONITOR_DUMP", path.c_str(), 1);
+    DALI_TEST_CHECK(PerformanceMonitor::DumpToEnvironmentPath());
+
+    std::ifstream     file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    DALI_TEST_EQUALS(contents.str(), PerformanceMonitor::Dump(format), TEST_LOCATION);
+    std::remove(path.c_str());
+  }
+
+  unsetenv("DALI_PERFORMANCE_MONITOR_DUMP");
+
+  END_TEST;
+}
+
+int UtcDaliInternalPerformanceMonitorEnabledP(void)
+{
+  tet_infoline("SetEnabled overrides the environment");
+
+  PerformanceMonitor::SetEnabled(false);
+  DALI_TEST_CHECK(!PerformanceMonitor::IsEnabled());
+
+  PerformanceMonitor::SetEnabled(true);
+  DALI_TEST_CHECK(PerformanceMonitor::IsEnabled());
+
+  DALI_TEST_EQUALS(std::string(PerformanceMonitor::GetMetricName(PerformanceMonitor::FRAME_RATE)), std::string("FRAME_INTERVAL"), TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(PerformanceMonitor::GetMetricName(PerformanceMonitor::METRIC_COUNT)), std::string("UNKNOWN"), TEST_LOCATION);
+
+  END_TEST;
+}
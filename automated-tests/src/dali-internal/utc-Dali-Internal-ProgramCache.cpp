@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <mesh-builder.h>
+
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+// Internal headers are allowed here
+#include <dali/devel-api/common/hash.h>
+#include <dali/internal/render/renderers/uniform-buffer-manager.h>
+#include <dali/internal/render/shaders/persistent-program-cache.h>
+#include <dali/internal/render/shaders/program-controller.h>
+
+using namespace Dali;
+using Dali::Internal::PersistentProgramCache;
+using Dali::Internal::Program;
+using Dali::Internal::ProgramController;
+using Dali::Internal::ShaderData;
+using Dali::Internal::ShaderDataPtr;
+using Dali::Internal::Render::UniformBufferManager;
+
+namespace
+{
+std::string GetCacheFilePath()
+{
+  return "/tmp/dali-program-cache-" + std::to_string(getpid()) + ".bin";
+}
+
+ShaderDataPtr CreateShaderData(const std::string& vertexSource, const std::string& fragmentSource)
+{
+  ShaderDataPtr shaderData = new ShaderData(std::string_view(vertexSource), std::string_view(fragmentSource), Dali::Shader::Hint::NONE, 0u, "test");
+  shaderData->SetHashValue(CalculateHash(std::string_view(vertexSource), std::string_view(fragmentSource)));
+  return shaderData;
+}
+
+/**
+ * Prewarms until the cache has handed out the expected number of programs, as the file is read in another thread.
+ */
+void PrewarmAll(ProgramController& programController, PersistentProgramCache& cache, TestGraphicsController& graphicsController, UniformBufferManager& uniformBufferManager, uint32_t expectedCount)
+{
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while(cache.GetStatistics().prewarmedCount < expectedCount && std::chrono::steady_clock::now() < timeout)
+  {
+    if(programController.Prewarm(graphicsController, uniformBufferManager, 1u) == 0u)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+} // namespace
+
+void utc_dali_internal_program_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_program_cache_cleanup(void)
+{
+  std::remove(GetCacheFilePath().c_str());
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliPersistentProgramCacheSaveAndPrewarmP(void)
+{
+  TestApplication application;
+
+  TestGraphicsController&      graphicsController = application.GetGraphicsController();
+  UniformBufferManager uniformBufferManager(&graphicsController);
+  const std::string            filePath = GetCacheFilePath();
+  std::remove(filePath.c_str());
+
+  ShaderDataPtr shaderData1 = CreateShaderData("vertexSrc1", "fragmentSrc1");
+  ShaderDataPtr shaderData2 = CreateShaderData("vertexSrc2", "fragmentSrc2");
+
+  {
+    PersistentProgramCache cache;
+    ProgramController      programController;
+    programController.SetPersistentCache(&cache);
+    cache.Load(filePath);
+
+    Program::New(programController, shaderData1, 0u, graphicsController);
+    Program::New(programController, shaderData2, 0u, graphicsController);
+    Program::New(programController, shaderData1, 0u, graphicsController);
+
+    // A program using shared uniform blocks can not be recreated from its sources alone
+    Program::New(programController, CreateShaderData("vertexSrc3", "fragmentSrc3"), 1234u, graphicsController);
+
+    DALI_TEST_EQUALS(cache.GetStatistics().missCount, 2u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.GetStatistics().hitCount, 0u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.Save(), true, TEST_LOCATION);
+  }
+
+  {
+    PersistentProgramCache cache;
+    ProgramController      programController;
+    programController.SetPersistentCache(&cache);
+    cache.Load(filePath);
+
+    graphicsController.mCallStack.Reset();
+    graphicsController.mCallStack.EnableLogging(true);
+
+    PrewarmAll(programController, cache, graphicsController, uniformBufferManager, 2u);
+    DALI_TEST_EQUALS(cache.GetStatistics().loadedCount, 2u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.GetStatistics().prewarmedCount, 2u, TEST_LOCATION);
+    DALI_TEST_EQUALS(graphicsController.mCallStack.CountMethod("CreateProgram"), 2, TEST_LOCATION);
+    DALI_TEST_EQUALS(programController.GetCachedProgramCount(), 2u, TEST_LOCATION);
+
+    // The renderers get the prewarmed programs
+    graphicsController.mCallStack.Reset();
+    Program* program = Program::New(programController, CreateShaderData("vertexSrc1", "fragmentSrc1"), 0u, graphicsController);
+    DALI_TEST_CHECK(program->GetGraphicsProgramPtr() != nullptr);
+    Program::New(programController, CreateShaderData("vertexSrc1", "fragmentSrc1"), 0u, graphicsController);
+    DALI_TEST_EQUALS(cache.GetStatistics().hitCount, 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.GetStatistics().missCount, 0u, TEST_LOCATION);
+
+    Program::New(programController, CreateShaderData("vertexSrc4", "fragmentSrc4"), 0u, graphicsController);
+    DALI_TEST_EQUALS(cache.GetStatistics().missCount, 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(graphicsController.mCallStack.CountMethod("CreateProgram"), 0, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.Save(), true, TEST_LOCATION);
+  }
+
+  {
+    // The new program is appended to the file
+    PersistentProgramCache cache;
+    ProgramController      programController;
+    programController.SetPersistentCache(&cache);
+    cache.Load(filePath);
+    PrewarmAll(programController, cache, graphicsController, uniformBufferManager, 3u);
+    DALI_TEST_EQUALS(cache.GetStatistics().loadedCount, 3u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.GetStatistics().prewarmedCount, 3u, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPersistentProgramCacheInvalidFileN(void)
+{
+  TestApplication application;
+
+  TestGraphicsController&      graphicsController = application.GetGraphicsController();
+  UniformBufferManager uniformBufferManager(&graphicsController);
+  const std::string            filePath = GetCacheFilePath();
+
+  FILE* file = std::fopen(filePath.c_str(), "wb");
+  DALI_TEST_CHECK(file != nullptr);
+  const char garbage[] = "This is not a program cache file";
+  std::fwrite(garbage, 1u, sizeof(garbage), file);
+  std::fclose(file);
+
+  PersistentProgramCache cache;
+  ProgramController      programController;
+  programController.SetPersistentCache(&cache);
+  cache.Load(filePath);
+
+  // Nothing to save as no program was added, and nothing to prewarm once the file is read
+  DALI_TEST_EQUALS(cache.Save(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(programController.Prewarm(graphicsController, uniformBufferManager, 10u), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(cache.GetStatistics().loadedCount, 0u, TEST_LOCATION);
+
+  // Missing file
+  std::remove(filePath.c_str());
+  PersistentProgramCache missingCache;
+  missingCache.Load(filePath);
+  DALI_TEST_EQUALS(missingCache.Save(), true, TEST_LOCATION);
+  DALI_TEST_CHECK(missingCache.GetNextProgramToPrewarm() == nullptr);
+
+  END_TEST;
+}
+
+int UtcDaliPersistentProgramCacheCoreP(void)
+{
+  const std::string filePath = GetCacheFilePath();
+  std::remove(filePath.c_str());
+  setenv("DALI_PROGRAM_CACHE_FILE", filePath.c_str(), 1);
+
+  {
+    // First launch : the programs are created on demand, and written when the core is destroyed
+    TestApplication application;
+
+    Geometry geometry = CreateQuadGeometry();
+    for(uint32_t i = 0u; i < 3u; ++i)
+    {
+      Actor actor = Actor::New();
+      const std::string vertexSource   = "vertexSrc" + std::to_string(i);
+      const std::string fragmentSource = "fragmentSrc" + std::to_string(i);
+      Shader            shader         = Shader::New(vertexSource.c_str(), fragmentSource.c_str());
+      Renderer          renderer       = Renderer::New(geometry, shader);
+      actor.AddRenderer(renderer);
+      actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+      application.GetScene().Add(actor);
+    }
+    application.SendNotification();
+    application.Render();
+  }
+
+  {
+    // Second launch : the programs are created before any renderer requests them
+    TestApplication         application;
+    TestGraphicsController& graphicsController = application.GetGraphicsController();
+    graphicsController.mCallStack.Reset();
+    graphicsController.mCallStack.EnableLogging(true);
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while(graphicsController.mCallStack.CountMethod("CreateProgram") < 3 && std::chrono::steady_clock::now() < timeout)
+    {
+      application.SendNotification();
+      application.Render();
+    }
+    DALI_TEST_EQUALS(graphicsController.mCallStack.CountMethod("CreateProgram"), 3, TEST_LOCATION);
+
+    graphicsController.mCallStack.Reset();
+    Geometry geometry = CreateQuadGeometry();
+    Shader   shader   = Shader::New("vertexSrc1", "fragmentSrc1");
+    Renderer renderer = Renderer::New(geometry, shader);
+    Actor    actor    = Actor::New();
+    actor.AddRenderer(renderer);
+    actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+    application.GetScene().Add(actor);
+    application.SendNotification();
+    application.Render();
+
+    DALI_TEST_EQUALS(graphicsController.mCallStack.CountMethod("CreateProgram"), 0, TEST_LOCATION);
+  }
+
+  unsetenv("DALI_PROGRAM_CACHE_FILE");
+
+  END_TEST;
+}
@@ -19,6 +19,7 @@
 
 #include <dali/integration-api/queue/queue-benchmark-instrumentation.h>
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <filesystem>
@@ -63,6 +64,11 @@ void SetEnvironmentVariable(const char* name, const char* value)
 #endif
 }
 
+std::uint64_t GetMergedPropertyMessageCount()
+{
+  return QueueBenchmark::GetCounters()[static_cast<std::size_t>(QueueBenchmark::Counter::MQ_MERGED_PROPERTY_MESSAGES)].load();
+}
+
 void UnsetEnvironmentVariable(const char* name)
 {
 #if defined(_WIN32)
@@ -299,6 +305,7 @@ int UtcDaliInternalQueueBenchmarkNamesP(void)
   // Test CounterName
   DALI_TEST_CHECK(std::string(QueueBenchmark::CounterName(QueueBenchmark::Counter::MQ_BUFFER_FULL_EVENTS)) == "MQ_BufferFullEvents");
   DALI_TEST_CHECK(std::string(QueueBenchmark::CounterName(QueueBenchmark::Counter::NM_BUFFER_FULL_EVENTS)) == "NM_BufferFullEvents");
+  DALI_TEST_CHECK(std::string(QueueBenchmark::CounterName(QueueBenchmark::Counter::MQ_MERGED_PROPERTY_MESSAGES)) == "MQ_MergedPropertyMessages");
 
   // Test ValueChannelName
   DALI_TEST_CHECK(std::string(QueueBenchmark::ValueChannelName(QueueBenchmark::ValueChannel::MQ_BACKLOG_BYTES)) == "MQ_BacklogBytes");
@@ -311,3 +318,214 @@ int UtcDaliInternalQueueBenchmarkNamesP(void)
 
   END_TEST;
 }
+
+/**
+ * @brief Test that a property set several times before the messages are flushed is only processed with its last value
+ */
+int UtcDaliInternalQueueBenchmarkMergedPropertyMessagesP(void)
+{
+  tet_infoline("UtcDaliInternalQueueBenchmarkMergedPropertyMessagesP - Test merging of property messages");
+
+  SetEnvironmentVariable("DALI_QUEUE_BENCHMARK", "1");
+
+  TestApplication application;
+
+  Dali::Actor actor = Dali::Actor::New();
+  application.GetScene().Add(actor);
+  Property::Index customIndex = actor.RegisterProperty("custom", 0.0f);
+  application.SendNotification();
+  application.Render();
+
+  std::uint64_t mergedCount = GetMergedPropertyMessageCount();
+
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(1.0f, 2.0f, 3.0f));
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(4.0f, 5.0f, 6.0f));
+  actor.SetProperty(Dali::Actor::Property::COLOR, Color::RED);
+  actor.SetProperty(Dali::Actor::Property::COLOR, Color::BLUE);
+  actor.SetProperty(Dali::Actor::Property::OPACITY, 0.5f);
+  actor.SetProperty(Dali::Actor::Property::OPACITY, 0.25f);
+  actor.SetProperty(customIndex, 1.0f);
+  actor.SetProperty(customIndex, 2.0f);
+  actor.SetProperty(customIndex, 3.0f);
+  DALI_TEST_EQUALS(GetMergedPropertyMessageCount(), mergedCount + 5u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(4.0f, 5.0f, 6.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector4>(Dali::Actor::Property::COLOR), Vector4(0.0f, 0.0f, 1.0f, 0.25f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<float>(customIndex), 3.0f, TEST_LOCATION);
+
+  // The messages of the previous frame can not be modified anymore
+  mergedCount = GetMergedPropertyMessageCount();
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(7.0f, 8.0f, 9.0f));
+  DALI_TEST_EQUALS(GetMergedPropertyMessageCount(), mergedCount, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(7.0f, 8.0f, 9.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+/**
+ * @brief Test that relative changes and component changes keep the order of the property messages
+ */
+int UtcDaliInternalQueueBenchmarkMergedPropertyMessagesOrderP(void)
+{
+  tet_infoline("UtcDaliInternalQueueBenchmarkMergedPropertyMessagesOrderP - Test merging keeps the order of relative changes");
+
+  SetEnvironmentVariable("DALI_QUEUE_BENCHMARK", "1");
+
+  TestApplication application;
+
+  Dali::Actor actor = Dali::Actor::New();
+  application.GetScene().Add(actor);
+  application.SendNotification();
+  application.Render();
+
+  std::uint64_t mergedCount = GetMergedPropertyMessageCount();
+
+  // The value set after a relative change is not merged into the value set before it
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(1.0f, 1.0f, 1.0f));
+  actor.TranslateBy(Vector3(10.0f, 10.0f, 10.0f));
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(2.0f, 2.0f, 2.0f));
+  actor.TranslateBy(Vector3(10.0f, 10.0f, 10.0f));
+
+  // The component is set after the whole property
+  actor.SetProperty(Dali::Actor::Property::SCALE, Vector3(2.0f, 2.0f, 2.0f));
+  actor.SetProperty(Dali::Actor::Property::SCALE_X, 3.0f);
+  actor.SetProperty(Dali::Actor::Property::SCALE, Vector3(4.0f, 4.0f, 4.0f));
+  actor.SetProperty(Dali::Actor::Property::SCALE_Y, 5.0f);
+  actor.SetProperty(Dali::Actor::Property::SCALE_Y, 6.0f);
+  DALI_TEST_EQUALS(GetMergedPropertyMessageCount(), mergedCount + 1u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(12.0f, 12.0f, 12.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::SCALE), Vector3(4.0f, 6.0f, 4.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+/**
+ * @brief Test that a value set after an animation bakes the property is not merged into the value set before
+ */
+int UtcDaliInternalQueueBenchmarkMergedPropertyMessagesAnimationP(void)
+{
+  tet_infoline("UtcDaliInternalQueueBenchmarkMergedPropertyMessagesAnimationP - Test merging keeps the order of animation bakes");
+
+  SetEnvironmentVariable("DALI_QUEUE_BENCHMARK", "1");
+
+  TestApplication application;
+
+  Dali::Actor actor = Dali::Actor::New();
+  application.GetScene().Add(actor);
+
+  const Vector3 targetPosition(100.0f, 100.0f, 100.0f);
+
+  auto PlayAnimation = [&]()
+  {
+    Dali::Animation animation = Dali::Animation::New(1.0f);
+    animation.AnimateTo(Dali::Property(actor, Dali::Actor::Property::POSITION), targetPosition);
+    animation.SetEndAction(Dali::Animation::EndAction::BAKE_FINAL);
+    animation.Play();
+    application.SendNotification();
+    application.Render(500);
+    return animation;
+  };
+
+  tet_infoline("Set / Stop / Set");
+  Dali::Animation animation   = PlayAnimation();
+  std::uint64_t   mergedCount = GetMergedPropertyMessageCount();
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(1.0f, 1.0f, 1.0f));
+  animation.Stop();
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(2.0f, 2.0f, 2.0f));
+  DALI_TEST_EQUALS(GetMergedPropertyMessageCount(), mergedCount, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(2.0f, 2.0f, 2.0f), TEST_LOCATION);
+
+  tet_infoline("Set / destroy animation / Set");
+  animation   = PlayAnimation();
+  mergedCount = GetMergedPropertyMessageCount();
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(3.0f, 3.0f, 3.0f));
+  animation.Clear();
+  animation.Reset();
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(4.0f, 4.0f, 4.0f));
+  DALI_TEST_EQUALS(GetMergedPropertyMessageCount(), mergedCount, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(4.0f, 4.0f, 4.0f), TEST_LOCATION);
+
+  tet_infoline("Values set after the bake are still merged with each other");
+  mergedCount = GetMergedPropertyMessageCount();
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(5.0f, 5.0f, 5.0f));
+  actor.SetProperty(Dali::Actor::Property::POSITION, Vector3(6.0f, 6.0f, 6.0f));
+  DALI_TEST_EQUALS(GetMergedPropertyMessageCount(), mergedCount + 1u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<Vector3>(Dali::Actor::Property::POSITION), Vector3(6.0f, 6.0f, 6.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+/**
+ * @brief Benchmark of a script which sets 10k properties per frame
+ */
+int UtcDaliInternalQueueBenchmarkMergedPropertyMessagesBenchmarkP(void)
+{
+  tet_infoline("UtcDaliInternalQueueBenchmarkMergedPropertyMessagesBenchmarkP - Set 10k properties per frame");
+
+  SetEnvironmentVariable("DALI_QUEUE_BENCHMARK", "1");
+
+  TestApplication application;
+
+  constexpr uint32_t actorCount   = 1000u;
+  constexpr uint32_t setsPerActor = 10u;
+  constexpr uint32_t frameCount   = 10u;
+  std::vector<Dali::Actor> actors;
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    actors.push_back(Dali::Actor::New());
+    application.GetScene().Add(actors.back());
+  }
+  application.SendNotification();
+  application.Render();
+
+  const std::uint64_t mergedCount = GetMergedPropertyMessageCount();
+  const auto          start       = std::chrono::steady_clock::now();
+  for(uint32_t frame = 0u; frame < frameCount; ++frame)
+  {
+    for(uint32_t i = 0u; i < actorCount; ++i)
+    {
+      for(uint32_t j = 0u; j < setsPerActor; ++j)
+      {
+        actors[i].SetProperty(Dali::Actor::Property::POSITION_X, static_cast<float>(frame * setsPerActor + j));
+      }
+    }
+    application.SendNotification();
+    application.Render();
+  }
+  const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+  const std::uint64_t merged = GetMergedPropertyMessageCount() - mergedCount;
+  tet_printf("%u property sets per frame: %u frames in %lld us, %llu messages merged\n", actorCount * setsPerActor, frameCount, static_cast<long long>(duration.count()), static_cast<unsigned long long>(merged));
+
+  // Only the first message of each actor is queued per frame
+  DALI_TEST_EQUALS(merged, static_cast<std::uint64_t>(frameCount * actorCount * (setsPerActor - 1u)), TEST_LOCATION);
+  for(auto& actor : actors)
+  {
+    DALI_TEST_EQUALS(actor.GetCurrentProperty<float>(Dali::Actor::Property::POSITION_X), static_cast<float>(frameCount * setsPerActor - 1u), TEST_LOCATION);
+  }
+
+  END_TEST;
+}
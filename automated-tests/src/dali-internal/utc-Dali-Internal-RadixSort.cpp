@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Internal headers are allowed here
+#include <dali/internal/common/radix-sort.h>
+
+using namespace Dali;
+using Dali::Internal::FloatToOrderedBits;
+using Dali::Internal::RadixSort;
+using Dali::Internal::RadixSortItem;
+
+namespace
+{
+bool CompareKeys(const RadixSortItem& lhs, const RadixSortItem& rhs)
+{
+  return lhs.primaryKey != rhs.primaryKey ? lhs.primaryKey < rhs.primaryKey : lhs.secondaryKey < rhs.secondaryKey;
+}
+
+std::vector<RadixSortItem> CreateItems(uint32_t count, uint64_t primaryKeyMask, uint64_t secondaryKeyMask)
+{
+  std::mt19937_64            random(count);
+  std::vector<RadixSortItem> items(count);
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    items[i].primaryKey   = random() & primaryKeyMask;
+    items[i].secondaryKey = random() & secondaryKeyMask;
+    items[i].index        = i;
+  }
+  return items;
+}
+
+bool IsSameOrder(const std::vector<RadixSortItem>& lhs, const std::vector<RadixSortItem>& rhs)
+{
+  if(lhs.size() != rhs.size())
+  {
+    return false;
+  }
+  for(uint32_t i = 0u; i < lhs.size(); ++i)
+  {
+    if(lhs[i].index != rhs[i].index)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+void utc_dali_internal_radix_sort_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_radix_sort_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliRadixSortMatchesStableSortP(void)
+{
+  const uint64_t masks[][2] = {
+    {~0ull, ~0ull},          // Every pass
+    {0xff00ull, 0u},         // A single pass, most being skipped
+    {0x3ull, 0x7ull},        // Many equal keys, checks the stability
+    {0xffff000000000000ull, 0xffull},
+  };
+
+  std::vector<RadixSortItem> buffer;
+  for(const auto& mask : masks)
+  {
+    for(uint32_t count : {0u, 1u, 2u, 17u, 1000u})
+    {
+      std::vector<RadixSortItem> items    = CreateItems(count, mask[0], mask[1]);
+      std::vector<RadixSortItem> expected = items;
+      std::stable_sort(expected.begin(), expected.end(), CompareKeys);
+
+      RadixSort(items, buffer);
+      DALI_TEST_CHECK(IsSameOrder(items, expected));
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRadixSortFloatToOrderedBitsP(void)
+{
+  const float values[] = {-std::numeric_limits<float>::infinity(), -1.0e10f, -2.5f, -1.0f, -1.0e-20f, -0.0f, 0.0f, 1.0e-20f, 1.0f, 1.5f, 2.0f, 1.0e10f, std::numeric_limits<float>::infinity()};
+
+  for(uint32_t i = 1u; i < sizeof(values) / sizeof(values[0]); ++i)
+  {
+    if(values[i - 1u] < values[i])
+    {
+      DALI_TEST_CHECK(FloatToOrderedBits(values[i - 1u]) < FloatToOrderedBits(values[i]));
+    }
+  }
+  DALI_TEST_EQUALS(FloatToOrderedBits(-0.0f) + 1u, FloatToOrderedBits(0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRadixSortBenchmarkP(void)
+{
+  using Clock = std::chrono::steady_clock;
+
+  // Keys like the ones of a 3D layer : a few depth indices, a z value, and a few states.
+  const uint32_t             count = 10000u;
+  std::vector<RadixSortItem> items = CreateItems(count, 0x3ffffffffull, 0xfffull);
+  std::vector<RadixSortItem> buffer;
+  std::vector<RadixSortItem> expected = items;
+
+  auto start = Clock::now();
+  std::stable_sort(expected.begin(), expected.end(), CompareKeys);
+  const auto stableSortTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  start = Clock::now();
+  RadixSort(items, buffer);
+  const auto radixSortTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  DALI_TEST_CHECK(IsSameOrder(items, expected));
+  tet_printf("%u items : stable_sort %lld us, radix sort %lld us\n", count, static_cast<long long>(stableSortTime), static_cast<long long>(radixSortTime));
+
+  END_TEST;
+}
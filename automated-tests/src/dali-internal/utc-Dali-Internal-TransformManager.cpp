@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+// Internal headers are allowed here
+
+using namespace Dali;
+using namespace Dali::Internal::SceneGraph;
+
+namespace
+{
+/**
+ * Builds the same hierarchy in the given transform manager : a single root with wide children,
+ * each of them owning a deep chain of descendants.
+ */
+void BuildHierarchy(TransformManager& manager, std::vector<TransformId>& ids, uint32_t width, uint32_t depth)
+{
+  const TransformId root = manager.CreateTransform();
+  manager.SetParent(root, PARENT_OF_ROOT_NODE_TRANSFORM_ID);
+  manager.SetVector3PropertyValue(root, TRANSFORM_PROPERTY_SIZE, Vector3(480.0f, 800.0f, 0.0f));
+  ids.push_back(root);
+
+  for(uint32_t x = 0u; x < width; ++x)
+  {
+    TransformId parent = root;
+    for(uint32_t y = 0u; y < depth; ++y)
+    {
+      const TransformId id = manager.CreateTransform();
+      manager.SetParent(id, parent);
+      manager.SetVector3PropertyValue(id, TRANSFORM_PROPERTY_POSITION, Vector3(static_cast<float>(x), static_cast<float>(y), 1.0f));
+      manager.SetVector3PropertyValue(id, TRANSFORM_PROPERTY_SIZE, Vector3(10.0f + x, 20.0f + y, 0.0f));
+      manager.SetVector3PropertyValue(id, TRANSFORM_PROPERTY_SCALE, Vector3(1.01f, 0.99f, 1.0f));
+      manager.SetQuaternionPropertyValue(id, Quaternion(Radian(0.001f * static_cast<float>(x + y)), Vector3::ZAXIS));
+      if((x + y) % 7u == 0u)
+      {
+        manager.SetInheritScale(id, false);
+      }
+      ids.push_back(id);
+      parent = id;
+    }
+  }
+}
+
+} // namespace
+
+void utc_dali_internal_transform_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_transform_manager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcTransformManagerParallelUpdateMatchesSerialP(void)
+{
+  TestApplication application;
+
+  constexpr uint32_t WIDTH = 2048u;
+  constexpr uint32_t DEPTH = 4u;
+
+  ThreadPool threadPool;
+  DALI_TEST_CHECK(threadPool.Initialize(3u));
+
+  TransformManager serialManager;
+  TransformManager parallelManager;
+  parallelManager.SetThreadPool(&threadPool);
+  parallelManager.SetParallelUpdateThreshold(0u);
+
+  std::vector<TransformId> serialIds;
+  std::vector<TransformId> parallelIds;
+  BuildHierarchy(serialManager, serialIds, WIDTH, DEPTH);
+  BuildHierarchy(parallelManager, parallelIds, WIDTH, DEPTH);
+
+  DALI_TEST_EQUALS(serialManager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelManager.Update(), true, TEST_LOCATION);
+
+  bool identical = true;
+  for(uint32_t i = 0u; i < serialIds.size(); ++i)
+  {
+    identical = identical && (serialManager.GetWorldMatrix(serialIds[i]) == parallelManager.GetWorldMatrix(parallelIds[i]));
+    identical = identical && (serialManager.GetBoundingSphere(serialIds[i]) == parallelManager.GetBoundingSphere(parallelIds[i]));
+    identical = identical && (serialManager.IsWorldMatrixDirty(serialIds[i]) == parallelManager.IsWorldMatrixDirty(parallelIds[i]));
+  }
+  DALI_TEST_CHECK(identical);
+
+  // Change only the root; every world matrix must follow in both modes.
+  serialManager.SetVector3PropertyValue(serialIds[0], TRANSFORM_PROPERTY_POSITION, Vector3(5.0f, 6.0f, 7.0f));
+  parallelManager.SetVector3PropertyValue(parallelIds[0], TRANSFORM_PROPERTY_POSITION, Vector3(5.0f, 6.0f, 7.0f));
+
+  DALI_TEST_EQUALS(serialManager.Update(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelManager.Update(), true, TEST_LOCATION);
+
+  for(uint32_t i = 0u; i < serialIds.size(); ++i)
+  {
+    identical = identical && (serialManager.GetWorldMatrix(serialIds[i]) == parallelManager.GetWorldMatrix(parallelIds[i]));
+    identical = identical && (serialManager.GetBoundingSphere(serialIds[i]) == parallelManager.GetBoundingSphere(parallelIds[i]));
+  }
+  DALI_TEST_CHECK(identical);
+
+  END_TEST;
+}
+
+int UtcTransformManagerParallelUpdateBelowThresholdP(void)
+{
+  TestApplication application;
+
+  ThreadPool threadPool;
+  DALI_TEST_CHECK(threadPool.Initialize(2u));
+
+  TransformManager manager;
+  manager.SetThreadPool(&threadPool);
+
+  // Default threshold keeps this small scene on the serial path.
+  std::vector<TransformId> ids;
+  BuildHierarchy(manager, ids, 4u, 3u);
+
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+
+  Matrix expected(false);
+  expected.SetTransformComponents(Vector3::ONE, Quaternion(), Vector3::ZERO);
+  DALI_TEST_EQUALS(manager.GetWorldMatrix(ids[0]), expected, 0.0001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.IsWorldMatrixDirty(ids.back()), true, TEST_LOCATION);
+
+  // Nothing changed : no update.
+  manager.Update();
+  DALI_TEST_EQUALS(manager.Update(), false, TEST_LOCATION);
+
+  // Removing the thread pool must not change anything either.
+  manager.SetThreadPool(nullptr);
+  manager.SetVector3PropertyValue(ids[1], TRANSFORM_PROPERTY_POSITION, Vector3(1.0f, 2.0f, 3.0f));
+  DALI_TEST_EQUALS(manager.Update(), true, TEST_LOCATION);
+
+  END_TEST;
+}
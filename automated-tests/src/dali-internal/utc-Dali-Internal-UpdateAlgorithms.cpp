@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+
+#include <chrono>
+#include <vector>
+
+// Internal headers are allowed here
+#include <dali/internal/update/manager/transform-manager.h>
+#include <dali/internal/update/manager/update-algorithms.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/nodes/scene-graph-layer.h>
+
+using namespace Dali;
+using namespace Dali::Internal;
+using namespace Dali::Internal::SceneGraph;
+
+namespace
+{
+/**
+ * Owns a root layer and its descendants, created directly in the scene graph.
+ */
+struct TestNodeTree
+{
+  TestNodeTree()
+  : root(SceneGraph::Layer::New())
+  {
+    root->CreateTransform(&transformManager);
+    root->SetRoot(true);
+  }
+
+  ~TestNodeTree()
+  {
+    for(auto iter = nodes.rbegin(); iter != nodes.rend(); ++iter)
+    {
+      Node::Delete(*iter);
+    }
+    Node::Delete(root);
+  }
+
+  Node* AddNode(Node& parent, float alpha)
+  {
+    Node* node = Node::New();
+    node->CreateTransform(&transformManager);
+    node->mColor.Bake(Vector4(1.0f, 1.0f, 1.0f, alpha));
+    parent.ConnectChild(node);
+    nodes.push_back(node);
+    return node;
+  }
+
+  TransformManager   transformManager;
+  SceneGraph::Layer* root;
+  std::vector<Node*> nodes;
+};
+
+/**
+ * The recursive traversal which the flattened node tree replaces, used as a reference.
+ */
+NodePropertyFlags RecursiveUpdateNodes(Node& node, NodePropertyFlags parentFlags, PropertyOwnerContainer& postPropertyOwners, bool updated)
+{
+  if(node.IsIgnored())
+  {
+    return NodePropertyFlags::NOTHING;
+  }
+
+  ConstrainPropertyOwner(node, true, postPropertyOwners);
+
+  NodePropertyFlags nodeDirtyFlags       = node.GetDirtyFlags() | node.GetInheritedDirtyFlags(parentFlags);
+  NodePropertyFlags cumulativeDirtyFlags = nodeDirtyFlags;
+
+  if(nodeDirtyFlags & NodePropertyFlags::COLOR)
+  {
+    node.InheritWorldColor();
+  }
+  node.GetPartialRenderingData().Aging();
+
+  if(updated)
+  {
+    node.SetUpdated(true);
+  }
+  else if(node.Updated())
+  {
+    updated = true;
+  }
+
+  for(Node* child : node.GetChildren())
+  {
+    cumulativeDirtyFlags |= RecursiveUpdateNodes(*child, nodeDirtyFlags, postPropertyOwners, updated);
+  }
+  return cumulativeDirtyFlags;
+}
+
+NodePropertyFlags RecursiveUpdateNodeTree(SceneGraph::Layer& root, PropertyOwnerContainer& postPropertyOwners)
+{
+  NodePropertyFlags cumulativeDirtyFlags = root.GetDirtyFlags();
+  root.SetWorldColor(root.GetColor());
+  root.GetPartialRenderingData().Aging();
+  for(Node* child : root.GetChildren())
+  {
+    cumulativeDirtyFlags |= RecursiveUpdateNodes(*child, root.GetDirtyFlags(), postPropertyOwners, root.Updated());
+  }
+  return cumulativeDirtyFlags;
+}
+
+/**
+ * Runs both traversals on the tree, checks they give the same result, and prints their duration.
+ */
+void CompareTraversals(TestNodeTree& tree, const char* name, uint32_t iterations)
+{
+  FlattenedNodeTree      nodeTree;
+  PropertyOwnerContainer postPropertyOwners;
+
+  using Clock = std::chrono::steady_clock;
+
+  // The first call builds the flattened tree, which is only done when the hierarchy changes.
+  NodePropertyFlags flattenedFlags = UpdateNodeTree(*tree.root, nodeTree, nullptr, postPropertyOwners);
+
+  auto start = Clock::now();
+  for(uint32_t i = 0u; i < iterations; ++i)
+  {
+    flattenedFlags = UpdateNodeTree(*tree.root, nodeTree, nullptr, postPropertyOwners);
+  }
+  const auto flattenedTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  std::vector<Vector4> flattenedColors;
+  for(Node* node : tree.nodes)
+  {
+    flattenedColors.push_back(node->GetWorldColor());
+  }
+
+  NodePropertyFlags recursiveFlags = NodePropertyFlags::NOTHING;
+  start                            = Clock::now();
+  for(uint32_t i = 0u; i < iterations; ++i)
+  {
+    recursiveFlags = RecursiveUpdateNodeTree(*tree.root, postPropertyOwners);
+  }
+  const auto recursiveTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  DALI_TEST_EQUALS(static_cast<uint32_t>(flattenedFlags), static_cast<uint32_t>(recursiveFlags), TEST_LOCATION);
+
+  bool identical = true;
+  for(uint32_t i = 0u; i < tree.nodes.size(); ++i)
+  {
+    identical = identical && (flattenedColors[i] == tree.nodes[i]->GetWorldColor());
+  }
+  DALI_TEST_CHECK(identical);
+
+  tet_printf("%s tree of %zu nodes, %u updates : recursive %lld us, flattened %lld us\n", name, tree.nodes.size(), iterations, static_cast<long long>(recursiveTime), static_cast<long long>(flattenedTime));
+}
+
+} // namespace
+
+void utc_dali_internal_update_algorithms_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_update_algorithms_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliFlattenedNodeTreeDepthFirstOrderP(void)
+{
+  TestApplication application;
+
+  TestNodeTree tree;
+  Node*        a  = tree.AddNode(*tree.root, 1.0f);
+  Node*        a1 = tree.AddNode(*a, 1.0f);
+  Node*        a2 = tree.AddNode(*a, 1.0f);
+  Node*        b  = tree.AddNode(*tree.root, 1.0f);
+  Node*        b1 = tree.AddNode(*b, 1.0f);
+  Node*        b2 = tree.AddNode(*b1, 1.0f);
+
+  FlattenedNodeTree nodeTree;
+  nodeTree.Update(*tree.root);
+
+  const auto& entries = nodeTree.GetEntries();
+  DALI_TEST_EQUALS(entries.size(), 7u, TEST_LOCATION);
+
+  const Node* expectedOrder[] = {tree.root, a, a1, a2, b, b1, b2};
+  const uint32_t expectedParents[] = {0u, 0u, 1u, 1u, 0u, 4u, 5u};
+  const uint32_t expectedEnds[]    = {7u, 4u, 3u, 4u, 7u, 7u, 7u};
+  for(uint32_t i = 0u; i < entries.size(); ++i)
+  {
+    DALI_TEST_CHECK(entries[i].node == expectedOrder[i]);
+    DALI_TEST_EQUALS(entries[i].parentIndex, expectedParents[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(entries[i].subtreeEnd, expectedEnds[i], TEST_LOCATION);
+  }
+
+  // Not rebuilt until marked dirty
+  tree.AddNode(*a2, 1.0f);
+  nodeTree.Update(*tree.root);
+  DALI_TEST_EQUALS(nodeTree.GetEntries().size(), 7u, TEST_LOCATION);
+
+  nodeTree.SetDirty();
+  nodeTree.Update(*tree.root);
+  DALI_TEST_EQUALS(nodeTree.GetEntries().size(), 8u, TEST_LOCATION);
+  DALI_TEST_EQUALS(nodeTree.GetEntries()[1].subtreeEnd, 5u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFlattenedNodeTreeIgnoredSubtreeP(void)
+{
+  TestApplication application;
+
+  TestNodeTree tree;
+  Node*        parent = tree.AddNode(*tree.root, 0.5f);
+  Node*        child  = tree.AddNode(*parent, 0.5f);
+  Node*        other  = tree.AddNode(*tree.root, 0.25f);
+
+  FlattenedNodeTree      nodeTree;
+  PropertyOwnerContainer postPropertyOwners;
+  UpdateNodeTree(*tree.root, nodeTree, nullptr, postPropertyOwners);
+
+  DALI_TEST_EQUALS(child->GetWorldColor().a, 0.25f, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+  DALI_TEST_EQUALS(other->GetWorldColor().a, 0.25f, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+
+  // The descendants of an ignored node are skipped as well
+  parent->SetIgnored(true);
+  parent->mColor.Bake(Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+  child->mColor.Bake(Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+  other->mColor.Bake(Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+  UpdateNodeTree(*tree.root, nodeTree, nullptr, postPropertyOwners);
+
+  DALI_TEST_EQUALS(child->GetWorldColor().a, 0.25f, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+  DALI_TEST_EQUALS(other->GetWorldColor().a, 1.0f, Math::MACHINE_EPSILON_10, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFlattenedNodeTreeMatchesRecursiveDeepP(void)
+{
+  TestApplication application;
+
+  TestNodeTree tree;
+  for(uint32_t x = 0u; x < 64u; ++x)
+  {
+    Node* parent = tree.root;
+    for(uint32_t y = 0u; y < 32u; ++y)
+    {
+      parent = tree.AddNode(*parent, (x + y) % 3u == 0u ? 0.9f : 1.0f);
+    }
+  }
+
+  CompareTraversals(tree, "Deep", 100u);
+
+  END_TEST;
+}
+
+int UtcDaliFlattenedNodeTreeMatchesRecursiveWideP(void)
+{
+  TestApplication application;
+
+  TestNodeTree tree;
+  Node*        parent = tree.AddNode(*tree.root, 0.5f);
+  for(uint32_t x = 0u; x < 10000u; ++x)
+  {
+    tree.AddNode(*parent, x % 2u == 0u ? 0.5f : 1.0f);
+  }
+
+  CompareTraversals(tree, "Wide", 100u);
+
+  END_TEST;
+}
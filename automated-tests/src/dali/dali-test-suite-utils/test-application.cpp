@@ -174,6 +174,16 @@ TestGraphicsSyncImplementation& TestApplication::GetGraphicsSyncImpl()
   return static_cast<TestGraphicsSyncImplementation&>(mGraphicsController.GetGraphicsSyncImpl());
 }
 
+Dali::Integration::ScenePreRenderStatus& TestApplication::GetScenePreRenderStatus()
+{
+  return mScenePreRenderStatus;
+}
+
+Dali::Integration::RenderStatus& TestApplication::GetRenderStatus()
+{
+  return mRenderStatus;
+}
+
 void TestApplication::ProcessEvent(const Dali::Integration::Event& event)
 {
   mCore->QueueEvent(event);
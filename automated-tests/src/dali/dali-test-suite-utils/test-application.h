@@ -68,8 +68,10 @@ public:
   TestRenderController&    GetRenderController();
   TestGraphicsController&  GetGraphicsController();
 
-  TestGlAbstraction&              GetGlAbstraction();
-  TestGraphicsSyncImplementation& GetGraphicsSyncImpl();
+  TestGlAbstraction&                       GetGlAbstraction();
+  TestGraphicsSyncImplementation&          GetGraphicsSyncImpl();
+  Dali::Integration::ScenePreRenderStatus& GetScenePreRenderStatus();
+  Dali::Integration::RenderStatus&         GetRenderStatus();
 
   void        ProcessEvent(const Dali::Integration::Event& event);
   void        SendNotification();
@@ -1228,6 +1228,10 @@ void TestGraphicsController::UpdateTextures(const std::vector<Graphics::TextureU
   TraceCallStack::NamedParams namedParams;
   namedParams["updateInfoList"] << "[" << updateInfoList.size() << "]:";
   namedParams["sourceList"] << "[" << sourceList.size() << "]:";
+  for(auto& updateInfo : updateInfoList)
+  {
+    namedParams["srcReference"] << updateInfo.srcReference << " ";
+  }
 
   mCallStack.PushCall("UpdateTextures", "", namedParams);
 
@@ -1235,7 +1239,7 @@ void TestGraphicsController::UpdateTextures(const std::vector<Graphics::TextureU
   for(unsigned int i = 0; i < updateInfoList.size(); ++i)
   {
     auto& updateInfo = updateInfoList[i];
-    auto& source     = sourceList[i];
+    auto& source     = sourceList[updateInfo.srcReference];
 
     auto texture = static_cast<TestGraphicsTexture*>(updateInfo.dstTexture);
     texture->Bind(0); // Use first texture unit during resource update
@@ -88,6 +88,7 @@ void TraceCallStack::PushCall(std::string method, std::string params)
   if(mTraceActive)
   {
     FunctionCall stackFrame(method, params);
+    std::lock_guard<std::mutex> lock(mMutex);
     mCallStack.push_back(stackFrame);
   }
   if(mLogging)
@@ -101,6 +102,7 @@ void TraceCallStack::PushCall(std::string method, std::string params, const Trac
   if(mTraceActive)
   {
     FunctionCall stackFrame(method, params, altParams);
+    std::lock_guard<std::mutex> lock(mMutex);
     mCallStack.push_back(stackFrame);
   }
   if(mLogging)
@@ -19,6 +19,7 @@
  */
 
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -328,6 +329,7 @@ public:
   };
 
   std::vector<FunctionCall> mCallStack; ///< The call stack
+  std::mutex                mMutex;     ///< Guards the call stack, as command buffers may be recorded by several threads
 };
 
 } // namespace Dali
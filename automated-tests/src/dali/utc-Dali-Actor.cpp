@@ -12720,6 +12720,75 @@ int utcDaliActorPartialUpdate(void)
   END_TEST;
 }
 
+int utcDaliActorPartialUpdateMaximumDamagedRectCount(void)
+{
+  TestApplication application(
+    TestApplication::DEFAULT_SURFACE_WIDTH,
+    TestApplication::DEFAULT_SURFACE_HEIGHT,
+    TestApplication::DEFAULT_HORIZONTAL_DPI,
+    TestApplication::DEFAULT_VERTICAL_DPI,
+    true,
+    true);
+
+  tet_infoline("Check the damaged rects are merged into the maximum number of rects");
+
+  std::vector<BoundsInteger> damagedRects;
+  BoundsInteger              clippingRect;
+  application.SendNotification();
+  application.PreRenderWithPartialUpdate(TestApplication::RENDER_FRAME_INTERVAL, nullptr, damagedRects);
+  clippingRect = TestApplication::DEFAULT_SURFACE_RECT;
+  application.RenderWithPartialUpdate(damagedRects, clippingRect);
+
+  std::vector<Actor> actors;
+  for(const Vector3& position : {Vector3(16.0f, 16.0f, 0.0f), Vector3(64.0f, 16.0f, 0.0f), Vector3(400.0f, 600.0f, 0.0f)})
+  {
+    Actor actor = CreateRenderableActor();
+    actor.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+    actor.SetProperty(Actor::Property::POSITION, position);
+    actor.SetProperty(Actor::Property::SIZE, Vector3(16.0f, 16.0f, 0.0f));
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+  }
+
+  // Without maximum, every actor has its own damaged rect
+  application.SendNotification();
+  damagedRects.clear();
+  application.PreRenderWithPartialUpdate(TestApplication::RENDER_FRAME_INTERVAL, nullptr, damagedRects);
+  DALI_TEST_EQUALS(damagedRects.size(), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetScenePreRenderStatus().GetDamagedAreaRatio(), 1.0f, TEST_LOCATION);
+  application.RenderWithPartialUpdate(damagedRects, clippingRect);
+
+  // The two actors close to each other share a damaged rect
+  application.GetScenePreRenderStatus().SetMaximumDamagedRectCount(2u);
+  for(auto&& actor : actors)
+  {
+    actor.SetProperty(Actor::Property::COLOR, Color::RED);
+  }
+  application.SendNotification();
+  damagedRects.clear();
+  application.PreRenderWithPartialUpdate(TestApplication::RENDER_FRAME_INTERVAL, nullptr, damagedRects);
+  DALI_TEST_EQUALS(damagedRects.size(), 2, TEST_LOCATION);
+  DirtyRectChecker(damagedRects, {BoundsInteger(0, 752, 96, 48), BoundsInteger(384, 176, 48, 32)}, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetScenePreRenderStatus().GetDamagedAreaRatio(), 1.0f, TEST_LOCATION);
+  application.RenderWithPartialUpdate(damagedRects, clippingRect);
+
+  // Every damaged rect merged into one
+  application.GetScenePreRenderStatus().SetMaximumDamagedRectCount(1u);
+  for(auto&& actor : actors)
+  {
+    actor.SetProperty(Actor::Property::COLOR, Color::BLUE);
+  }
+  application.SendNotification();
+  damagedRects.clear();
+  application.PreRenderWithPartialUpdate(TestApplication::RENDER_FRAME_INTERVAL, nullptr, damagedRects);
+  DALI_TEST_EQUALS(damagedRects.size(), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS<BoundsInteger>(damagedRects[0], BoundsInteger(0, 176, 432, 624), TEST_LOCATION);
+  DALI_TEST_GREATER(application.GetScenePreRenderStatus().GetDamagedAreaRatio(), 1.0f, TEST_LOCATION);
+  application.RenderWithPartialUpdate(damagedRects, clippingRect);
+
+  END_TEST;
+}
+
 int utcDaliActorPartialUpdateSetColor(void)
 {
   TestApplication application(
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/devel-api/actors/actor-creation-batch.h>
+#include <dali/public-api/dali-core.h>
+#include <mesh-builder.h>
+
+#include <chrono>
+
+using namespace Dali;
+
+void utc_dali_actor_creation_batch_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_actor_creation_batch_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+/**
+ * Creates a page of items, each with a renderer.
+ */
+Actor CreatePage(Renderer renderer, uint32_t itemCount)
+{
+  Actor page = Actor::New();
+  page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  page.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  page.SetProperty(Actor::Property::SIZE, Vector2(480.0f, 800.0f));
+  for(uint32_t i = 0u; i < itemCount; ++i)
+  {
+    Actor item = Actor::New();
+    item.AddRenderer(renderer);
+    item.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    item.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+    item.SetProperty(Actor::Property::SIZE, Vector2(480.0f, 1.0f));
+    item.SetProperty(Actor::Property::POSITION, Vector2(0.0f, static_cast<float>(i)));
+    item.SetProperty(Actor::Property::COLOR, Color::RED);
+    page.Add(item);
+  }
+  return page;
+}
+
+} // namespace
+
+int UtcDaliActorCreationBatchP(void)
+{
+  TestApplication application;
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader   shader   = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  Actor page;
+  {
+    ActorCreationBatch batch;
+    page = CreatePage(renderer, 10u);
+    page.SetProperty(Actor::Property::POSITION, Vector2(10.0f, 20.0f));
+    application.GetScene().Add(page);
+
+    // Nothing is sent to the update thread before the batch is destroyed
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS(page.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3::ZERO, TEST_LOCATION);
+    DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 0, TEST_LOCATION);
+  }
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(page.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(10.0f, 20.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(page.GetChildCount(), 10u, TEST_LOCATION);
+  DALI_TEST_EQUALS(page.GetChildAt(9u).GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 9.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(page.GetChildAt(9u).GetCurrentProperty<Vector4>(Actor::Property::COLOR), Color::RED, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 10, TEST_LOCATION);
+
+  // The actors still work normally after the batch
+  page.GetChildAt(0u).Unparent();
+  page.SetProperty(Actor::Property::POSITION, Vector2(30.0f, 40.0f));
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(page.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(30.0f, 40.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 9, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliActorCreationBatchNestedP(void)
+{
+  TestApplication application;
+
+  Actor outer;
+  Actor inner;
+  {
+    ActorCreationBatch batch;
+    outer = Actor::New();
+    {
+      ActorCreationBatch nestedBatch;
+      inner = Actor::New();
+      inner.SetProperty(Actor::Property::POSITION, Vector2(1.0f, 2.0f));
+      outer.Add(inner);
+    }
+
+    // The nested batch is sent with the outer one
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS(inner.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3::ZERO, TEST_LOCATION);
+
+    application.GetScene().Add(outer);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(inner.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(1.0f, 2.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(inner.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION), outer.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION) + Vector3(1.0f, 2.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliActorCreationBatchOrderP(void)
+{
+  TestApplication application;
+
+  Actor existing = Actor::New();
+  application.GetScene().Add(existing);
+  existing.SetProperty(Actor::Property::POSITION, Vector2(1.0f, 1.0f));
+
+  {
+    ActorCreationBatch batch;
+
+    // The messages sent before the batch are processed first
+    existing.TranslateBy(Vector3(1.0f, 1.0f, 0.0f));
+
+    // An actor destroyed in the batch
+    Actor temporary = Actor::New();
+    application.GetScene().Add(temporary);
+    temporary.Unparent();
+    temporary.Reset();
+
+    Actor child = Actor::New();
+    existing.Add(child);
+    child.SetProperty(Actor::Property::POSITION, Vector2(5.0f, 5.0f));
+  }
+
+  // Sent after the batch
+  existing.TranslateBy(Vector3(1.0f, 1.0f, 0.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(existing.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(3.0f, 3.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(existing.GetChildAt(0u).GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION), existing.GetCurrentProperty<Vector3>(Actor::Property::WORLD_POSITION) + Vector3(5.0f, 5.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliActorCreationBatchEmptyP(void)
+{
+  TestApplication application;
+
+  const uint32_t childCount = application.GetScene().GetRootLayer().GetChildCount();
+  {
+    ActorCreationBatch batch;
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(application.GetScene().GetRootLayer().GetChildCount(), childCount, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliActorCreationBatchThroughputP(void)
+{
+  TestApplication application;
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader   shader   = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+
+  constexpr uint32_t itemCount = 500u;
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  // Populate a page of a list view, one actor at a time
+  auto  start   = std::chrono::steady_clock::now();
+  Actor page    = CreatePage(renderer, itemCount);
+  application.GetScene().Add(page);
+  application.SendNotification();
+  application.Render();
+  const auto unbatchedDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), static_cast<int>(itemCount), TEST_LOCATION);
+
+  page.Unparent();
+  page.Reset();
+  application.SendNotification();
+  application.Render();
+  drawTrace.Reset();
+
+  // The same page within a batch
+  start = std::chrono::steady_clock::now();
+  {
+    ActorCreationBatch batch;
+    page = CreatePage(renderer, itemCount);
+    application.GetScene().Add(page);
+  }
+  application.SendNotification();
+  application.Render();
+  const auto batchedDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), static_cast<int>(itemCount), TEST_LOCATION);
+
+  tet_printf("%u items with renderer: %lld us one by one, %lld us batched\n", itemCount, static_cast<long long>(unbatchedDuration.count()), static_cast<long long>(batchedDuration.count()));
+
+  DALI_TEST_EQUALS(page.GetChildAt(itemCount - 1u).GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, static_cast<float>(itemCount - 1u), 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
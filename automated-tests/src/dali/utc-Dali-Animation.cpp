@@ -29,6 +29,7 @@
 #include <dali/devel-api/common/vector-wrapper.h>
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <utility>
 
@@ -17728,3 +17729,107 @@ int UtcDaliAnimationGetEventThreadVariablesForVariousCase(void)
 
   END_TEST;
 }
+
+namespace
+{
+/**
+ * Animates the actors with several animations per property, and collects the animated values over several frames.
+ * @param[in] workerThreadCount The number of update worker threads, or "0" to update the animators serially.
+ * @param[in] actorCount The number of actors, each of which has its own animation.
+ * @param[out] values The animated values of each frame.
+ * @return The time spent to update and render the frames, in microseconds.
+ */
+long long AnimateActors(const char* workerThreadCount, uint32_t actorCount, std::vector<float>& values)
+{
+  setenv("DALI_UPDATE_WORKER_THREAD_COUNT", workerThreadCount, 1);
+  setenv("DALI_PARALLEL_ANIMATOR_MINIMUM_COUNT", "64", 1);
+  TestApplication application;
+  unsetenv("DALI_UPDATE_WORKER_THREAD_COUNT");
+  unsetenv("DALI_PARALLEL_ANIMATOR_MINIMUM_COUNT");
+
+  KeyFrames colorKeyFrames = KeyFrames::New();
+  colorKeyFrames.Add(0.0f, Color::RED);
+  colorKeyFrames.Add(0.5f, Color::GREEN);
+  colorKeyFrames.Add(1.0f, Color::BLUE);
+
+  std::vector<Actor>     actors;
+  std::vector<Animation> animations;
+
+  // Shared by every actor, it finishes and bakes before the others
+  Animation sharedAnimation = Animation::New(0.3f);
+
+  for(uint32_t i = 0u; i < actorCount; ++i)
+  {
+    Actor actor = Actor::New();
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+
+    const float offset    = static_cast<float>(i);
+    Animation   animation = Animation::New(0.5f);
+    animation.AnimateTo(Property(actor, Actor::Property::POSITION), Vector3(offset, 100.0f, 10.0f), AlphaFunction::EASE_IN_OUT);
+    animation.AnimateBy(Property(actor, Actor::Property::POSITION_X), 10.0f, TimePeriod(0.1f, 0.2f));
+    animation.AnimateTo(Property(actor, Actor::Property::SCALE), Vector3(2.0f, 3.0f, 1.0f), AlphaFunction::BOUNCE);
+    animation.AnimateBetween(Property(actor, Actor::Property::COLOR), colorKeyFrames);
+    animation.Play();
+    animations.push_back(animation);
+
+    sharedAnimation.AnimateBy(Property(actor, Actor::Property::POSITION_Y), offset, AlphaFunction::EASE_OUT);
+  }
+  sharedAnimation.Play();
+
+  values.clear();
+
+  const auto start = std::chrono::steady_clock::now();
+  for(uint32_t frame = 0u; frame < 6u; ++frame)
+  {
+    application.SendNotification();
+    application.Render(100);
+
+    for(auto&& actor : actors)
+    {
+      const Vector3 position = actor.GetCurrentProperty<Vector3>(Actor::Property::POSITION);
+      const Vector3 scale    = actor.GetCurrentProperty<Vector3>(Actor::Property::SCALE);
+      const Vector4 color    = actor.GetCurrentProperty<Vector4>(Actor::Property::COLOR);
+      values.insert(values.end(), {position.x, position.y, position.z, scale.x, scale.y, color.r, color.g, color.b});
+    }
+  }
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+int UtcDaliAnimationParallelAnimatorsP(void)
+{
+  tet_infoline("Ensure the animators updated by the update worker threads give the values of the serial update");
+
+  std::vector<float> serialValues;
+  std::vector<float> parallelValues;
+  AnimateActors("0", 50u, serialValues);
+  AnimateActors("2", 50u, parallelValues);
+
+  DALI_TEST_EQUALS(parallelValues.size(), serialValues.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(parallelValues == serialValues);
+
+  // The last frame of the second actor: the animations have finished
+  const uint32_t lastFrame = static_cast<uint32_t>(serialValues.size()) * 5u / 6u;
+  DALI_TEST_EQUALS(serialValues[lastFrame + 10u], 10.0f, 0.001f, TEST_LOCATION); // Z
+  DALI_TEST_EQUALS(serialValues[lastFrame + 11u], 1.0f, 0.001f, TEST_LOCATION);  // Scale, bounced back
+  DALI_TEST_EQUALS(serialValues[lastFrame + 15u], 1.0f, 0.001f, TEST_LOCATION);  // Blue
+
+  END_TEST;
+}
+
+int UtcDaliAnimationParallelAnimatorsBenchmarkP(void)
+{
+  constexpr uint32_t actorCount = 600u;
+
+  std::vector<float> serialValues;
+  std::vector<float> parallelValues;
+  const long long    serialTime   = AnimateActors("0", actorCount, serialValues);
+  const long long    parallelTime = AnimateActors("3", actorCount, parallelValues);
+
+  DALI_TEST_CHECK(parallelValues == serialValues);
+  tet_printf("%u animations of %u animators, 6 frames : serial %lld us, 3 worker threads %lld us\n", actorCount, actorCount * 5u, serialTime, parallelTime);
+
+  END_TEST;
+}
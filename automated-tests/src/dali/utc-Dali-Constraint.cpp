@@ -2996,3 +2996,186 @@ int UtcDaliConstraintGetStateWithCloneP(void)
 
   END_TEST;
 }
+
+namespace
+{
+void ChainPositionX(float& current, const PropertyInputContainer& inputs)
+{
+  current = inputs[0]->GetFloat() + 1.0f;
+}
+
+void HalfValue(float& current, const PropertyInputContainer& inputs)
+{
+  current = inputs[0]->GetFloat() * 0.5f + 2.0f;
+}
+
+void ScaleFromPositionX(Vector3& current, const PropertyInputContainer& inputs)
+{
+  const float scale = inputs[0]->GetFloat() * 0.01f;
+  current           = Vector3(scale, scale, 1.0f);
+}
+
+void DoubleScale(Vector3& current, const PropertyInputContainer& /* inputs */)
+{
+  current *= 2.0f;
+}
+
+void ColorFromWorldColor(Vector4& current, const PropertyInputContainer& inputs)
+{
+  current = inputs[0]->GetVector4() * 0.5f;
+}
+
+/**
+ * Constrains groups of actors and custom objects, then collects the constrained values over several frames.
+ * @param[in] workerThreadCount The number of update worker threads, or "0" to apply the constraints serially.
+ * @param[in] readWorldColor Whether some constraints read the world color, which the parallel update does not support.
+ * @return The constrained values of each frame.
+ */
+std::vector<float> ApplyGroupConstraints(const char* workerThreadCount, bool readWorldColor)
+{
+  setenv("DALI_UPDATE_WORKER_THREAD_COUNT", workerThreadCount, 1);
+  setenv("DALI_PARALLEL_CONSTRAINT_MINIMUM_COUNT", "16", 1);
+  TestApplication application;
+  unsetenv("DALI_UPDATE_WORKER_THREAD_COUNT");
+  unsetenv("DALI_PARALLEL_CONSTRAINT_MINIMUM_COUNT");
+
+  constexpr uint32_t GROUP_COUNT = 8u;
+  constexpr uint32_t ACTOR_COUNT = 8u;
+
+  Handle                       source      = Handle::New();
+  const Property::Index        sourceIndex = source.RegisterProperty("value", 0.0f);
+  Layer                        rootLayer   = application.GetScene().GetRootLayer();
+  std::vector<Handle>          objects;
+  std::vector<Property::Index> objectIndices;
+  std::vector<Actor>           groups;
+  std::vector<Actor>           actors;
+
+  for(uint32_t group = 0u; group < GROUP_COUNT; ++group)
+  {
+    Actor groupActor                         = Actor::New();
+    groupActor[Actor::Property::COLOR_ALPHA] = 0.5f;
+    application.GetScene().Add(groupActor);
+    groups.push_back(groupActor);
+
+    if(readWorldColor)
+    {
+      Constraint constraint = Constraint::New<Vector4>(groupActor, Actor::Property::COLOR, &ColorFromWorldColor);
+      constraint.AddSource(Source(rootLayer, Actor::Property::WORLD_COLOR));
+      constraint.Apply();
+    }
+
+    for(uint32_t i = 0u; i < ACTOR_COUNT; ++i)
+    {
+      Actor actor = Actor::New();
+      groupActor.Add(actor);
+
+      // Follow the previous actor of the group, which is constrained before
+      Constraint chain = Constraint::New<float>(actor, Actor::Property::POSITION_X, &ChainPositionX);
+      if(i == 0u)
+      {
+        chain.AddSource(Source(source, sourceIndex));
+      }
+      else
+      {
+        chain.AddSource(Source(actors.back(), Actor::Property::POSITION_X));
+      }
+      chain.Apply();
+      actors.push_back(actor);
+    }
+
+    // The objects are constrained after the actors
+    Handle object = Handle::New();
+    objectIndices.push_back(object.RegisterProperty("value", 0.0f));
+    Constraint objectConstraint = Constraint::New<float>(object, objectIndices.back(), &ChainPositionX);
+    objectConstraint.AddSource(Source(actors.back(), Actor::Property::POSITION_X));
+    objectConstraint.Apply();
+    objects.push_back(object);
+  }
+
+  const uint32_t totalActorCount = static_cast<uint32_t>(actors.size());
+  for(uint32_t i = 0u; i < totalActorCount; ++i)
+  {
+    Actor& actor = actors[i];
+
+    // Read the next actor, which is constrained after this one
+    Constraint half = Constraint::New<float>(actor, Actor::Property::SIZE_WIDTH, &HalfValue);
+    half.AddSource(Source(actors[(i + 1u) % totalActorCount], Actor::Property::SIZE_WIDTH));
+    half.Apply();
+
+    // Several constraints on the same property
+    Constraint scale = Constraint::New<Vector3>(actor, Actor::Property::SCALE, &ScaleFromPositionX);
+    scale.AddSource(LocalSource(Actor::Property::POSITION_X));
+    scale.Apply();
+    Constraint doubleScale = Constraint::New<Vector3>(actor, Actor::Property::SCALE, &DoubleScale);
+    doubleScale.Apply();
+
+    // Applied once only
+    Constraint once = Constraint::New<float>(actor, Actor::Property::POSITION_Z, &ChainPositionX);
+    once.AddSource(Source(source, sourceIndex));
+    once.SetApplyRate(Constraint::APPLY_ONCE);
+    once.Apply();
+  }
+
+  Animation animation = Animation::New(1.0f);
+  animation.AnimateTo(Property(source, sourceIndex), 100.0f);
+  animation.Play();
+
+  std::vector<float> values;
+  for(uint32_t frame = 0u; frame < 5u; ++frame)
+  {
+    application.SendNotification();
+    application.Render(100);
+
+    for(auto&& actor : actors)
+    {
+      const Vector3 position = actor.GetCurrentProperty<Vector3>(Actor::Property::POSITION);
+      const Vector3 size     = actor.GetCurrentProperty<Vector3>(Actor::Property::SIZE);
+      const Vector3 scale    = actor.GetCurrentProperty<Vector3>(Actor::Property::SCALE);
+      values.insert(values.end(), {position.x, position.z, size.width, scale.x, scale.y, scale.z});
+    }
+    for(auto&& group : groups)
+    {
+      values.push_back(group.GetCurrentProperty<Vector4>(Actor::Property::COLOR).a);
+    }
+    for(uint32_t i = 0u; i < GROUP_COUNT; ++i)
+    {
+      values.push_back(objects[i].GetCurrentProperty<float>(objectIndices[i]));
+    }
+  }
+
+  return values;
+}
+} // namespace
+
+int UtcDaliConstraintParallelApplyP(void)
+{
+  tet_infoline("Ensure the constraints applied by the update worker threads give the values of the serial application");
+
+  const std::vector<float> serialValues   = ApplyGroupConstraints("0", false);
+  const std::vector<float> parallelValues = ApplyGroupConstraints("2", false);
+
+  DALI_TEST_EQUALS(parallelValues.size(), serialValues.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(parallelValues == serialValues);
+
+  // The last frame: the chain of the first group follows the animated source
+  const uint32_t lastFrame = static_cast<uint32_t>(serialValues.size()) * 4u / 5u;
+  DALI_TEST_EQUALS(serialValues[lastFrame], 51.0f, 0.01f, TEST_LOCATION);       // The X of the first actor
+  DALI_TEST_EQUALS(serialValues[lastFrame + 1u], 11.0f, TEST_LOCATION);         // The Z, applied once at the first frame
+  DALI_TEST_EQUALS(serialValues[lastFrame + 3u], 1.02f, 0.001f, TEST_LOCATION); // The X scale, doubled
+  DALI_TEST_EQUALS(serialValues[lastFrame + 6u], 52.0f, 0.01f, TEST_LOCATION);  // The X of the second actor
+
+  END_TEST;
+}
+
+int UtcDaliConstraintParallelApplyReadingWorldColorP(void)
+{
+  tet_infoline("Ensure the constraints reading the world color are applied as the serial application");
+
+  const std::vector<float> serialValues   = ApplyGroupConstraints("0", true);
+  const std::vector<float> parallelValues = ApplyGroupConstraints("2", true);
+
+  DALI_TEST_EQUALS(parallelValues.size(), serialValues.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(parallelValues == serialValues);
+
+  END_TEST;
+}
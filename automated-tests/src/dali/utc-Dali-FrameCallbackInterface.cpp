@@ -568,6 +568,113 @@ public:
   bool           mPropertyRegistered;
 };
 
+class FrameCallbackActorSet : public FrameCallbackBasic
+{
+public:
+  FrameCallbackActorSet(const std::vector<uint32_t>& actorIds, bool bake)
+  : mActorIds(actorIds),
+    mBake(bake)
+  {
+  }
+
+  virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    FrameCallbackBasic::Update(updateProxy, elapsedSeconds);
+
+    // The set is created once and reused in every frame
+    if(mActorSet == UpdateProxy::INVALID_ACTOR_SET)
+    {
+      mActorSet = updateProxy.CreateActorSet(mActorIds.data(), static_cast<uint32_t>(mActorIds.size()));
+    }
+
+    const uint32_t count = static_cast<uint32_t>(mActorIds.size());
+    if(!mPositionsToSet.empty())
+    {
+      if(mBake)
+      {
+        mSetCount = updateProxy.BakePositions(mActorSet, mPositionsToSet.data());
+        updateProxy.BakeSizes(mActorSet, mSizesToSet.data());
+        updateProxy.BakeScales(mActorSet, mScalesToSet.data());
+        updateProxy.BakeColors(mActorSet, mColorsToSet.data());
+      }
+      else
+      {
+        mSetCount = updateProxy.SetPositions(mActorSet, mPositionsToSet.data());
+        updateProxy.SetSizes(mActorSet, mSizesToSet.data());
+        updateProxy.SetScales(mActorSet, mScalesToSet.data());
+        updateProxy.SetColors(mActorSet, mColorsToSet.data());
+      }
+    }
+
+    mPositions.assign(count, Vector3::ZERO);
+    mSizes.assign(count, Vector3::ZERO);
+    mScales.assign(count, Vector3::ZERO);
+    mColors.assign(count, Vector4::ZERO);
+    mWorldMatrices.assign(count, Matrix::IDENTITY);
+
+    mGetCount = updateProxy.GetPositions(mActorSet, mPositions.data());
+    updateProxy.GetSizes(mActorSet, mSizes.data());
+    updateProxy.GetScales(mActorSet, mScales.data());
+    updateProxy.GetColors(mActorSet, mColors.data());
+    updateProxy.GetWorldMatrices(mActorSet, mWorldMatrices.data());
+
+    return false;
+  }
+
+  const std::vector<uint32_t> mActorIds;
+  const bool                  mBake;
+  UpdateProxy::ActorSet       mActorSet{UpdateProxy::INVALID_ACTOR_SET};
+
+  std::vector<Vector3> mPositionsToSet;
+  std::vector<Vector3> mSizesToSet;
+  std::vector<Vector3> mScalesToSet;
+  std::vector<Vector4> mColorsToSet;
+
+  std::vector<Vector3> mPositions;
+  std::vector<Vector3> mSizes;
+  std::vector<Vector3> mScales;
+  std::vector<Vector4> mColors;
+  std::vector<Matrix>  mWorldMatrices;
+
+  uint32_t mSetCount{0u};
+  uint32_t mGetCount{0u};
+};
+
+class FrameCallbackActorSetRemoval : public FrameCallbackBasic
+{
+public:
+  FrameCallbackActorSetRemoval(uint32_t actorId)
+  : mActorId(actorId)
+  {
+  }
+
+  virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    FrameCallbackBasic::Update(updateProxy, elapsedSeconds);
+
+    Vector3 position;
+    mInvalidSetCount = updateProxy.GetPositions(UpdateProxy::INVALID_ACTOR_SET, &position);
+
+    UpdateProxy::ActorSet first = updateProxy.CreateActorSet(&mActorId, 1u);
+    mFirstCount                 = updateProxy.GetPositions(first, &position);
+    updateProxy.RemoveActorSet(first);
+    mRemovedSetCount = updateProxy.GetPositions(first, &position);
+
+    // The slot of the removed set is reused
+    UpdateProxy::ActorSet second = updateProxy.CreateActorSet(&mActorId, 1u);
+    mSetReused                   = (second == first);
+    updateProxy.RemoveActorSet(second);
+
+    return false;
+  }
+
+  const uint32_t mActorId;
+  uint32_t       mInvalidSetCount{1u};
+  uint32_t       mFirstCount{0u};
+  uint32_t       mRemovedSetCount{1u};
+  bool           mSetReused{false};
+};
+
 } // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1844,3 +1951,195 @@ int UtcDaliFrameCallbackCustomPropertyGetBake(void)
 
   END_TEST;
 }
+
+int UtcDaliFrameCallbackActorSetSetters(void)
+{
+  // Test to see that the bulk setters set the values of every actor of the set, for the current frame only
+
+  TestApplication application;
+
+  std::vector<Actor>    actors;
+  std::vector<uint32_t> actorIds;
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    actor.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+    actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+    actorIds.push_back(actor.GetProperty<int>(Actor::Property::ID));
+  }
+
+  FrameCallbackActorSet frameCallback(actorIds, false);
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    const float value = static_cast<float>(i + 1u);
+    frameCallback.mPositionsToSet.push_back(Vector3(value * 10.0f, value * 20.0f, 0.0f));
+    frameCallback.mSizesToSet.push_back(Vector3(value, value * 2.0f, value * 3.0f));
+    frameCallback.mScalesToSet.push_back(Vector3(value, value, 1.0f));
+    frameCallback.mColorsToSet.push_back(Vector4(value * 0.25f, 0.0f, 1.0f, 1.0f));
+  }
+  application.GetCore().AddFrameCallback(frameCallback, application.GetScene().GetRootLayer());
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(frameCallback.mCalled, true, TEST_LOCATION);
+  DALI_TEST_CHECK(frameCallback.mActorSet != UpdateProxy::INVALID_ACTOR_SET);
+  DALI_TEST_EQUALS(frameCallback.mSetCount, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mGetCount, 3u, TEST_LOCATION);
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    DALI_TEST_EQUALS(frameCallback.mPositions[i], frameCallback.mPositionsToSet[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(frameCallback.mSizes[i], frameCallback.mSizesToSet[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(frameCallback.mScales[i], frameCallback.mScalesToSet[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(frameCallback.mColors[i], frameCallback.mColorsToSet[i], TEST_LOCATION);
+  }
+
+  // The world matrices are those of the previous frame, as the callback is called before the transforms are updated
+  frameCallback.mPositionsToSet.clear();
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    DALI_TEST_EQUALS(frameCallback.mWorldMatrices[i], actors[i].GetCurrentProperty<Matrix>(Actor::Property::WORLD_MATRIX), TEST_LOCATION);
+  }
+
+  // Ensure the actual actor values haven't changed as we didn't bake the values
+  application.GetCore().RemoveFrameCallback(frameCallback);
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  for(auto&& actor : actors)
+  {
+    DALI_TEST_EQUALS(actor.GetCurrentProperty(Actor::Property::POSITION).Get<Vector3>(), Vector3::ZERO, TEST_LOCATION);
+    DALI_TEST_EQUALS(actor.GetCurrentProperty(Actor::Property::SIZE).Get<Vector3>(), Vector3(100.0f, 100.0f, 0.0f), TEST_LOCATION);
+    DALI_TEST_EQUALS(actor.GetCurrentProperty(Actor::Property::SCALE).Get<Vector3>(), Vector3::ONE, TEST_LOCATION);
+    DALI_TEST_EQUALS(actor.GetCurrentProperty(Actor::Property::COLOR).Get<Vector4>(), Color::WHITE, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliFrameCallbackActorSetBake(void)
+{
+  // Test to see that the bulk bake methods bake the values of every actor of the set
+
+  TestApplication application;
+
+  std::vector<Actor>    actors;
+  std::vector<uint32_t> actorIds;
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    Actor actor = Actor::New();
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+    actorIds.push_back(actor.GetProperty<int>(Actor::Property::ID));
+  }
+
+  FrameCallbackActorSet frameCallback(actorIds, true);
+  frameCallback.mPositionsToSet = {Vector3(1.0f, 2.0f, 3.0f), Vector3(4.0f, 5.0f, 6.0f)};
+  frameCallback.mSizesToSet     = {Vector3(10.0f, 20.0f, 0.0f), Vector3(30.0f, 40.0f, 0.0f)};
+  frameCallback.mScalesToSet    = {Vector3(2.0f, 2.0f, 2.0f), Vector3(3.0f, 3.0f, 3.0f)};
+  frameCallback.mColorsToSet    = {Color::RED, Color::BLUE};
+  application.GetCore().AddFrameCallback(frameCallback, application.GetScene().GetRootLayer());
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(frameCallback.mSetCount, 2u, TEST_LOCATION);
+
+  // Ensure the new values are saved after removing the callback
+  application.GetCore().RemoveFrameCallback(frameCallback);
+
+  application.SendNotification();
+  application.Render();
+
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty(Actor::Property::POSITION).Get<Vector3>(), frameCallback.mPositionsToSet[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty(Actor::Property::SIZE).Get<Vector3>(), frameCallback.mSizesToSet[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty(Actor::Property::SCALE).Get<Vector3>(), frameCallback.mScalesToSet[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(actors[i].GetCurrentProperty(Actor::Property::COLOR).Get<Vector4>(), frameCallback.mColorsToSet[i], TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliFrameCallbackActorSetActorRemovedAndAdded(void)
+{
+  // Test to ensure that the actors of a set are looked up again when the node hierarchy changes
+
+  TestApplication application;
+
+  Actor actor1 = Actor::New();
+  Actor actor2 = Actor::New();
+  actor1.SetProperty(Actor::Property::POSITION, Vector3(1.0f, 0.0f, 0.0f));
+  actor2.SetProperty(Actor::Property::POSITION, Vector3(2.0f, 0.0f, 0.0f));
+  application.GetScene().Add(actor1);
+  application.GetScene().Add(actor2);
+
+  // An invalid actor ID is ignored
+  std::vector<uint32_t> actorIds = {static_cast<uint32_t>(actor1.GetProperty<int>(Actor::Property::ID)), 99999u, static_cast<uint32_t>(actor2.GetProperty<int>(Actor::Property::ID))};
+
+  FrameCallbackActorSet frameCallback(actorIds, false);
+  application.GetCore().AddFrameCallback(frameCallback, application.GetScene().GetRootLayer());
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(frameCallback.mGetCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mPositions[0], Vector3(1.0f, 0.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mPositions[1], Vector3::ZERO, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mPositions[2], Vector3(2.0f, 0.0f, 0.0f), TEST_LOCATION);
+
+  application.GetScene().Remove(actor1);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(frameCallback.mGetCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mPositions[0], Vector3::ZERO, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mPositions[2], Vector3(2.0f, 0.0f, 0.0f), TEST_LOCATION);
+
+  application.GetScene().Add(actor1);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(frameCallback.mGetCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mPositions[0], Vector3(1.0f, 0.0f, 0.0f), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameCallbackActorSetRemove(void)
+{
+  // Test to see that removed and invalid sets are ignored
+
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  FrameCallbackActorSetRemoval frameCallback(actor.GetProperty<int>(Actor::Property::ID));
+  application.GetCore().AddFrameCallback(frameCallback, application.GetScene().GetRootLayer());
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(frameCallback.mCalled, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mInvalidSetCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mFirstCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mRemovedSetCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(frameCallback.mSetReused, true, TEST_LOCATION);
+
+  END_TEST;
+}
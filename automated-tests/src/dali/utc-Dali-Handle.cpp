@@ -23,6 +23,7 @@
 #include <mesh-builder.h>
 #include <stdlib.h>
 
+#include <chrono>
 #include <iostream>
 #include <typeinfo>
 
@@ -317,6 +318,97 @@ int UtcDaliHandleGetPropertyIndex03(void)
   END_TEST;
 }
 
+int UtcDaliHandleGetPropertyIndex04(void)
+{
+  tet_infoline("Positive Test Dali::Handle::GetPropertyIndex() with many custom properties");
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  application.GetScene().Add(actor);
+
+  // Enough properties for the lookup to be hashed, registered in several batches between lookups
+  std::vector<Property::Index> indices;
+  for(int i = 0; i < 40; ++i)
+  {
+    const std::string name = "manyProperty" + std::to_string(i);
+    if(i % 2 == 0)
+    {
+      indices.push_back(actor.RegisterProperty(CORE_PROPERTY_MAX_INDEX + 1 + i, String(name.c_str()), static_cast<float>(i)));
+    }
+    else
+    {
+      indices.push_back(actor.RegisterProperty(String(name.c_str()), static_cast<float>(i), Property::READ_WRITE));
+    }
+
+    if(i % 10 == 9)
+    {
+      DALI_TEST_EQUALS(actor.GetPropertyIndex(String(name.c_str())), indices.back(), TEST_LOCATION);
+      DALI_TEST_EQUALS(actor.GetPropertyIndex("notRegistered"), Property::INVALID_INDEX, TEST_LOCATION);
+    }
+  }
+
+  for(int i = 0; i < 40; ++i)
+  {
+    const std::string name = "manyProperty" + std::to_string(i);
+    DALI_TEST_EQUALS(actor.GetPropertyIndex(String(name.c_str())), indices[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(actor.GetProperty<float>(indices[i]), static_cast<float>(i), TEST_LOCATION);
+    if(i % 2 == 0)
+    {
+      DALI_TEST_EQUALS(actor.GetPropertyIndex(CORE_PROPERTY_MAX_INDEX + 1 + i), indices[i], TEST_LOCATION);
+    }
+  }
+  DALI_TEST_EQUALS(actor.GetPropertyIndex(CORE_PROPERTY_MAX_INDEX + 100), Property::INVALID_INDEX, TEST_LOCATION);
+
+  // Registering an existing name just sets the value
+  DALI_TEST_EQUALS(actor.RegisterProperty("manyProperty7", 70.0f), indices[7], TEST_LOCATION);
+  DALI_TEST_EQUALS(actor.GetProperty<float>(indices[7]), 70.0f, TEST_LOCATION);
+
+  // The properties can still be animated
+  Animation animation = Animation::New(1.0f);
+  animation.AnimateTo(Property(actor, indices[38]), 100.0f);
+  animation.Play();
+  application.SendNotification();
+  application.Render(1100);
+  DALI_TEST_EQUALS(actor.GetCurrentProperty<float>(indices[38]), 100.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliHandleGetPropertyIndexPerformance(void)
+{
+  tet_infoline("Measure Dali::Handle::GetPropertyIndex() by name on handles with many custom properties");
+  TestApplication application;
+
+  using Clock = std::chrono::steady_clock;
+
+  for(int propertyCount : {4, 16, 64})
+  {
+    Actor                      actor = Actor::New();
+    std::vector<Property::Key> keys;
+    for(int i = 0; i < propertyCount; ++i)
+    {
+      const std::string name = "benchmarkProperty" + std::to_string(i);
+      keys.emplace_back(String(name.c_str()));
+      actor.RegisterProperty(String(name.c_str()), static_cast<float>(i));
+    }
+
+    // Look the names up from the last registered, which is the worst case of a linear search
+    constexpr int LOOKUP_COUNT = 100000;
+    Property::Index sum        = 0;
+    const auto      start      = Clock::now();
+    for(int i = 0; i < LOOKUP_COUNT; ++i)
+    {
+      sum += actor.GetPropertyIndex(keys[propertyCount - 1 - (i % propertyCount)]);
+    }
+    const auto time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    tet_printf("%d custom properties : %d lookups in %lld us\n", propertyCount, LOOKUP_COUNT, static_cast<long long>(time));
+
+    DALI_TEST_CHECK(sum > 0);
+  }
+
+  END_TEST;
+}
+
 int UtcDaliHandleIsPropertyWritable(void)
 {
   tet_infoline("Positive Test Dali::Handle::IsPropertyWritable()");
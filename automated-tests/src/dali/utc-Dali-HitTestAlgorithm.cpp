@@ -24,7 +24,10 @@
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <sstream>
 
 using namespace Dali;
 
@@ -1934,3 +1937,334 @@ int UtcDaliHitTestAlgorithmFboFallbackNestedCase(void)
   tet_printf("Hit actor (child sensitive): %s\n", results.actor ? results.actor.GetProperty<String>(Actor::Property::NAME).CStr() : "NULL");
   END_TEST;
 }
+
+namespace
+{
+bool IsVisibleFunction(Dali::Actor actor, Dali::HitTestAlgorithm::TraverseType type)
+{
+  return actor.GetCurrentProperty<bool>(Actor::Property::VISIBLE);
+}
+
+Actor CreateTopLeftActor(Actor parent, const Vector3& size, const Vector3& position, std::vector<Actor>& actors)
+{
+  Actor actor = Actor::New();
+  actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  actor.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  actor.SetProperty(Actor::Property::SIZE, size);
+  actor.SetProperty(Actor::Property::POSITION, position);
+  parent.Add(actor);
+  actors.push_back(actor);
+  return actor;
+}
+
+/**
+ * Hit-tests a lattice of points and returns the hit actors and coordinates.
+ */
+std::string HitTestLattice(TestApplication& application, const std::vector<Actor>& actors, Integration::Scene::TouchPropagationType propagationType, float step)
+{
+  std::ostringstream stream;
+  const Vector2      sceneSize = application.GetScene().GetSize();
+  for(float y = 0.0f; y <= sceneSize.height; y += step)
+  {
+    for(float x = 0.0f; x <= sceneSize.width; x += step)
+    {
+      HitTestAlgorithm::Results results;
+      HitTest(application.GetScene(), Vector2(x, y), results, &IsVisibleFunction, propagationType);
+
+      const auto iter = std::find(actors.begin(), actors.end(), results.actor);
+      stream << x << "," << y << ":" << (iter == actors.end() ? -1 : static_cast<int>(iter - actors.begin()));
+      if(results.actor)
+      {
+        stream << "(" << results.actorCoordinates.x << "," << results.actorCoordinates.y << ")";
+      }
+      stream << "\n";
+    }
+  }
+  return stream.str();
+}
+
+/**
+ * Builds a scene with a list, a clipping actor and a 3D layer, hit-tests it, changes it and hit-tests it again.
+ */
+std::string HitTestIndexScene(const char* minimumActorCount, Integration::Scene::TouchPropagationType propagationType)
+{
+  setenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT", minimumActorCount, 1);
+
+  TestApplication    application;
+  std::vector<Actor> actors;
+  Actor              root = application.GetScene().GetRootLayer();
+
+  // A list of items, some rotated, scaled, with a touch margin, a depth index or a child out of their bounds
+  Actor list = CreateTopLeftActor(root, Vector3(480.0f, 800.0f, 0.0f), Vector3::ZERO, actors);
+  for(int i = 0; i < 800; ++i)
+  {
+    Actor item = CreateTopLeftActor(list, Vector3(20.0f, 16.0f, 0.0f), Vector3(static_cast<float>(i % 20) * 24.0f, static_cast<float>(i / 20) * 20.0f, 0.0f), actors);
+    if(i % 7 == 0)
+    {
+      item.SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(Degree(30.0f)), Vector3::ZAXIS));
+    }
+    if(i % 11 == 0)
+    {
+      item.SetProperty(Actor::Property::SCALE, Vector3(1.5f, 1.5f, 1.0f));
+    }
+    if(i % 13 == 0)
+    {
+      item.SetProperty(Actor::Property::TOUCH_HIT_AREA_MARGIN, Extents(4, 4, 4, 4));
+    }
+    if(i % 17 == 0)
+    {
+      item.SetProperty(Actor::Property::DEPTH_INDEX, 5);
+    }
+    if(i % 19 == 0)
+    {
+      CreateTopLeftActor(item, Vector3(10.0f, 10.0f, 0.0f), Vector3(30.0f, 5.0f, 0.0f), actors);
+    }
+  }
+
+  // Children clipped by their parent
+  Actor clip = CreateTopLeftActor(root, Vector3(100.0f, 100.0f, 0.0f), Vector3(200.0f, 300.0f, 0.0f), actors);
+  clip.SetProperty(Actor::Property::CLIPPING_MODE, ClippingMode::CLIP_CHILDREN);
+  for(int i = 0; i < 40; ++i)
+  {
+    CreateTopLeftActor(clip, Vector3(60.0f, 60.0f, 0.0f), Vector3(static_cast<float>(i % 8) * 20.0f - 40.0f, static_cast<float>(i / 8) * 20.0f - 20.0f, 0.0f), actors);
+  }
+
+  // Boxes in a 3D layer
+  Layer layer3D = Layer::New();
+  layer3D.SetProperty(Layer::Property::BEHAVIOR, Layer::Behavior::LAYER_3D);
+  layer3D.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  layer3D.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  layer3D.SetProperty(Actor::Property::SIZE, Vector2(480.0f, 800.0f));
+  layer3D.SetProperty(Actor::Property::POSITION, Vector2(0.0f, 400.0f));
+  root.Add(layer3D);
+  actors.push_back(layer3D);
+  for(int i = 0; i < 70; ++i)
+  {
+    Actor box = CreateTopLeftActor(layer3D, Vector3(30.0f, 30.0f, 30.0f), Vector3(static_cast<float>(i % 10) * 45.0f, static_cast<float>(i / 10) * 45.0f, static_cast<float>(i % 3) * 20.0f), actors);
+    box.SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(Degree(40.0f)), Vector3(1.0f, 1.0f, 0.0f)));
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  std::string result = HitTestLattice(application, actors, propagationType, 8.0f);
+
+  // Move, add, reorder and remove actors, and change a touch margin
+  actors[25].SetProperty(Actor::Property::POSITION, Vector2(300.0f, 600.0f));
+  actors[40].SetProperty(Actor::Property::DEPTH_INDEX, 10);
+  actors[60].SetProperty(Actor::Property::TOUCH_HIT_AREA_MARGIN, Extents(20, 20, 20, 20));
+  actors[80].Unparent();
+  actors[100].RaiseToTop();
+  CreateTopLeftActor(list, Vector3(100.0f, 100.0f, 0.0f), Vector3(50.0f, 50.0f, 0.0f), actors);
+  layer3D.SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(Degree(10.0f)), Vector3::YAXIS));
+
+  application.SendNotification();
+  application.Render();
+
+  result += HitTestLattice(application, actors, propagationType, 8.0f);
+
+  unsetenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT");
+  return result;
+}
+
+} // namespace
+
+int UtcDaliHitTestAlgorithmIndexP(void)
+{
+  tet_infoline("Test the hit-test results are the same with and without the hit-test index");
+
+  const std::string walkResults  = HitTestIndexScene("0", Integration::Scene::TouchPropagationType::PARENT);
+  const std::string indexResults = HitTestIndexScene("1", Integration::Scene::TouchPropagationType::PARENT);
+
+  DALI_TEST_CHECK(walkResults.find(":1(") != std::string::npos); // The first item
+  DALI_TEST_EQUALS(indexResults, walkResults, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliHitTestAlgorithmIndexGeometryP(void)
+{
+  tet_infoline("Test the geometry hit-test results are the same with and without the hit-test index");
+
+  const std::string walkResults  = HitTestIndexScene("0", Integration::Scene::TouchPropagationType::GEOMETRY);
+  const std::string indexResults = HitTestIndexScene("1", Integration::Scene::TouchPropagationType::GEOMETRY);
+
+  DALI_TEST_EQUALS(indexResults, walkResults, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliHitTestAlgorithmIndexUpdateP(void)
+{
+  tet_infoline("Test the hit-test index is rebuilt when an actor moves, or is added or removed");
+
+  setenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT", "1", 1);
+
+  TestApplication    application;
+  std::vector<Actor> actors;
+  Actor              root = application.GetScene().GetRootLayer();
+  Actor              list = CreateTopLeftActor(root, Vector3(480.0f, 800.0f, 0.0f), Vector3::ZERO, actors);
+  for(int i = 0; i < 100; ++i)
+  {
+    CreateTopLeftActor(list, Vector3(40.0f, 40.0f, 0.0f), Vector3(static_cast<float>(i % 10) * 48.0f, static_cast<float>(i / 10) * 48.0f, 0.0f), actors);
+  }
+  application.SendNotification();
+  application.Render();
+
+  HitTestAlgorithm::Results results;
+  HitTest(application.GetScene(), Vector2(10.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == actors[1]);
+
+  // Moved by the update
+  actors[1].SetProperty(Actor::Property::POSITION, Vector2(200.0f, 600.0f));
+  application.SendNotification();
+  application.Render();
+
+  HitTest(application.GetScene(), Vector2(10.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == list);
+  HitTest(application.GetScene(), Vector2(210.0f, 610.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == actors[1]);
+
+  // Added and removed on the event side
+  Actor added = CreateTopLeftActor(list, Vector3(40.0f, 40.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f), actors);
+  application.SendNotification();
+  application.Render();
+  HitTest(application.GetScene(), Vector2(10.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == added);
+
+  added.Unparent();
+  HitTest(application.GetScene(), Vector2(10.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == list);
+
+  // The touch margin
+  HitTest(application.GetScene(), Vector2(44.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == list);
+  actors[2].SetProperty(Actor::Property::TOUCH_HIT_AREA_MARGIN, Extents(10, 10, 10, 10));
+  HitTest(application.GetScene(), Vector2(44.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == actors[2]);
+
+  unsetenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT");
+  END_TEST;
+}
+
+int UtcDaliHitTestAlgorithmIndexLayerUpdateP(void)
+{
+  tet_infoline("Test the hit-test index of a layer is rebuilt when its actors move, but not when the actors of another layer move");
+
+  setenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT", "1", 1);
+
+  TestApplication    application;
+  std::vector<Actor> actors;
+  Actor              root = application.GetScene().GetRootLayer();
+  Actor              list = CreateTopLeftActor(root, Vector3(480.0f, 400.0f, 0.0f), Vector3::ZERO, actors);
+  for(int i = 0; i < 50; ++i)
+  {
+    CreateTopLeftActor(list, Vector3(40.0f, 40.0f, 0.0f), Vector3(static_cast<float>(i % 10) * 48.0f, static_cast<float>(i / 10) * 48.0f, 0.0f), actors);
+  }
+
+  Layer layer = Layer::New();
+  layer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  layer.SetProperty(Actor::Property::PIVOT, Pivot::TOP_LEFT);
+  layer.SetProperty(Actor::Property::SIZE, Vector2(480.0f, 400.0f));
+  layer.SetProperty(Actor::Property::POSITION, Vector2(0.0f, 400.0f));
+  root.Add(layer);
+  Actor moving = CreateTopLeftActor(layer, Vector3(40.0f, 40.0f, 0.0f), Vector3::ZERO, actors);
+  application.SendNotification();
+  application.Render();
+
+  HitTestAlgorithm::Results results;
+  HitTest(application.GetScene(), Vector2(10.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == actors[1]);
+  HitTest(application.GetScene(), Vector2(10.0f, 410.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == moving);
+
+  // Moving an actor of the other layer every frame
+  for(int frame = 1; frame <= 4; ++frame)
+  {
+    moving.SetProperty(Actor::Property::POSITION, Vector2(static_cast<float>(frame) * 48.0f, 0.0f));
+    application.SendNotification();
+    application.Render();
+
+    HitTest(application.GetScene(), Vector2(static_cast<float>(frame) * 48.0f + 10.0f, 410.0f), results, &IsVisibleFunction);
+    DALI_TEST_CHECK(results.actor == moving);
+    HitTest(application.GetScene(), Vector2(static_cast<float>(frame) * 48.0f + 10.0f, 10.0f), results, &IsVisibleFunction);
+    DALI_TEST_CHECK(results.actor == actors[frame + 1]);
+  }
+
+  // Moving an actor of the root layer
+  actors[1].SetProperty(Actor::Property::POSITION, Vector2(200.0f, 300.0f));
+  application.SendNotification();
+  application.Render();
+  HitTest(application.GetScene(), Vector2(10.0f, 10.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == list);
+  HitTest(application.GetScene(), Vector2(210.0f, 310.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == actors[1]);
+
+  // Moving the layer moves its actors
+  layer.SetProperty(Actor::Property::POSITION, Vector2(0.0f, 500.0f));
+  application.SendNotification();
+  application.Render();
+  HitTest(application.GetScene(), Vector2(4.0f * 48.0f + 10.0f, 410.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor != moving);
+  HitTest(application.GetScene(), Vector2(4.0f * 48.0f + 10.0f, 510.0f), results, &IsVisibleFunction);
+  DALI_TEST_CHECK(results.actor == moving);
+
+  unsetenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT");
+  END_TEST;
+}
+
+namespace
+{
+/**
+ * Hit-tests a layer of 10000 actors at pseudo-random points.
+ */
+std::string HitTestManyActors(const char* minimumActorCount, std::chrono::microseconds& duration)
+{
+  setenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT", minimumActorCount, 1);
+
+  TestApplication    application;
+  std::vector<Actor> actors;
+  Actor              root = application.GetScene().GetRootLayer();
+  Actor              list = CreateTopLeftActor(root, Vector3(480.0f, 800.0f, 0.0f), Vector3::ZERO, actors);
+  for(int i = 0; i < 10000; ++i)
+  {
+    CreateTopLeftActor(list, Vector3(4.0f, 7.0f, 0.0f), Vector3(static_cast<float>(i % 100) * 4.8f, static_cast<float>(i / 100) * 8.0f, 0.0f), actors);
+  }
+  application.SendNotification();
+  application.Render();
+
+  std::ostringstream stream;
+  uint32_t           seed  = 1u;
+  const auto         start = std::chrono::steady_clock::now();
+  for(int i = 0; i < 200; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    const Vector2 point(static_cast<float>(seed % 4800u) * 0.1f, static_cast<float>((seed >> 12) % 8000u) * 0.1f);
+
+    HitTestAlgorithm::Results results;
+    HitTest(application.GetScene(), point, results, &IsVisibleFunction);
+    const auto iter = std::find(actors.begin(), actors.end(), results.actor);
+    stream << (iter == actors.end() ? -1 : static_cast<int>(iter - actors.begin())) << " ";
+  }
+  duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+  unsetenv("DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT");
+  return stream.str();
+}
+
+} // namespace
+
+int UtcDaliHitTestAlgorithmIndexManyActorsP(void)
+{
+  tet_infoline("Test hit-testing a layer of 10000 actors with and without the hit-test index");
+
+  std::chrono::microseconds walkDuration, indexDuration;
+  const std::string         walkResults  = HitTestManyActors("0", walkDuration);
+  const std::string         indexResults = HitTestManyActors("1", indexDuration);
+
+  tet_printf("200 hit-tests of 10000 actors: %lld us walking the layer, %lld us with the index\n", static_cast<long long>(walkDuration.count()), static_cast<long long>(indexDuration.count()));
+
+  DALI_TEST_EQUALS(indexResults, walkResults, TEST_LOCATION);
+
+  END_TEST;
+}
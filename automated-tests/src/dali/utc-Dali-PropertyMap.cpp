@@ -20,8 +20,10 @@
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
 
+#include <chrono>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace Dali;
 
@@ -982,7 +984,7 @@ int UtcDaliPropertyMapGetHashP02(void)
 {
   tet_infoline("Check Property::Map::GetHash() if value is Map or Array.");
 
-  Property::Map   map;
+  Property::Map map;
   Property::Array subArray;
   Property::Map   subMap;
 
@@ -1165,3 +1167,136 @@ int UtcDaliPropertyMapEqualFloatType(void)
 
   END_TEST;
 }
+
+int UtcDaliPropertyMapLargeMapP(void)
+{
+  tet_infoline("Check the lookups of a map with enough keys to be indexed");
+
+  constexpr int   COUNT = 64;
+  Property::Map map;
+  for(int i = 0; i < COUNT; ++i)
+  {
+    map.Insert(("key" + std::to_string(i)).c_str(), i);
+    map.Insert(i * 10, static_cast<float>(i));
+  }
+  DALI_TEST_EQUALS(map.Count(), static_cast<Property::Map::SizeType>(COUNT * 2), TEST_LOCATION);
+
+  for(int i = 0; i < COUNT; ++i)
+  {
+    const std::string key = "key" + std::to_string(i);
+    DALI_TEST_CHECK(map.Find(key.c_str()));
+    DALI_TEST_EQUALS(map.Find(key.c_str())->Get<int>(), i, TEST_LOCATION);
+    DALI_TEST_CHECK(map.Find(i * 10));
+    DALI_TEST_EQUALS(map.Find(i * 10)->Get<float>(), static_cast<float>(i), TEST_LOCATION);
+  }
+  DALI_TEST_CHECK(!map.Find("key64"));
+  DALI_TEST_CHECK(!map.Find(5));
+  DALI_TEST_CHECK(map.Find("key3", Property::INTEGER));
+  DALI_TEST_CHECK(!map.Find("key3", Property::FLOAT));
+  DALI_TEST_CHECK(map.Find(30, Property::FLOAT));
+  DALI_TEST_CHECK(!map.Find(30, Property::INTEGER));
+
+  tet_printf("Check the keys inserted after the first lookup are found, and the first of duplicated keys is returned\n");
+  map.Insert("key3", "duplicate");
+  map.Insert(30, "duplicate");
+  map["newKey"] = 100;
+  map[5]        = 200;
+  DALI_TEST_EQUALS(map.Find("key3")->Get<int>(), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS("duplicate", map.Find("key3", Property::STRING)->Get<String>(), TEST_LOCATION);
+  DALI_TEST_EQUALS(map.Find(30)->Get<float>(), 3.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS("duplicate", map.Find(30, Property::STRING)->Get<String>(), TEST_LOCATION);
+  DALI_TEST_EQUALS(map.Find("newKey")->Get<int>(), 100, TEST_LOCATION);
+  DALI_TEST_EQUALS(map.Find(5)->Get<int>(), 200, TEST_LOCATION);
+  DALI_TEST_EQUALS(map.Count(), static_cast<Property::Map::SizeType>(COUNT * 2 + 4), TEST_LOCATION);
+
+  tet_printf("Check the insertion order is kept\n");
+  DALI_TEST_EQUALS("key0", map.GetKeyAt(0).stringKey, TEST_LOCATION);
+  DALI_TEST_EQUALS("key3", map.GetKeyAt(COUNT).stringKey, TEST_LOCATION);
+  DALI_TEST_EQUALS("newKey", map.GetKeyAt(COUNT + 1).stringKey, TEST_LOCATION);
+
+  tet_printf("Check the lookups after removing keys\n");
+  DALI_TEST_CHECK(map.Remove("key3"));
+  DALI_TEST_EQUALS("duplicate", map.Find("key3")->Get<String>(), TEST_LOCATION);
+  DALI_TEST_CHECK(map.Remove("key3"));
+  DALI_TEST_CHECK(!map.Find("key3"));
+  DALI_TEST_EQUALS(map.Find("key4")->Get<int>(), 4, TEST_LOCATION);
+  DALI_TEST_CHECK(map.Remove(30));
+  DALI_TEST_EQUALS("duplicate", map.Find(30)->Get<String>(), TEST_LOCATION);
+  DALI_TEST_EQUALS(map.Find(40)->Get<float>(), 4.0f, TEST_LOCATION);
+
+  tet_printf("Check the lookups of copied and assigned maps\n");
+  const Property::Map copy(map);
+  DALI_TEST_EQUALS(copy["key10"].Get<int>(), 10, TEST_LOCATION);
+  DALI_TEST_EQUALS(copy[100].Get<float>(), 10.0f, TEST_LOCATION);
+
+  Property::Map assigned;
+  for(int i = 0; i < COUNT; ++i)
+  {
+    assigned[("other" + std::to_string(i)).c_str()] = i;
+  }
+  DALI_TEST_CHECK(assigned.Find("other1"));
+  assigned = copy;
+  DALI_TEST_CHECK(!assigned.Find("other1"));
+  DALI_TEST_EQUALS(assigned.Find("key10")->Get<int>(), 10, TEST_LOCATION);
+  DALI_TEST_CHECK(assigned == copy);
+
+  Property::Map merged;
+  merged.Insert("key10", "merged");
+  merged.Merge(copy);
+  DALI_TEST_EQUALS(merged.Count(), copy.Count(), TEST_LOCATION);
+  DALI_TEST_EQUALS(merged.Find("key10")->Get<int>(), 10, TEST_LOCATION);
+
+  map.Clear();
+  DALI_TEST_CHECK(!map.Find("key4"));
+  DALI_TEST_CHECK(!map.Find(40));
+  for(int i = 0; i < COUNT; ++i)
+  {
+    map.Insert(("key" + std::to_string(i)).c_str(), -i);
+  }
+  DALI_TEST_EQUALS(map.Find("key4")->Get<int>(), -4, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPropertyMapLookupPerformance(void)
+{
+  tet_infoline("Measure the construction and lookup of style-like maps of several sizes");
+
+  for(const int count : {8, 32, 128})
+  {
+    std::vector<std::string> keys;
+    for(int i = 0; i < count; ++i)
+    {
+      keys.push_back("styleProperty" + std::to_string(i));
+    }
+
+    constexpr int MAP_COUNT = 1000;
+
+    int  found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(int m = 0; m < MAP_COUNT; ++m)
+    {
+      // Build a map, then look each key up a few times as controls do when they are created
+      Property::Map map;
+      for(int i = 0; i < count; ++i)
+      {
+        map.Insert(keys[i].c_str(), i);
+        map.Insert(i, i);
+      }
+      for(int repeat = 0; repeat < 4; ++repeat)
+      {
+        for(int i = 0; i < count; ++i)
+        {
+          found += map.Find(keys[i].c_str()) ? 1 : 0;
+          found += map.Find(i) ? 1 : 0;
+        }
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    DALI_TEST_EQUALS(found, MAP_COUNT * count * 8, TEST_LOCATION);
+    tet_printf("%d maps with %d string and %d index keys : %lld us\n", MAP_COUNT, count, count, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+  }
+
+  END_TEST;
+}
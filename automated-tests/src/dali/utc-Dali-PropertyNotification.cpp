@@ -20,6 +20,8 @@
 #include <stdlib.h>
 
 #include <iostream>
+#include <map>
+#include <vector>
 
 using namespace Dali;
 
@@ -1260,6 +1262,213 @@ int UtcDaliPropertyNotificationOrder(void)
   END_TEST;
 }
 
+namespace
+{
+class NotifyCounter : public ConnectionTracker
+{
+public:
+  void Watch(PropertyNotification& notification)
+  {
+    notification.SetNotifyMode(PropertyNotification::NOTIFY_ON_CHANGED);
+    notification.NotifySignal().Connect(this, &NotifyCounter::OnNotify);
+  }
+
+  void OnNotify(PropertyNotification source)
+  {
+    ++mCounts[source.GetObjectPtr()];
+    mOrder.push_back(source.GetObjectPtr());
+  }
+
+  int Take(PropertyNotification& notification)
+  {
+    int count = mCounts[notification.GetObjectPtr()];
+    mCounts[notification.GetObjectPtr()] = 0;
+    return count;
+  }
+
+  std::map<const RefObject*, int> mCounts;
+  std::vector<const RefObject*>   mOrder; ///< The notified objects, in emission order
+};
+
+} // unnamed namespace
+
+int UtcDaliPropertyNotificationSharedPropertyP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that the notifications of a property are only notified when it changes");
+
+  Actor           actor1  = Actor::New();
+  Actor           actor2  = Actor::New();
+  Property::Index scroll1 = actor1.RegisterProperty("scroll", 0.0f);
+  Property::Index scroll2 = actor2.RegisterProperty("scroll", 0.0f);
+  application.GetScene().Add(actor1);
+  application.GetScene().Add(actor2);
+
+  // Interleave the notifications of the two properties
+  NotifyCounter        counter;
+  PropertyNotification inside  = actor1.AddPropertyNotification(scroll1, InsideCondition(5.0f, 15.0f));
+  PropertyNotification other   = actor2.AddPropertyNotification(scroll2, GreaterThanCondition(5.0f));
+  PropertyNotification outside = actor1.AddPropertyNotification(scroll1, OutsideCondition(5.0f, 15.0f));
+  PropertyNotification greater = actor1.AddPropertyNotification(scroll1, GreaterThanCondition(20.0f));
+  counter.Watch(inside);
+  counter.Watch(other);
+  counter.Watch(outside);
+  counter.Watch(greater);
+
+  // The first check notifies the initial validity
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(inside), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(other), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(outside), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(greater), 0, TEST_LOCATION);
+
+  actor1.SetProperty(scroll1, 10.0f);
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(inside), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(other), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(outside), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(greater), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(inside.GetNotifyResult(), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(outside.GetNotifyResult(), false, TEST_LOCATION);
+
+  actor2.SetProperty(scroll2, 10.0f);
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(inside), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(other), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(outside), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(greater), 0, TEST_LOCATION);
+
+  Animation animation = Animation::New(0.1f);
+  animation.AnimateTo(Property(actor1, scroll1), 30.0f, AlphaFunction::LINEAR);
+  animation.Play();
+  Wait(application, 500);
+  DALI_TEST_EQUALS(counter.Take(inside), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(other), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(outside), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(greater), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(greater.GetNotifyResult(), true, TEST_LOCATION);
+
+  // Removing a notification keeps the others of the property working
+  actor1.RemovePropertyNotification(outside);
+  actor1.SetProperty(scroll1, 10.0f);
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(inside), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(other), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(counter.Take(greater), 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPropertyNotificationRegistrationOrderP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that the notifications of different properties are emitted in registration order");
+
+  Actor           actor1  = Actor::New();
+  Actor           actor2  = Actor::New();
+  Property::Index scroll1 = actor1.RegisterProperty("scroll", 0.0f);
+  Property::Index scroll2 = actor2.RegisterProperty("scroll", 0.0f);
+  application.GetScene().Add(actor1);
+  application.GetScene().Add(actor2);
+
+  // Interleave the notifications of the two properties
+  NotifyCounter        counter;
+  PropertyNotification first  = actor1.AddPropertyNotification(scroll1, GreaterThanCondition(5.0f));
+  PropertyNotification second = actor2.AddPropertyNotification(scroll2, GreaterThanCondition(5.0f));
+  PropertyNotification third  = actor1.AddPropertyNotification(scroll1, LessThanCondition(20.0f));
+  PropertyNotification fourth = actor2.AddPropertyNotification(scroll2, LessThanCondition(20.0f));
+  counter.Watch(first);
+  counter.Watch(second);
+  counter.Watch(third);
+  counter.Watch(fourth);
+
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  counter.mOrder.clear();
+
+  // The first three change their validity in the same frame
+  actor1.SetProperty(scroll1, 30.0f);
+  actor2.SetProperty(scroll2, 10.0f);
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.mOrder.size(), 3u, TEST_LOCATION);
+  DALI_TEST_CHECK(counter.mOrder[0] == first.GetObjectPtr());
+  DALI_TEST_CHECK(counter.mOrder[1] == second.GetObjectPtr());
+  DALI_TEST_CHECK(counter.mOrder[2] == third.GetObjectPtr());
+
+  END_TEST;
+}
+
+int UtcDaliPropertyNotificationStepUnchangedPropertyP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that a crossed step becomes invalid once the property stops changing");
+
+  Actor           actor  = Actor::New();
+  Property::Index scroll = actor.RegisterProperty("scroll", 0.0f);
+  application.GetScene().Add(actor);
+
+  NotifyCounter        counter;
+  PropertyNotification notification = actor.AddPropertyNotification(scroll, StepCondition(10.0f, 0.0f));
+  counter.Watch(notification);
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  counter.Take(notification);
+
+  // The animation bakes its final value, so the property is clean in the following frames
+  Animation animation = Animation::New(0.0f);
+  animation.AnimateTo(Property(actor, scroll), 25.0f);
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(RENDER_FRAME_INTERVAL);
+  application.SendNotification();
+  DALI_TEST_EQUALS(counter.Take(notification), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(notification.GetNotifyResult(), true, TEST_LOCATION);
+
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(notification), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(notification.GetNotifyResult(), false, TEST_LOCATION);
+
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(notification), 0, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPropertyNotificationWorldPositionP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that a world position notification follows the changes of the parent");
+
+  Actor parent = Actor::New();
+  Actor child  = Actor::New();
+  Actor other  = Actor::New();
+  parent.Add(child);
+  application.GetScene().Add(parent);
+  application.GetScene().Add(other);
+
+  NotifyCounter        counter;
+  PropertyNotification notification = child.AddPropertyNotification(Actor::Property::WORLD_POSITION_X, GreaterThanCondition(100.0f));
+  counter.Watch(notification);
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(notification), 0, TEST_LOCATION);
+
+  parent.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  parent.SetProperty(Actor::Property::POSITION, Vector3(200.0f, 0.0f, 0.0f));
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(notification), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(notification.GetNotifyResult(), true, TEST_LOCATION);
+
+  other.SetProperty(Actor::Property::POSITION, Vector3(300.0f, 0.0f, 0.0f));
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(notification), 0, TEST_LOCATION);
+
+  child.SetProperty(Actor::Property::POSITION, Vector3(-150.0f, 0.0f, 0.0f));
+  Wait(application, DEFAULT_WAIT_PERIOD);
+  DALI_TEST_EQUALS(counter.Take(notification), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(notification.GetNotifyResult(), false, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliPropertyConditionGetArgumentNegative(void)
 {
   TestApplication         application;
@@ -22,6 +22,7 @@
 #include <dali/devel-api/actors/actor-enumerations-devel.h>
 #include <dali/devel-api/object/property-map-devel.h>
 #include <dali/devel-api/rendering/renderer-devel.h>
+#include <dali/devel-api/rendering/shader-devel.h>
 #include <dali/devel-api/signals/render-callback.h>
 #include <dali/devel-api/threading/thread.h>
 #include <dali/integration-api/debug.h>
@@ -29,6 +30,7 @@
 #include <dali/integration-api/string-utils.h>
 #include <dali/public-api/common/capabilities.h>
 #include <dali/public-api/dali-core.h>
+#include <chrono>
 #include <cstdio>
 #include <string>
 
@@ -2640,6 +2642,67 @@ int UtcDaliRendererRenderOrder3DLayer(void)
   END_TEST;
 }
 
+namespace
+{
+/**
+ * Renders transparent actors at various depths in a 3D layer, some of them clipped, and returns the order of the texture binds.
+ */
+std::string RenderOrder3DLayer(const char* radixSortMinimumItemCount)
+{
+  setenv("DALI_RADIX_SORT_MINIMUM_ITEM_COUNT", radixSortMinimumItemCount, 1);
+
+  TestApplication application;
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+
+  Actor root = application.GetScene().GetRootLayer();
+  root.SetProperty(Layer::Property::BEHAVIOR, Layer::Behavior::LAYER_3D);
+
+  Actor clippingActor = CreateActor(root, 0, TEST_LOCATION);
+  clippingActor.SetProperty(Actor::Property::CLIPPING_MODE, ClippingMode::CLIP_CHILDREN);
+  clippingActor.SetProperty(Actor::Property::SIZE, Vector2(400.0f, 400.0f));
+
+  std::vector<Renderer> renderers;
+  for(int i = 0; i < 64; ++i)
+  {
+    Actor actor = CreateActor(i % 3 == 0 ? clippingActor : root, 0, TEST_LOCATION);
+    actor.SetProperty(Actor::Property::POSITION, Vector3(0.0f, 0.0f, static_cast<float>((i * 37) % 64) * 2.0f));
+    actor.SetProperty(Actor::Property::OPACITY, 0.5f);
+    actor.SetProperty(Actor::Property::COLOR_MODE, USE_OWN_COLOR);
+    renderers.push_back(CreateRenderer(actor, geometry, shader, (i % 4) * 10));
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  application.SendNotification();
+  application.Render(0);
+
+  gl.GetTextureTrace().Reset();
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS(gl.GetTextureTrace().CountMethod("BindTexture"), 64, TEST_LOCATION);
+
+  unsetenv("DALI_RADIX_SORT_MINIMUM_ITEM_COUNT");
+  return gl.GetTextureTrace().GetTraceString();
+}
+
+} // namespace
+
+int UtcDaliRendererRenderOrder3DLayerRadixSort(void)
+{
+  tet_infoline("Test the rendering order in a 3D layer is the same with the radix sort and the comparison sort");
+
+  const std::string comparisonSortOrder = RenderOrder3DLayer("0");
+  const std::string radixSortOrder      = RenderOrder3DLayer("1");
+
+  DALI_TEST_CHECK(!comparisonSortOrder.empty());
+  DALI_TEST_EQUALS(radixSortOrder, comparisonSortOrder, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliRendererSetIndexRange(void)
 {
   std::string
@@ -6211,3 +6274,430 @@ int utcDaliRendererPartialUpdateUpdateAreaExtents(void)
 
   END_TEST;
 }
+
+int UtcDaliRendererAutoInstancingP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that the items sharing a renderer with an auto instancing shader are drawn by a single instanced draw");
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource", static_cast<Shader::Hint::Value>(DevelShader::Hint::AUTO_INSTANCING));
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New(geometry, shader);
+
+  for(int i = 0; i < 10; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+    actor.SetProperty(Actor::Property::POSITION, Vector2(40.0f * i, 0.0f));
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+  }
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  auto&              drawTrace     = glAbstraction.GetDrawTrace();
+  drawTrace.Enable(true);
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  TraceCallStack::NamedParams params;
+  params["indexCount"] << 10; // instance count
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(drawTrace.FindMethodAndParams("DrawElementsInstanced", params));
+  DALI_TEST_CHECK(!drawTrace.FindMethod("DrawElements"));
+
+  tet_infoline("Without the hint, every item is drawn on its own");
+  Shader plainShader = Shader::New("VertexSource", "FragmentSource");
+  renderer.SetShader(plainShader);
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 10, TEST_LOCATION);
+  DALI_TEST_CHECK(!drawTrace.FindMethod("DrawElementsInstanced"));
+
+  END_TEST;
+}
+
+int UtcDaliRendererAutoInstancingIncompatibleItemsN(void)
+{
+  TestApplication application;
+  tet_infoline("Check that items with different renderers or their own uniforms are not merged");
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource", static_cast<Shader::Hint::Value>(DevelShader::Hint::AUTO_INSTANCING));
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New(geometry, shader);
+
+  std::vector<Actor> actors;
+  for(int i = 0; i < 4; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+    actor.SetProperty(Actor::Property::POSITION, Vector2(40.0f * i, 0.0f));
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+  }
+
+  // The third actor has a uniform of its own.
+  actors[2].RegisterProperty("uCustomValue", 1.0f);
+
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  auto&              drawTrace     = glAbstraction.GetDrawTrace();
+  drawTrace.Enable(true);
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  // The first two actors are merged, the others are drawn as single instances.
+  TraceCallStack::NamedParams twoInstances;
+  twoInstances["indexCount"] << 2;
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 3, TEST_LOCATION);
+  DALI_TEST_CHECK(drawTrace.FindMethodAndParams("DrawElementsInstanced", twoInstances));
+
+  tet_infoline("Different renderers are never merged");
+  for(auto& actor : actors)
+  {
+    actor.RemoveRenderer(0u);
+    Renderer ownRenderer = Renderer::New(geometry, shader);
+    actor.AddRenderer(ownRenderer);
+  }
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  TraceCallStack::NamedParams oneInstance;
+  oneInstance["indexCount"] << 1;
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElementsInstanced"), 4, TEST_LOCATION);
+  DALI_TEST_CHECK(drawTrace.FindMethodAndParams("DrawElementsInstanced", oneInstance));
+  DALI_TEST_CHECK(!drawTrace.FindMethodAndParams("DrawElementsInstanced", twoInstances));
+
+  END_TEST;
+}
+
+int UtcDaliRendererSharedByManyNodesUniformMapP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that the node uniforms of many nodes sharing a renderer with a large uniform map are used, and print the frame cost");
+
+  constexpr uint32_t NODE_COUNT    = 5000u;
+  constexpr uint32_t UNIFORM_COUNT = 20u;
+  constexpr uint32_t FRAME_COUNT   = 10u;
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New(geometry, shader);
+  renderer.RegisterProperty("uFadeColor", Color::RED);
+  for(uint32_t i = 0u; i < UNIFORM_COUNT; ++i)
+  {
+    renderer.RegisterProperty(("uCustom" + std::to_string(i)).c_str(), static_cast<float>(i));
+  }
+
+  auto NodeColor = [](uint32_t index)
+  { return Vector4(static_cast<float>(index % 100u) / 100.0f, static_cast<float>(index / 100u) / 100.0f, 1.0f, 1.0f); };
+
+  std::vector<Actor> actors;
+  for(uint32_t i = 0u; i < NODE_COUNT; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+    actor.RegisterProperty("uFadeColor", NodeColor(i));
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+    actors.push_back(actor);
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+
+  using Clock = std::chrono::steady_clock;
+  auto start  = Clock::now();
+
+  application.SendNotification();
+  application.Render(0);
+
+  const auto firstFrameTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+
+  // The last item drawn uses its own node's value
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uFadeColor", NodeColor(NODE_COUNT - 1u)));
+
+  start = Clock::now();
+  for(uint32_t i = 0u; i < FRAME_COUNT; ++i)
+  {
+    application.SendNotification();
+    application.Render(0);
+  }
+  const auto frameTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count() / FRAME_COUNT;
+
+  tet_printf("%u nodes sharing a renderer with %u uniforms : first frame %lld us, next frames %lld us\n", NODE_COUNT, UNIFORM_COUNT + 1u, static_cast<long long>(firstFrameTime), static_cast<long long>(frameTime));
+
+  tet_infoline("Draw a node in the middle last");
+  actors[NODE_COUNT / 2u].RaiseToTop();
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uFadeColor", NodeColor(NODE_COUNT / 2u)));
+
+  tet_infoline("Node without its own uniform uses the renderer's value");
+  Actor actor = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+  actor.AddRenderer(renderer);
+  application.GetScene().Add(actor);
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uFadeColor", Color::RED));
+
+  END_TEST;
+}
+
+int UtcDaliRendererRetainedUniformBufferP(void)
+{
+  setenv("DALI_RETAINED_UNIFORM_BUFFER", "1", 1);
+  TestApplication application;
+  unsetenv("DALI_RETAINED_UNIFORM_BUFFER");
+  tet_infoline("Check that the uniforms of static render items are not written again, and that the changed ones are");
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New(geometry, shader);
+  renderer.RegisterProperty("uFadeColor", Color::RED);
+
+  Actor actor = Actor::New();
+  actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+  Property::Index actorIndex = actor.RegisterProperty("uFadeProgress", 1.0f);
+  actor.AddRenderer(renderer);
+  application.GetScene().Add(actor);
+
+  TestGlAbstraction&               gl           = application.GetGlAbstraction();
+  Dali::Integration::RenderStatus& renderStatus = application.GetRenderStatus();
+
+  auto RenderFrames = [&application](uint32_t frameCount)
+  {
+    for(uint32_t i = 0u; i < frameCount; ++i)
+    {
+      application.SendNotification();
+      application.Render(0);
+    }
+  };
+
+  application.SendNotification();
+  application.Render(0);
+  const uint32_t firstFrameBytes = renderStatus.GetUniformBufferBytesWritten();
+  DALI_TEST_CHECK(firstFrameBytes > 0u);
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesRetained(), 0u, TEST_LOCATION);
+
+  tet_infoline("Static scene : nothing is written");
+  RenderFrames(4u);
+  tet_printf("Uniform bytes written : first frame %u, static frame %u (retained %u)\n", firstFrameBytes, renderStatus.GetUniformBufferBytesWritten(), renderStatus.GetUniformBufferBytesRetained());
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesWritten(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(renderStatus.GetUniformBufferBytesRetained() > 0u);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uFadeColor", Color::RED));
+  DALI_TEST_CHECK(gl.CheckUniformValue<float>("uFadeProgress", 1.0f));
+
+  tet_infoline("Renderer property changed");
+  renderer.SetProperty(renderer.GetPropertyIndex("uFadeColor"), Color::BLUE);
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK(renderStatus.GetUniformBufferBytesWritten() > 0u);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uFadeColor", Color::BLUE));
+
+  RenderFrames(4u);
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesWritten(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uFadeColor", Color::BLUE));
+
+  tet_infoline("Node property changed");
+  actor.SetProperty(actorIndex, 2.0f);
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK(renderStatus.GetUniformBufferBytesWritten() > 0u);
+  DALI_TEST_CHECK(gl.CheckUniformValue<float>("uFadeProgress", 2.0f));
+
+  RenderFrames(4u);
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesWritten(), 0u, TEST_LOCATION);
+
+  tet_infoline("Size and color changed");
+  actor.SetProperty(Actor::Property::SIZE, Vector2(64.0f, 16.0f));
+  actor.SetProperty(Actor::Property::COLOR, Vector4(1.0f, 1.0f, 1.0f, 0.5f));
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK(renderStatus.GetUniformBufferBytesWritten() > 0u);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector3>("uSize", Vector3(64.0f, 16.0f, 0.0f)));
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uColor", Vector4(1.0f, 1.0f, 1.0f, 0.5f)));
+
+  RenderFrames(4u);
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesWritten(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector3>("uSize", Vector3(64.0f, 16.0f, 0.0f)));
+
+  tet_infoline("Actor color changed, while the mix color keeps the final color : uActorColor is written again");
+  actor.SetProperty(Actor::Property::COLOR, Vector4(0.5f, 1.0f, 1.0f, 0.5f));
+  renderer.SetProperty(Renderer::Property::MIX_COLOR, Vector4(2.0f, 1.0f, 1.0f, 1.0f));
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK(renderStatus.GetUniformBufferBytesWritten() > 0u);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uColor", Vector4(1.0f, 1.0f, 1.0f, 0.5f)));
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uActorColor", Vector4(0.5f, 1.0f, 1.0f, 0.5f)));
+
+  RenderFrames(4u);
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesWritten(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector4>("uActorColor", Vector4(0.5f, 1.0f, 1.0f, 0.5f)));
+
+  tet_infoline("Another item drawn first : the memory of the item moves, so it is written again");
+  Actor otherActor = Actor::New();
+  otherActor.SetProperty(Actor::Property::SIZE, Vector2(16.0f, 16.0f));
+  otherActor.AddRenderer(renderer);
+  application.GetScene().Add(otherActor);
+  otherActor.LowerToBottom();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK(renderStatus.GetUniformBufferBytesWritten() >= firstFrameBytes);
+  DALI_TEST_CHECK(gl.CheckUniformValue<Vector3>("uSize", Vector3(64.0f, 16.0f, 0.0f)));
+
+  RenderFrames(4u);
+  DALI_TEST_EQUALS(renderStatus.GetUniformBufferBytesWritten(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRendererRetainedUniformBufferDisabledN(void)
+{
+  tet_infoline("Check that the uniforms are written in every frame by default, and when the retained mode is disabled");
+
+  for(const char* environmentVariableValue : {static_cast<const char*>(nullptr), "0"})
+  {
+    if(environmentVariableValue)
+    {
+      setenv("DALI_RETAINED_UNIFORM_BUFFER", environmentVariableValue, 1);
+    }
+    TestApplication application;
+    unsetenv("DALI_RETAINED_UNIFORM_BUFFER");
+
+    Shader   shader   = Shader::New("VertexSource", "FragmentSource");
+    Geometry geometry = CreateQuadGeometry();
+    Renderer renderer = Renderer::New(geometry, shader);
+
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+
+    for(uint32_t i = 0u; i < 5u; ++i)
+    {
+      application.SendNotification();
+      application.Render(0);
+    }
+
+    DALI_TEST_CHECK(application.GetRenderStatus().GetUniformBufferBytesWritten() > 0u);
+    DALI_TEST_EQUALS(application.GetRenderStatus().GetUniformBufferBytesRetained(), 0u, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+namespace
+{
+/**
+ * Renders several layers, two of them sharing a renderer, and returns the order of the texture binds.
+ */
+std::string RenderLayers(const char* renderWorkerThreadCount, bool expectSecondaryCommandBuffers)
+{
+  setenv("DALI_RENDER_WORKER_THREAD_COUNT", renderWorkerThreadCount, 1);
+
+  TestApplication application;
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+
+  std::vector<Layer> layers;
+  for(int i = 0; i < 4; ++i)
+  {
+    Layer layer = Layer::New();
+    layer.SetProperty(Actor::Property::SIZE, Vector2(480.0f, 800.0f));
+    application.GetScene().Add(layer);
+    layers.push_back(layer);
+
+    for(int j = 0; j < 3; ++j)
+    {
+      Actor actor = CreateActor(layer, j, TEST_LOCATION);
+      actor.SetProperty(Actor::Property::SIZE, Vector2(10.0f + i * 10.0f + j, 20.0f));
+      CreateRenderer(actor, geometry, shader, j);
+    }
+  }
+
+  // The first two layers draw the same renderer
+  Renderer sharedRenderer = CreateRenderer(CreateActor(layers[0], 3, TEST_LOCATION), geometry, shader, 3);
+  CreateActor(layers[1], 3, TEST_LOCATION).AddRenderer(sharedRenderer);
+
+  TestGraphicsController& graphics = application.GetGraphicsController();
+  TestGlAbstraction&      gl       = application.GetGlAbstraction();
+  graphics.mCallStack.EnableLogging(false);
+  graphics.mCallStack.Enable(true);
+  graphics.mCommandBufferCallStack.Enable(true);
+  gl.EnableTextureCallTrace(true);
+
+  // The textures are bound when they are created in the first frame
+  application.SendNotification();
+  application.Render(0);
+
+  for(int frame = 0; frame < 2; ++frame)
+  {
+    graphics.mCallStack.Reset();
+    graphics.mCommandBufferCallStack.Reset();
+    gl.GetTextureTrace().Reset();
+
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_EQUALS(gl.GetTextureTrace().CountMethod("BindTexture"), 14, TEST_LOCATION);
+    DALI_TEST_EQUALS(graphics.mCommandBufferCallStack.FindMethod("ExecuteCommandBuffers"), expectSecondaryCommandBuffers, TEST_LOCATION);
+    DALI_TEST_CHECK(gl.CheckUniformValue<Vector3>("uSize", Vector3(42.0f, 20.0f, 0.0f))); // The last actor of the top layer
+  }
+
+  unsetenv("DALI_RENDER_WORKER_THREAD_COUNT");
+  return gl.GetTextureTrace().GetTraceString();
+}
+
+} // namespace
+
+int UtcDaliRendererRecordRenderListsInParallel(void)
+{
+  tet_infoline("Test the render lists recorded by worker threads draw in the same order as the ones recorded by the render thread");
+
+  const std::string serialOrder   = RenderLayers("0", false);
+  const std::string parallelOrder = RenderLayers("2", true);
+
+  DALI_TEST_CHECK(!serialOrder.empty());
+  DALI_TEST_EQUALS(parallelOrder, serialOrder, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliRendererRecordRenderListsInParallelSingleListN(void)
+{
+  setenv("DALI_RENDER_WORKER_THREAD_COUNT", "2", 1);
+  TestApplication application;
+  unsetenv("DALI_RENDER_WORKER_THREAD_COUNT");
+  tet_infoline("Check that a single render list is recorded by the render thread into the primary command buffer");
+
+  Shader   shader   = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor    actor    = CreateActor(application.GetScene().GetRootLayer(), 0, TEST_LOCATION);
+  CreateRenderer(actor, geometry, shader, 0);
+
+  TestGraphicsController& graphics = application.GetGraphicsController();
+  graphics.mCommandBufferCallStack.Enable(true);
+  graphics.mCommandBufferCallStack.Reset();
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_CHECK(graphics.mCommandBufferCallStack.FindMethod("Draw") || graphics.mCommandBufferCallStack.FindMethod("DrawIndexed"));
+  DALI_TEST_CHECK(!graphics.mCommandBufferCallStack.FindMethod("ExecuteCommandBuffers"));
+
+  END_TEST;
+}
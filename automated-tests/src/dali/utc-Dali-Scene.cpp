@@ -19,6 +19,7 @@
 #include <dali/devel-api/actors/actor-devel.h>
 #include <dali/devel-api/actors/actor-enumerations-devel.h>
 #include <dali/devel-api/events/key-event-devel.h>
+#include <dali/devel-api/rendering/renderer-devel.h>
 #include <dali/devel-api/threading/thread.h>
 #include <dali/integration-api/events/key-event-integ.h>
 #include <dali/integration-api/events/touch-event-integ.h>
@@ -29,6 +30,8 @@
 #include <stdlib.h>
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 // Internal headers are allowed here
 #include "test-graphics-command-buffer.h"
@@ -4193,3 +4196,103 @@ int UtcDaliSceneWheelEventGeneratedSignalMultipleCallbacksGeometryOn(void)
 
   END_TEST;
 }
+
+namespace
+{
+/**
+ * Renders a frame of several scenes, one of them having an offscreen render task.
+ * @param[in]  workerThreadCount The number of update worker threads, or 0 to process the scenes on the update thread.
+ * @param[out] keepUpdating      Whether the frame requested another update.
+ * @return The number of draw calls of the frame.
+ */
+int32_t RenderMultipleScenes(const char* workerThreadCount, bool& keepUpdating)
+{
+  setenv("DALI_UPDATE_WORKER_THREAD_COUNT", workerThreadCount, 1);
+  TestApplication application;
+  unsetenv("DALI_UPDATE_WORKER_THREAD_COUNT");
+
+  constexpr uint32_t SCENE_COUNT = 4u;
+  constexpr uint32_t ACTOR_COUNT = 50u;
+
+  std::vector<std::unique_ptr<TestRenderSurface>> surfaces;
+  std::vector<Dali::Integration::Scene>           scenes{application.GetScene()};
+  for(uint32_t i = 1u; i < SCENE_COUNT; ++i)
+  {
+    surfaces.push_back(std::make_unique<TestRenderSurface>(Dali::PositionSize(0, 0, 480, 800)));
+    Graphics::RenderTargetCreateInfo rtInfo{};
+    rtInfo.SetExtent({480u, 800u});
+    rtInfo.SetSurface(surfaces.back().get());
+
+    scenes.push_back(Dali::Integration::Scene::New(rtInfo, Size(480.0f, 800.0f)));
+    application.AddScene(scenes.back());
+  }
+
+  Actor actor;
+  for(auto&& scene : scenes)
+  {
+    for(uint32_t i = 0u; i < ACTOR_COUNT; ++i)
+    {
+      actor                            = CreateRenderableActor();
+      actor[Actor::Property::SIZE]     = Vector2(16.0f, 16.0f);
+      actor[Actor::Property::POSITION] = Vector2(static_cast<float>(i % 10u) * 20.0f, static_cast<float>(i / 10u) * 20.0f);
+      scene.Add(actor);
+    }
+  }
+
+  RenderTask offscreenTask = scenes[1].GetRenderTaskList().CreateTask();
+  offscreenTask.SetSourceActor(scenes[1].GetRootLayer());
+  Texture     texture     = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 480u, 800u);
+  FrameBuffer frameBuffer = FrameBuffer::New(480u, 800u, FrameBuffer::Attachment::NONE);
+  frameBuffer.AttachColorTexture(texture);
+  offscreenTask.SetFrameBuffer(frameBuffer);
+
+  // The last actor belongs to the last scene
+  Renderer continuousRenderer = actor.GetRendererAt(0u);
+  continuousRenderer.SetProperty(DevelRenderer::Property::RENDERING_BEHAVIOR, DevelRenderer::Rendering::CONTINUOUSLY);
+
+  application.SendNotification();
+  application.Render();
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+  drawTrace.Reset();
+
+  application.SendNotification();
+  keepUpdating = application.Render();
+
+  const int32_t drawCount = drawTrace.CountMethod("DrawElements");
+
+  for(uint32_t i = 1u; i < SCENE_COUNT; ++i)
+  {
+    application.RemoveScene(scenes[i]);
+    scenes[i].RemoveSceneObject();
+    scenes[i].Discard();
+  }
+  scenes.clear();
+
+  application.SendNotification();
+  application.Render();
+
+  return drawCount;
+}
+} // namespace
+
+int UtcDaliSceneProcessMultipleScenesWithWorkerThreadsP(void)
+{
+  tet_infoline("Ensure the scenes processed by the update worker threads are rendered as the ones processed serially");
+
+  bool          serialKeepUpdating   = false;
+  bool          parallelKeepUpdating = false;
+  const int32_t serialDrawCount      = RenderMultipleScenes("0", serialKeepUpdating);
+  const int32_t parallelDrawCount    = RenderMultipleScenes("2", parallelKeepUpdating);
+
+  // Every actor of the 4 scenes, and the actors of the second scene again for its offscreen task
+  DALI_TEST_EQUALS(serialDrawCount, 250, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelDrawCount, serialDrawCount, TEST_LOCATION);
+
+  // The continuously rendering renderer of the last scene, which a worker thread processes, keeps the update running
+  DALI_TEST_EQUALS(serialKeepUpdating, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(parallelKeepUpdating, true, TEST_LOCATION);
+
+  END_TEST;
+}
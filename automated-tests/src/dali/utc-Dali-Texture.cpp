@@ -1411,6 +1411,218 @@ int UtcDaliTextureUploadSmallerThanSize(void)
   END_TEST;
 }
 
+namespace
+{
+/**
+ * Retrieves the number of uploads of the single UpdateTextures call of the frame.
+ */
+std::string GetBatchedUploadCount(TraceCallStack& graphicsCallStack)
+{
+  TraceCallStack::NamedParams params;
+  if(graphicsCallStack.CountMethod("UpdateTextures") != 1 || !graphicsCallStack.FindMethodAndGetParameters("UpdateTextures", params))
+  {
+    return "";
+  }
+  return params["updateInfoList"].str();
+}
+
+} // namespace
+
+int UtcDaliTextureUploadScheduled01(void)
+{
+  tet_infoline("Test that the uploads are spread over several frames when a budget is set");
+
+  const uint32_t width(32);
+  const uint32_t height(32);
+  const uint32_t bufferSize(width * height * 4);
+
+  // Two uploads per frame
+  setenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME", std::to_string(bufferSize * 2).c_str(), 1);
+  TestApplication application;
+  unsetenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME");
+
+  std::vector<Texture> textures;
+  for(uint32_t i = 0u; i < 5u; ++i)
+  {
+    textures.push_back(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height));
+  }
+
+  TraceCallStack& graphicsCallStack = application.GetGraphicsController().mCallStack;
+  graphicsCallStack.EnableLogging(true);
+
+  application.SendNotification();
+  application.Render();
+  graphicsCallStack.Reset();
+
+  for(auto&& texture : textures)
+  {
+    unsigned char* buffer    = reinterpret_cast<unsigned char*>(malloc(bufferSize));
+    PixelData      pixelData = PixelData::New(buffer, bufferSize, width, height, Pixel::RGBA8888, PixelData::FREE);
+    texture.Upload(pixelData);
+  }
+  textures.back().GenerateMipmaps();
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[2]:", TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), true, TEST_LOCATION);
+
+  graphicsCallStack.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[2]:", TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), true, TEST_LOCATION);
+
+  // The mipmaps are generated after the data is uploaded
+  graphicsCallStack.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[1]:", TEST_LOCATION);
+  DALI_TEST_EQUALS(graphicsCallStack.CountMethod("GenerateTextureMipmaps"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(graphicsCallStack.FindIndexFromMethodAndParams("UpdateTextures", "") < graphicsCallStack.FindIndexFromMethodAndParams("GenerateTextureMipmaps", ""));
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), false, TEST_LOCATION);
+
+  // Mipmaps of a texture without pending upload are generated at once
+  graphicsCallStack.Reset();
+  textures.front().GenerateMipmaps();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(graphicsCallStack.CountMethod("GenerateTextureMipmaps"), 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadScheduled02(void)
+{
+  tet_infoline("Test that the textures used by the render instructions are uploaded first");
+
+  // One upload per frame
+  setenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME", "1", 1);
+  TestApplication application;
+  unsetenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME");
+
+  Texture offStageTexture = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u);
+  Texture onStageTexture  = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 32u, 32u);
+
+  TextureSet textureSet = CreateTextureSet();
+  textureSet.SetTexture(0u, onStageTexture);
+  Geometry geometry = CreateQuadGeometry();
+  Shader   shader   = CreateShader();
+  Renderer renderer = Renderer::New(geometry, shader);
+  renderer.SetTextures(textureSet);
+  Actor actor = Actor::New();
+  actor.AddRenderer(renderer);
+  actor.SetProperty(Actor::Property::SIZE, Vector2(100.0f, 100.0f));
+  application.GetScene().Add(actor);
+
+  application.GetGlAbstraction().EnableTextureCallTrace(true);
+  TraceCallStack& callStack         = application.GetGlAbstraction().GetTextureTrace();
+  TraceCallStack& graphicsCallStack = application.GetGraphicsController().mCallStack;
+  graphicsCallStack.EnableLogging(true);
+
+  application.SendNotification();
+  application.Render();
+  callStack.Reset();
+  graphicsCallStack.Reset();
+
+  offStageTexture.Upload(PixelData::New(reinterpret_cast<unsigned char*>(malloc(16u * 16u * 4u)), 16u * 16u * 4u, 16u, 16u, Pixel::RGBA8888, PixelData::FREE));
+  onStageTexture.Upload(PixelData::New(reinterpret_cast<unsigned char*>(malloc(32u * 32u * 4u)), 32u * 32u * 4u, 32u, 32u, Pixel::RGBA8888, PixelData::FREE));
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[1]:", TEST_LOCATION);
+  {
+    std::stringstream out;
+    out << GL_TEXTURE_2D << ", " << 0u << ", " << 32u << ", " << 32u;
+    DALI_TEST_CHECK(callStack.FindMethodAndParams("TexImage2D", out.str().c_str()));
+  }
+
+  callStack.Reset();
+  graphicsCallStack.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[1]:", TEST_LOCATION);
+  {
+    std::stringstream out;
+    out << GL_TEXTURE_2D << ", " << 0u << ", " << 16u << ", " << 16u;
+    DALI_TEST_CHECK(callStack.FindMethodAndParams("TexImage2D", out.str().c_str()));
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadScheduledSourceReferenceP(void)
+{
+  tet_infoline("Test that each batched upload refers to its own source data");
+
+  setenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME", std::to_string(1024u * 1024u).c_str(), 1);
+  TestApplication application;
+  unsetenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME");
+
+  std::vector<Texture> textures;
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    textures.push_back(Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u));
+  }
+
+  TraceCallStack& graphicsCallStack = application.GetGraphicsController().mCallStack;
+  graphicsCallStack.EnableLogging(true);
+
+  application.SendNotification();
+  application.Render();
+  graphicsCallStack.Reset();
+
+  for(auto&& texture : textures)
+  {
+    texture.Upload(PixelData::New(reinterpret_cast<unsigned char*>(malloc(16u * 16u * 4u)), 16u * 16u * 4u, 16u, 16u, Pixel::RGBA8888, PixelData::FREE));
+  }
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[3]:", TEST_LOCATION);
+
+  TraceCallStack::NamedParams params;
+  DALI_TEST_CHECK(graphicsCallStack.FindMethodAndGetParameters("UpdateTextures", params));
+  DALI_TEST_EQUALS(params["sourceList"].str(), "[3]:", TEST_LOCATION);
+  DALI_TEST_EQUALS(params["srcReference"].str(), "0 1 2 ", TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadScheduledDestroyedN(void)
+{
+  tet_infoline("Test that the pending uploads of a destroyed texture are dropped");
+
+  setenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME", "1", 1);
+  TestApplication application;
+  unsetenv("DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME");
+
+  Texture texture = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u);
+
+  TraceCallStack& graphicsCallStack = application.GetGraphicsController().mCallStack;
+  graphicsCallStack.EnableLogging(true);
+
+  application.SendNotification();
+  application.Render();
+  graphicsCallStack.Reset();
+
+  texture.Upload(PixelData::New(reinterpret_cast<unsigned char*>(malloc(16u * 16u * 4u)), 16u * 16u * 4u, 16u, 16u, Pixel::RGBA8888, PixelData::FREE));
+  texture.Upload(PixelData::New(reinterpret_cast<unsigned char*>(malloc(16u * 16u * 4u)), 16u * 16u * 4u, 16u, 16u, Pixel::RGBA8888, PixelData::FREE));
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(GetBatchedUploadCount(graphicsCallStack), "[1]:", TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), true, TEST_LOCATION);
+
+  texture.Reset();
+  graphicsCallStack.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS(graphicsCallStack.CountMethod("UpdateTextures"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(application.GetRenderNeedsUpdate(), false, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliTextureGenerateMipmaps(void)
 {
   TestApplication application;
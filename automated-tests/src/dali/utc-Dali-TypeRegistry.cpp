@@ -2419,6 +2419,58 @@ int UtcDaliTypeRegistryChildPropertyRegistrationP(void)
   END_TEST;
 }
 
+int UtcDaliTypeRegistryChildPropertyRegistrationManyCustomPropertiesP(void)
+{
+  // The same as above, with enough custom properties for the child to look them up through a hash table
+  TestApplication application;
+  TypeRegistry    typeRegistry = TypeRegistry::Get();
+
+  TypeInfo typeInfo = typeRegistry.GetTypeInfo(typeid(MyTestCustomActor));
+  DALI_TEST_CHECK(typeInfo);
+  Actor customActor = Actor::DownCast(typeInfo.CreateInstance());
+  DALI_TEST_CHECK(customActor);
+
+  std::string               propertyName("manyChildProp1");
+  int                       propertyIndex(CHILD_PROPERTY_REGISTRATION_START_INDEX + 20);
+  ChildPropertyRegistration childProperty1(customType1, ToDaliString(propertyName), propertyIndex, Property::BOOLEAN);
+
+  std::string               propertyName2("manyChildProp2");
+  int                       propertyIndex2(CHILD_PROPERTY_REGISTRATION_START_INDEX + 21);
+  ChildPropertyRegistration childProperty2(customType1, ToDaliString(propertyName2), propertyIndex2, Property::INTEGER);
+
+  Actor                        childActor = Actor::New();
+  std::vector<Property::Index> customPropertyIndices;
+  for(int i = 0; i < 16; ++i)
+  {
+    customPropertyIndices.push_back(childActor.RegisterProperty(ToDaliString("manyCustomProp" + std::to_string(i)), static_cast<float>(i)));
+  }
+
+  // The child property has no name until the child actor has a parent
+  childActor.SetProperty(propertyIndex, true);
+  DALI_TEST_EQUALS(childActor.GetProperty<bool>(propertyIndex), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(childActor.GetPropertyIndex(ToDaliStringView(propertyName)), Property::INVALID_INDEX, TEST_LOCATION);
+
+  Property::Index customPropertyIndex = childActor.RegisterProperty(ToDaliString(propertyName2), 100, Property::READ_WRITE);
+  DALI_TEST_EQUALS(childActor.GetPropertyIndex(ToDaliStringView(propertyName2)), customPropertyIndex, TEST_LOCATION);
+
+  customActor.Add(childActor);
+
+  // The names and indices of the child properties are resolved
+  DALI_TEST_EQUALS(childActor.GetPropertyName(propertyIndex), propertyName, TEST_LOCATION);
+  DALI_TEST_EQUALS(childActor.GetPropertyIndex(ToDaliStringView(propertyName)), propertyIndex, TEST_LOCATION);
+  DALI_TEST_EQUALS(childActor.GetPropertyIndex(ToDaliStringView(propertyName2)), propertyIndex2, TEST_LOCATION);
+  DALI_TEST_EQUALS(childActor.GetProperty<int>(propertyIndex2), 100, TEST_LOCATION);
+  DALI_TEST_EQUALS(childActor.GetProperty<int>(customPropertyIndex), 100, TEST_LOCATION);
+
+  for(int i = 0; i < 16; ++i)
+  {
+    DALI_TEST_EQUALS(childActor.GetPropertyIndex(ToDaliStringView("manyCustomProp" + std::to_string(i))), customPropertyIndices[i], TEST_LOCATION);
+    DALI_TEST_EQUALS(childActor.GetProperty<float>(customPropertyIndices[i]), static_cast<float>(i), TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
 int UtcDaliTypeRegistryChildPropertyRegistrationN(void)
 {
   TestApplication application;
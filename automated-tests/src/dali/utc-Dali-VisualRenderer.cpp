@@ -1749,3 +1749,124 @@ int UtcDaliVisualRendererPartialUpdate03(void)
 
   END_TEST;
 }
+
+int UtcDaliVisualRendererOcclusionCullingP(void)
+{
+  TestApplication application;
+  tet_infoline("Check that the items hidden by an opaque visual renderer drawn after them are not rendered");
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader   shader   = CreateShader();
+
+  for(int i = 0; i < 3; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+    actor.SetProperty(Actor::Property::POSITION, Vector2(40.0f * i, 0.0f));
+    Renderer renderer = Renderer::New(geometry, shader);
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+  }
+
+  VisualRenderer renderer = VisualRenderer::New(geometry, shader);
+  Actor          occluder = Actor::New();
+  occluder.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 100.0f));
+  occluder.SetProperty(Actor::Property::POSITION, Vector2(20.0f, 10.0f));
+  occluder.AddRenderer(renderer);
+  application.GetScene().Add(occluder);
+
+  auto& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 1, TEST_LOCATION);
+
+  tet_infoline("The occluded items are still culled when the render list is reused");
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 1, TEST_LOCATION);
+
+  tet_infoline("An item partially out of the occluder is rendered");
+  occluder.SetProperty(Actor::Property::POSITION, Vector2(90.0f, 10.0f));
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 2, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVisualRendererOcclusionCullingN(void)
+{
+  TestApplication application;
+  tet_infoline("Check that translucent, rotated or shrunk visual renderers hide nothing");
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader   shader   = CreateShader();
+
+  for(int i = 0; i < 3; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::SIZE, Vector2(32.0f, 32.0f));
+    actor.SetProperty(Actor::Property::POSITION, Vector2(40.0f * i, 0.0f));
+    Renderer renderer = Renderer::New(geometry, shader);
+    actor.AddRenderer(renderer);
+    application.GetScene().Add(actor);
+  }
+
+  VisualRenderer renderer = VisualRenderer::New(geometry, shader);
+  Actor          occluder = Actor::New();
+  occluder.SetProperty(Actor::Property::SIZE, Vector2(200.0f, 100.0f));
+  occluder.SetProperty(Actor::Property::POSITION, Vector2(20.0f, 10.0f));
+  occluder.SetProperty(Actor::Property::OPACITY, 0.5f);
+  occluder.AddRenderer(renderer);
+  application.GetScene().Add(occluder);
+
+  auto& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 4, TEST_LOCATION);
+
+  tet_infoline("Rotated occluder");
+  occluder.SetProperty(Actor::Property::OPACITY, 1.0f);
+  occluder.SetProperty(Actor::Property::ORIENTATION, Quaternion(Degree(30.0f), Vector3::ZAXIS));
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 4, TEST_LOCATION);
+
+  tet_infoline("Visual shrunk by its transform");
+  occluder.SetProperty(Actor::Property::ORIENTATION, Quaternion(Degree(0.0f), Vector3::ZAXIS));
+  renderer.SetProperty(VisualRenderer::Property::TRANSFORM_SIZE, Vector2(0.1f, 0.1f));
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 4, TEST_LOCATION);
+
+  tet_infoline("Opaque, axis aligned, full size occluder");
+  renderer.SetProperty(VisualRenderer::Property::TRANSFORM_SIZE, Vector2(1.0f, 1.0f));
+  drawTrace.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawElements"), 1, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/actors/actor-creation-batch.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/event/common/event-thread-services.h>
+#include <dali/internal/update/manager/update-manager.h>
+
+namespace Dali
+{
+ActorCreationBatch::ActorCreationBatch()
+: mStarted(Internal::EventThreadServices::IsCoreRunning())
+{
+  if(mStarted)
+  {
+    Internal::EventThreadServices::Get().GetUpdateManager().BeginNodeBatch();
+  }
+}
+
+ActorCreationBatch::~ActorCreationBatch()
+{
+  if(mStarted && Internal::EventThreadServices::IsCoreRunning())
+  {
+    Internal::EventThreadServices::Get().GetUpdateManager().EndNodeBatch();
+  }
+}
+
+} // namespace Dali
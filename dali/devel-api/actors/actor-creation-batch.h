@@ -0,0 +1,76 @@
+#ifndef DALI_ACTOR_CREATION_BATCH_H
+#define DALI_ACTOR_CREATION_BATCH_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+/**
+ * @brief Installs the actors created in its scope into the scene graph with one message.
+ *
+ * Without a batch, each actor sends a message to add its node, then more messages to connect it,
+ * attach its renderers and set its properties. While a batch exists, the new nodes and every message
+ * are collected instead, and sent together when the batch is destroyed: the update thread adds all the
+ * nodes at once, then processes the collected messages in order.
+ *
+ * This is meant to build a whole subtree, e.g. a page of a list view:
+ * @code
+ * {
+ *   ActorCreationBatch batch;
+ *   for(uint32_t i = 0u; i < itemCount; ++i)
+ *   {
+ *     Actor item = Actor::New();
+ *     item.AddRenderer(renderer);
+ *     item.SetProperty(Actor::Property::POSITION, Vector2(0.0f, i * itemHeight));
+ *     page.Add(item);
+ *   }
+ * } // The page is sent to the update thread here
+ * @endcode
+ *
+ * Batches can be nested; the outermost one sends the messages.
+ * @note It must be created and destroyed on the event thread, during the same event.
+ * Nothing changed in its scope is visible to the update thread before it is destroyed.
+ */
+class DALI_CORE_API ActorCreationBatch
+{
+public:
+  /**
+   * @brief Starts collecting the new nodes and the messages.
+   */
+  ActorCreationBatch();
+
+  /**
+   * @brief Sends the collected nodes and messages to the update thread.
+   */
+  ~ActorCreationBatch();
+
+  ActorCreationBatch(const ActorCreationBatch&)            = delete; ///< Deleted copy constructor
+  ActorCreationBatch& operator=(const ActorCreationBatch&) = delete; ///< Deleted copy assignment operator
+  ActorCreationBatch(ActorCreationBatch&&)                 = delete; ///< Deleted move constructor
+  ActorCreationBatch& operator=(ActorCreationBatch&&)      = delete; ///< Deleted move assignment operator
+
+private:
+  bool mStarted; ///< Whether the batch was started, i.e. the core was running
+};
+
+} // namespace Dali
+
+#endif // DALI_ACTOR_CREATION_BATCH_H
@@ -0,0 +1,54 @@
+#ifndef DALI_SHADER_DEVEL_H
+#define DALI_SHADER_DEVEL_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/rendering/shader.h>
+
+namespace Dali
+{
+namespace DevelShader
+{
+namespace Hint
+{
+/**
+ * @brief Enumeration for the hints of the devel api, which extend Dali::Shader::Hint::Value.
+ *
+ * A shader with the AUTO_INSTANCING hint must declare the per-instance attributes
+ * "aInstanceMvpMatrix" (mat4), "aInstanceColor" (vec4) and "aInstanceSize" (vec3), and use them
+ * instead of the uMvpMatrix, uColor and uSize uniforms. Consecutive items sharing the same Renderer
+ * are then drawn with a single instanced draw call, whose other uniforms are written from the first item.
+ *
+ * The hints are combined with the Dali::Shader::Hint values, e.g.
+ * @code
+ * Shader::New(vertexShader, fragmentShader, static_cast<Shader::Hint::Value>(DevelShader::Hint::AUTO_INSTANCING));
+ * @endcode
+ */
+enum Value
+{
+  AUTO_INSTANCING = 0x10, ///< Reads its per-item data from instance attributes, so compatible items may be drawn as one instanced draw
+};
+
+} // namespace Hint
+
+} // namespace DevelShader
+
+} // namespace Dali
+
+#endif // DALI_SHADER_DEVEL_H
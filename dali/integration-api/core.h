@@ -159,7 +159,9 @@ public:
    * Constructor
    */
   RenderStatus()
-  : needsUpdate(false),
+  : uniformBufferBytesWritten(0u),
+    uniformBufferBytesRetained(0u),
+    needsUpdate(false),
     needsPostRender(false)
   {
   }
@@ -201,9 +203,40 @@ public:
     return needsPostRender;
   }
 
+  /**
+   * Sets the number of bytes of uniforms written, and of uniforms used again from the previous frame without being written.
+   * @param[in] writtenBytes The number of bytes written
+   * @param[in] retainedBytes The number of bytes used again
+   */
+  void SetUniformBufferBytes(uint32_t writtenBytes, uint32_t retainedBytes)
+  {
+    uniformBufferBytesWritten  = writtenBytes;
+    uniformBufferBytesRetained = retainedBytes;
+  }
+
+  /**
+   * Queries the number of bytes of uniforms written during the frame.
+   * @return The number of bytes written into the uniform buffers
+   */
+  uint32_t GetUniformBufferBytesWritten() const
+  {
+    return uniformBufferBytesWritten;
+  }
+
+  /**
+   * Queries the number of bytes of uniforms used again from the previous frame, instead of being written.
+   * @return The number of bytes retained in the uniform buffers
+   */
+  uint32_t GetUniformBufferBytesRetained() const
+  {
+    return uniformBufferBytesRetained;
+  }
+
 private:
-  bool needsUpdate : 1;     ///< True if update is required to be run
-  bool needsPostRender : 1; ///< True if post-render is required to be run.
+  uint32_t uniformBufferBytesWritten;  ///< Bytes of uniforms written during the frame
+  uint32_t uniformBufferBytesRetained; ///< Bytes of uniforms used again from the previous frame
+  bool     needsUpdate : 1;            ///< True if update is required to be run
+  bool     needsPostRender : 1;        ///< True if post-render is required to be run.
 };
 
 /**
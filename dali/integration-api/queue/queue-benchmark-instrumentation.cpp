@@ -91,6 +91,10 @@ const char* CounterName(Counter counter)
     {
       return "MQ_EventThreadBlockedTotalNs";
     }
+    case Counter::MQ_MERGED_PROPERTY_MESSAGES:
+    {
+      return "MQ_MergedPropertyMessages";
+    }
     default:
       return "Unknown";
   }
@@ -196,6 +196,7 @@ enum class Counter : std::size_t
   NM_BUFFER_FULL_EVENTS,            ///< Times the lockless notificationBuffer was full and a notification was rolled back
   MQ_EVENT_THREAD_WAIT_COUNT,       ///< Times the Event thread actually entered localFuture.wait_for() (a subset of MQ_BUFFER_FULL_EVENTS — only when the overflow queue was ALSO deep enough to trigger waitForConsumer)
   MQ_EVENT_THREAD_BLOCKED_TOTAL_NS, ///< Cumulative nanoseconds the Event thread spent blocked in wait_for() across the whole run — a single number for "how much total responsiveness did contention cost", complementing the MQ_EVENT_THREAD_BLOCKED_WAIT distribution
+  MQ_MERGED_PROPERTY_MESSAGES,      ///< Property messages not queued because their value was merged into the previous message of the same property in the current buffer
   COUNT
 };
 
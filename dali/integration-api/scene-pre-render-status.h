@@ -42,7 +42,9 @@ public:
    * Constructor
    */
   ScenePreRenderStatus()
-  : hasRenderInstructionToScene(false),
+  : maximumDamagedRectCount(0u),
+    damagedAreaRatio(1.0f),
+    hasRenderInstructionToScene(false),
     hadRenderInstructionToScene(false),
     isRenderingSkipped(false)
   {
@@ -78,7 +80,40 @@ public:
     return isRenderingSkipped;
   }
 
+  /**
+   * Sets the maximum number of damaged rects that PreRenderScene returns with partial update.
+   * The damaged rects of the items are merged into at most this number of rects which do not overlap.
+   * @param[in] maximumCount The maximum number of damaged rects, or zero to return the rects of every item (default)
+   */
+  void SetMaximumDamagedRectCount(uint32_t maximumCount)
+  {
+    maximumDamagedRectCount = maximumCount;
+  }
+
+  uint32_t GetMaximumDamagedRectCount() const
+  {
+    return maximumDamagedRectCount;
+  }
+
+  void SetDamagedAreaRatio(float ratio)
+  {
+    damagedAreaRatio = ratio;
+  }
+
+  /**
+   * Gets the area of the returned damaged rects divided by the area covered by the damaged rects of the items.
+   * The overlapping damaged rects are counted once, so it is never below 1, and above 1 when merging the rects added some area which was not damaged.
+   * @return The ratio, 1 if the damaged rects were not merged
+   */
+  float GetDamagedAreaRatio() const
+  {
+    return damagedAreaRatio;
+  }
+
 private:
+  uint32_t maximumDamagedRectCount; ///< The maximum number of damaged rects, or zero if they are not merged.
+  float    damagedAreaRatio;        ///< The area of the merged damaged rects divided by the area covered by the damaged rects.
+
   bool hasRenderInstructionToScene : 1; ///< True if has render instruction to the scene.
   bool hadRenderInstructionToScene : 1; ///< True if had render instruction to the scene.
   bool isRenderingSkipped : 1;
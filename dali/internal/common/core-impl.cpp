@@ -32,6 +32,7 @@
 #include <dali/integration-api/scene-pre-render-status.h>
 #include <dali/integration-api/trace.h>
 
+#include <dali/internal/common/environment-variable.h>
 #include <dali/internal/event/actors/actor-impl.h>
 #include <dali/internal/event/animation/animation-playlist.h>
 #include <dali/internal/event/common/event-thread-services.h>
@@ -66,6 +67,8 @@ namespace
 // The Update for frame N+1 may be processed whilst frame N is being rendered.
 const uint32_t MAXIMUM_UPDATE_COUNT = 2u;
 
+constexpr const char* PROGRAM_CACHE_FILE_ENV = "DALI_PROGRAM_CACHE_FILE"; ///< File keeping the programs to create ahead of time on the next launch. Unset disables it.
+
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_PERFORMANCE_MARKER, false);
 
 #if defined(DEBUG_ENABLED)
@@ -138,6 +141,8 @@ Core::Core(RenderController&            renderController,
 
 Core::~Core()
 {
+  PERF_MONITOR_DUMP();
+
   /*
    * The order of destructing these singletons is important!!!
    */
@@ -184,6 +189,11 @@ Core::~Core()
 
 void Core::Initialize()
 {
+  const auto programCacheFile = EnvironmentVariable::GetValue(PROGRAM_CACHE_FILE_ENV);
+  if(programCacheFile && !programCacheFile->empty())
+  {
+    mRenderManager->LoadProgramCache(*programCacheFile);
+  }
 }
 
 void Core::ContextCreated()
@@ -394,10 +404,10 @@ void Core::RelayoutAndFlush(SceneContainer& scenes)
   // Run any registered post processors
   RunPostProcessors();
 
-  // Rebuild depth tree after event processing has finished
+  // Update depth tree after event processing has finished
   for(auto& scene : scenes)
   {
-    scene->RebuildDepthTree();
+    scene->UpdateDepthTree();
   }
 
   // process events in all scenes
@@ -1013,6 +1023,16 @@ uint32_t* Core::ReserveMessageSlot(uint32_t size, bool updateScene)
   return mUpdateManager->ReserveMessageSlot(size, updateScene);
 }
 
+uint32_t* Core::ReservePropertyMessageSlot(uint32_t size, const void* property, const void* messageTypeId)
+{
+  return mUpdateManager->ReservePropertyMessageSlot(size, property, messageTypeId);
+}
+
+uint32_t* Core::FindLastPropertyMessage(const void* property, const void* messageTypeId)
+{
+  return mUpdateManager->FindLastPropertyMessage(property, messageTypeId);
+}
+
 } // namespace Internal
 
 } // namespace Dali
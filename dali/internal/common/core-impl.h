@@ -290,6 +290,16 @@ public: // Implementation of EventThreadServices
    */
   uint32_t* ReserveMessageSlot(uint32_t size, bool updateScene) override;
 
+  /**
+   * @copydoc EventThreadServices::ReservePropertyMessageSlot
+   */
+  uint32_t* ReservePropertyMessageSlot(uint32_t size, const void* property, const void* messageTypeId) override;
+
+  /**
+   * @copydoc EventThreadServices::FindLastPropertyMessage
+   */
+  uint32_t* FindLastPropertyMessage(const void* property, const void* messageTypeId) override;
+
   using SceneContainer = std::vector<ScenePtr>;
 
   /**
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/environment-variable.h>
+
+// EXTERNAL INCLUDES
+#include <cstdlib>
+
+namespace Dali::Internal::EnvironmentVariable
+{
+std::optional<std::string> GetValue(const char* variableName)
+{
+#if defined(_MSC_VER)
+  char*       value  = nullptr;
+  std::size_t length = 0u;
+  if(_dupenv_s(&value, &length, variableName) != 0 || value == nullptr)
+  {
+    return std::nullopt;
+  }
+
+  std::string result(value);
+  std::free(value);
+  return result;
+#else
+  const char* value = std::getenv(variableName);
+  return value ? std::optional<std::string>(value) : std::nullopt;
+#endif
+}
+
+uint32_t GetUnsignedIntegerValue(const char* variableName, uint32_t defaultValue)
+{
+  const auto environmentVariableValue = GetValue(variableName);
+  if(environmentVariableValue)
+  {
+    const int value = std::atoi(environmentVariableValue->c_str());
+    if(value >= 0)
+    {
+      return static_cast<uint32_t>(value);
+    }
+  }
+  return defaultValue;
+}
+
+bool GetBooleanValue(const char* variableName, bool defaultValue)
+{
+  const auto environmentVariableValue = GetValue(variableName);
+  return environmentVariableValue ? std::atoi(environmentVariableValue->c_str()) != 0 : defaultValue;
+}
+
+} // namespace Dali::Internal::EnvironmentVariable
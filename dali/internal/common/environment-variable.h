@@ -0,0 +1,61 @@
+#ifndef DALI_INTERNAL_ENVIRONMENT_VARIABLE_H
+#define DALI_INTERNAL_ENVIRONMENT_VARIABLE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace EnvironmentVariable
+{
+/**
+ * @brief Gets the value of an environment variable.
+ * @param[in] variableName The name of the variable
+ * @return The value, or std::nullopt if the variable is not set
+ */
+std::optional<std::string> GetValue(const char* variableName);
+
+/**
+ * @brief Gets the value of an environment variable as an unsigned integer.
+ * @param[in] variableName The name of the variable
+ * @param[in] defaultValue The value returned if the variable is not set, or is negative
+ * @return The value of the variable, or the default value
+ */
+uint32_t GetUnsignedIntegerValue(const char* variableName, uint32_t defaultValue);
+
+/**
+ * @brief Gets the value of an environment variable as a boolean, which is true for any non-zero integer.
+ * @param[in] variableName The name of the variable
+ * @param[in] defaultValue The value returned if the variable is not set
+ * @return The value of the variable, or the default value
+ */
+bool GetBooleanValue(const char* variableName, bool defaultValue);
+
+} // namespace EnvironmentVariable
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ENVIRONMENT_VARIABLE_H
@@ -22,6 +22,10 @@
 #include <cstdint> // uint32_t
 #include <cstring> // memcpy
 
+#if defined(__SSE2__)
+#include <emmintrin.h> // SSE2 intrinsics, always available on x86-64
+#endif
+
 // INTERNAL INCLUDE
 #include <dali/internal/render/common/performance-monitor.h>
 #include <dali/public-api/math/matrix.h>
@@ -33,6 +37,112 @@ namespace
 const uint32_t NUM_BYTES_IN_MATRIX(16 * sizeof(float));
 const uint32_t NUM_BYTES_IN_MATRIX3(9 * sizeof(float));
 
+#if defined(__SSE2__)
+
+// The SSE kernels keep the order of the scalar operations, so their results are same as the scalar ones.
+// All the result columns are calculated before they are stored, so the result can be same matrix as an input.
+
+/**
+ * @brief Calculates a result column, i.e. the columns of rhs weighted by the 4 values of a lhs column.
+ */
+inline __m128 CombineColumns(const float* lhsColumn, __m128 rhs0, __m128 rhs1, __m128 rhs2, __m128 rhs3)
+{
+  __m128 column = _mm_mul_ps(rhs0, _mm_set1_ps(lhsColumn[0]));
+  column        = _mm_add_ps(column, _mm_mul_ps(rhs1, _mm_set1_ps(lhsColumn[1])));
+  column        = _mm_add_ps(column, _mm_mul_ps(rhs2, _mm_set1_ps(lhsColumn[2])));
+  return _mm_add_ps(column, _mm_mul_ps(rhs3, _mm_set1_ps(lhsColumn[3])));
+}
+
+/**
+ * @brief Calculates a result column from the first 3 values of a lhs column.
+ */
+inline __m128 CombineColumns(const float* lhsColumn, __m128 rhs0, __m128 rhs1, __m128 rhs2)
+{
+  __m128 column = _mm_mul_ps(rhs0, _mm_set1_ps(lhsColumn[0]));
+  column        = _mm_add_ps(column, _mm_mul_ps(rhs1, _mm_set1_ps(lhsColumn[1])));
+  return _mm_add_ps(column, _mm_mul_ps(rhs2, _mm_set1_ps(lhsColumn[2])));
+}
+
+inline __m128 XyzMask()
+{
+  return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+}
+
+inline __m128 ZwMask()
+{
+  return _mm_castsi128_ps(_mm_set_epi32(-1, -1, 0, 0));
+}
+
+inline void StoreColumns(float* result, __m128 column0, __m128 column1, __m128 column2, __m128 column3)
+{
+  _mm_storeu_ps(result, column0);
+  _mm_storeu_ps(result + 4, column1);
+  _mm_storeu_ps(result + 8, column2);
+  _mm_storeu_ps(result + 12, column3);
+}
+
+/**
+ * @brief result = rhs * lhs, for any matrices
+ */
+inline void MultiplySse(float* result, const float* lhs, const float* rhs)
+{
+  const __m128 rhs0 = _mm_loadu_ps(rhs);
+  const __m128 rhs1 = _mm_loadu_ps(rhs + 4);
+  const __m128 rhs2 = _mm_loadu_ps(rhs + 8);
+  const __m128 rhs3 = _mm_loadu_ps(rhs + 12);
+
+  StoreColumns(result,
+               CombineColumns(lhs, rhs0, rhs1, rhs2, rhs3),
+               CombineColumns(lhs + 4, rhs0, rhs1, rhs2, rhs3),
+               CombineColumns(lhs + 8, rhs0, rhs1, rhs2, rhs3),
+               CombineColumns(lhs + 12, rhs0, rhs1, rhs2, rhs3));
+}
+
+/**
+ * @brief result = rhs * lhs, for transform matrices. See MatrixUtils::MultiplyTransformMatrix
+ */
+inline void MultiplyTransformMatrixSse(float* result, const float* lhs, const float* rhs)
+{
+  const __m128 rhs0 = _mm_loadu_ps(rhs);
+  const __m128 rhs1 = _mm_loadu_ps(rhs + 4);
+  const __m128 rhs2 = _mm_loadu_ps(rhs + 8);
+  const __m128 rhs3 = _mm_loadu_ps(rhs + 12);
+  const __m128 mask = XyzMask();
+
+  // The 4th row is always (0, 0, 0, 1)
+  StoreColumns(result,
+               _mm_and_ps(CombineColumns(lhs, rhs0, rhs1, rhs2), mask),
+               _mm_and_ps(CombineColumns(lhs + 4, rhs0, rhs1, rhs2), mask),
+               _mm_and_ps(CombineColumns(lhs + 8, rhs0, rhs1, rhs2), mask),
+               _mm_or_ps(_mm_and_ps(_mm_add_ps(CombineColumns(lhs + 12, rhs0, rhs1, rhs2), rhs3), mask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+}
+
+/**
+ * @brief result = projection * lhs. See MatrixUtils::MultiplyProjectionMatrix
+ */
+inline void MultiplyProjectionMatrixSse(float* result, const float* lhs, __m128 projection0, __m128 projection1, __m128 projection2, __m128 projection3)
+{
+  StoreColumns(result,
+               CombineColumns(lhs, projection0, projection1, projection2),
+               CombineColumns(lhs + 4, projection0, projection1, projection2),
+               CombineColumns(lhs + 8, projection0, projection1, projection2),
+               _mm_add_ps(CombineColumns(lhs + 12, projection0, projection1, projection2), projection3));
+}
+
+/**
+ * @brief Loads the values of the projection matrix used by MultiplyProjectionMatrix, and zeroes the others.
+ */
+inline void LoadProjectionMatrixSse(const float* projection, __m128& projection0, __m128& projection1, __m128& projection2, __m128& projection3)
+{
+  // We only use projection's 0, 1, 2, 4, 5, 6, 10, 11, 14, 15 index.
+  projection0 = _mm_and_ps(_mm_loadu_ps(projection), XyzMask());
+  projection1 = _mm_and_ps(_mm_loadu_ps(projection + 4), XyzMask());
+  projection2 = _mm_and_ps(_mm_loadu_ps(projection + 8), ZwMask());
+  projection3 = _mm_and_ps(_mm_loadu_ps(projection + 12), ZwMask());
+}
+
+#endif
+
 } // namespace
 
 namespace Dali::Internal
@@ -91,7 +201,11 @@ void Multiply(Dali::Matrix& result, const Dali::Matrix& lhs, const Dali::Matrix&
   const float* rhsPtr = rhs.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#if !defined(__ARM_NEON__) || defined(__APPLE__)
+#if defined(__SSE2__)
+
+  MultiplySse(temp, lhsPtr, rhsPtr);
+
+#elif !defined(__ARM_NEON__) || defined(__APPLE__)
 
   for(int32_t i = 0; i < 4; i++)
   {
@@ -181,7 +295,11 @@ void Multiply(Dali::Matrix& result, const Dali::Matrix& lhs, const Dali::Quatern
   float*       temp   = result.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#if !defined(__ARM_NEON__) || defined(__APPLE__)
+#if defined(__SSE2__)
+
+  MultiplySse(temp, lhsPtr, rhsPtr);
+
+#elif !defined(__ARM_NEON__) || defined(__APPLE__)
 
   for(int32_t i = 0; i < 4; i++)
   {
@@ -271,7 +389,11 @@ void MultiplyTransformMatrix(Dali::Matrix& result, const Dali::Matrix& lhs, cons
   const float* rhsPtr = rhs.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#if !defined(__ARM_NEON__) || defined(__APPLE__)
+#if defined(__SSE2__)
+
+  MultiplyTransformMatrixSse(temp, lhsPtr, rhsPtr);
+
+#elif !defined(__ARM_NEON__) || defined(__APPLE__)
 
   for(int32_t i = 0; i < 4; i++)
   {
@@ -351,7 +473,13 @@ void MultiplyProjectionMatrix(Dali::Matrix& result, const Dali::Matrix& lhs, con
   const float* rhsPtr = projection.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#if !defined(__ARM_NEON__) || defined(__APPLE__)
+#if defined(__SSE2__)
+
+  __m128 projection0, projection1, projection2, projection3;
+  LoadProjectionMatrixSse(rhsPtr, projection0, projection1, projection2, projection3);
+  MultiplyProjectionMatrixSse(temp, lhsPtr, projection0, projection1, projection2, projection3);
+
+#elif !defined(__ARM_NEON__) || defined(__APPLE__)
 
   // We only use rhsPtr's 0, 1, 2, 4, 5, 6, 10, 11, 14, 15 index.
   const float rhs0  = rhsPtr[0];
@@ -428,7 +556,14 @@ void MultiplyAssign(Dali::Matrix& result, const Dali::Matrix& rhs)
   MATH_INCREASE_COUNTER(PerformanceMonitor::MATRIX_MULTIPLYS);
   MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY, 64); // 64 = 16*4
 
-#if !defined(__ARM_NEON__) || defined(__APPLE__)
+#if defined(__SSE2__)
+
+  // result = result * rhs, i.e. the columns of result weighted by the columns of rhs.
+  float*       resultPtr = result.AsFloat();
+  const float* rhsPtr    = rhs.AsFloat();
+  MultiplySse(resultPtr, rhsPtr, resultPtr);
+
+#elif !defined(__ARM_NEON__) || defined(__APPLE__)
 
   float*       lhsPtr = result.AsFloat();
   const float* rhsPtr = rhs.AsFloat();
@@ -530,6 +665,34 @@ void MultiplyAssign(Dali::Matrix& result, const Dali::Matrix& rhs)
 #endif
 }
 
+// Batched Dali::Matrix
+
+void MultiplyProjectionMatrices(Dali::Matrix* results, const Dali::Matrix* const* lhs, const Dali::Matrix& projection, uint32_t count)
+{
+#if defined(__SSE2__)
+
+  MATH_INCREASE_BY(PerformanceMonitor::MATRIX_MULTIPLYS, count);
+  MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY, 32 * count); // 32 = 8*4
+
+  // The projection stays in the registers for all the matrices
+  __m128 projection0, projection1, projection2, projection3;
+  LoadProjectionMatrixSse(projection.AsFloat(), projection0, projection1, projection2, projection3);
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    MultiplyProjectionMatrixSse(results[i].AsFloat(), lhs[i]->AsFloat(), projection0, projection1, projection2, projection3);
+  }
+
+#else
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    MultiplyProjectionMatrix(results[i], *lhs[i], projection);
+  }
+
+#endif
+}
+
 // Dali::Matrix3
 
 void Multiply(Dali::Matrix3& result, const Dali::Matrix3& lhs, const Dali::Matrix3& rhs)
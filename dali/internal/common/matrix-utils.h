@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstdint> // uint32_t
+
 namespace Dali
 {
 class Matrix;
@@ -108,6 +111,24 @@ void MultiplyProjectionMatrix(Dali::Matrix& result, const Dali::Matrix& lhs, con
  */
 void MultiplyAssign(Dali::Matrix& result, const Dali::Matrix& rhs);
 
+// Batched Matrix
+
+/**
+ * @brief Function to multiply many transform matrices by the same projection matrix.
+ *
+ * results[i] = projection * (*lhs[i])
+ *
+ * e.g. model view projection matrices of render items, from their model view matrices.
+ *
+ * @SINCE_2_5.37
+ * @param[out] results Array of count results of the multiplication
+ * @param[in] lhs Array of count pointers to Transform Matrices, these cannot be same matrices as results
+ * @param[in] projection Projection Matrix
+ * @param[in] count The number of matrices to multiply
+ * @see MultiplyProjectionMatrix
+ */
+void MultiplyProjectionMatrices(Dali::Matrix* results, const Dali::Matrix* const* lhs, const Dali::Matrix& projection, uint32_t count);
+
 // Matrix3
 
 /**
@@ -60,6 +60,27 @@ public:
    */
   std::size_t GetCapacity() const;
 
+  /**
+   * Query the offset of a slot returned by ReserveMessageSlot().
+   * Unlike the slot itself, the offset remains valid when the buffer grows, until Reset() is called.
+   * @param[in] slot The slot
+   * @return The offset with respect to sizeof(WordType)
+   */
+  std::size_t GetSlotOffset(const uint32_t* slot) const
+  {
+    return static_cast<std::size_t>(reinterpret_cast<const WordType*>(slot) - mData);
+  }
+
+  /**
+   * Retrieve a slot from its offset.
+   * @param[in] offset The offset returned by GetSlotOffset()
+   * @return A pointer to the slot
+   */
+  uint32_t* GetSlot(std::size_t offset) const
+  {
+    return reinterpret_cast<uint32_t*>(mData + offset);
+  }
+
   /**
    * Used to iterate though the messages in the buffer.
    */
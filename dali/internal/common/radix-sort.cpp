@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/common/radix-sort.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace
+{
+constexpr uint32_t DIGIT_BITS     = 8u;
+constexpr uint32_t DIGIT_VALUES   = 1u << DIGIT_BITS;
+constexpr uint32_t DIGITS_PER_KEY = 64u / DIGIT_BITS;
+constexpr uint32_t PASS_COUNT     = DIGITS_PER_KEY * 2u; ///< The digits of the secondary key, then of the primary key
+
+inline uint32_t GetDigit(const RadixSortItem& item, uint32_t pass)
+{
+  const uint64_t key = pass < DIGITS_PER_KEY ? item.secondaryKey : item.primaryKey;
+  return static_cast<uint32_t>(key >> ((pass % DIGITS_PER_KEY) * DIGIT_BITS)) & (DIGIT_VALUES - 1u);
+}
+
+} // namespace
+
+void RadixSort(std::vector<RadixSortItem>& items, std::vector<RadixSortItem>& buffer)
+{
+  const uint32_t count = static_cast<uint32_t>(items.size());
+  if(count < 2u)
+  {
+    return;
+  }
+  buffer.resize(count);
+
+  // Count the digits of every pass at once, so the constant digits can be skipped.
+  uint32_t histograms[PASS_COUNT][DIGIT_VALUES];
+  std::memset(histograms, 0, sizeof(histograms));
+  for(const auto& item : items)
+  {
+    for(uint32_t pass = 0u; pass < PASS_COUNT; ++pass)
+    {
+      ++histograms[pass][GetDigit(item, pass)];
+    }
+  }
+
+  RadixSortItem* source      = items.data();
+  RadixSortItem* destination = buffer.data();
+  for(uint32_t pass = 0u; pass < PASS_COUNT; ++pass)
+  {
+    uint32_t* histogram = histograms[pass];
+    if(histogram[GetDigit(source[0], pass)] == count)
+    {
+      continue;
+    }
+
+    uint32_t offset = 0u;
+    for(uint32_t digit = 0u; digit < DIGIT_VALUES; ++digit)
+    {
+      const uint32_t digitCount = histogram[digit];
+      histogram[digit]          = offset;
+      offset += digitCount;
+    }
+
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      destination[histogram[GetDigit(source[i], pass)]++] = source[i];
+    }
+    std::swap(source, destination);
+  }
+
+  if(source != items.data())
+  {
+    items.swap(buffer);
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,69 @@
+#ifndef DALI_INTERNAL_RADIX_SORT_H
+#define DALI_INTERNAL_RADIX_SORT_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint> // uint32_t, uint64_t
+#include <cstring> // memcpy
+#include <vector>
+
+namespace Dali
+{
+namespace Internal
+{
+/**
+ * @brief An item to sort with RadixSort, ordered by its primary key, then by its secondary key.
+ */
+struct RadixSortItem
+{
+  uint64_t primaryKey;   ///< The most significant part of the key
+  uint64_t secondaryKey; ///< Orders the items with the same primary key
+  uint32_t index;        ///< Index of the sorted object, not used by the sort
+};
+
+/**
+ * @brief Sorts the items by their keys, keeping the order of the items with equal keys.
+ *
+ * This is a least significant digit radix sort, which runs one pass per byte of the keys.
+ * The passes of the bytes that are the same for every item are skipped.
+ *
+ * @param[in,out] items The items to sort
+ * @param[in,out] buffer Scratch memory, resized as needed. May be swapped with items.
+ */
+void RadixSort(std::vector<RadixSortItem>& items, std::vector<RadixSortItem>& buffer);
+
+/**
+ * @brief Converts a float to an unsigned integer with the same ordering.
+ * @param[in] value The value to convert
+ * @return The ordered bits of the value
+ */
+inline uint32_t FloatToOrderedBits(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  // Negative values are ordered backwards, and before the positive ones.
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RADIX_SORT_H
@@ -23,6 +23,7 @@
 #include <string_view>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/rendering/shader-devel.h> // DevelShader::Hint
 #include <dali/graphics-api/graphics-types.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
@@ -129,6 +130,14 @@ public:
     return mHints & hint;
   }
 
+  /**
+   * @copydoc HintEnabled(Dali::Shader::Hint::Value) const
+   */
+  [[nodiscard]] bool HintEnabled(Dali::DevelShader::Hint::Value hint) const
+  {
+    return mHints & hint;
+  }
+
 protected:
   /**
    * Protected Destructor
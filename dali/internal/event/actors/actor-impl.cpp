@@ -1003,9 +1003,9 @@ void Actor::SetChildrenDepthIndexPolicy(DevelActor::ChildrenDepthIndexPolicy::Ty
 {
   mChildrenDepthIndexPolicy = childrenDepthIndexPolicy;
   RequestRenderTaskReorder();
-  if(mScene)
+  if(OnScene())
   {
-    mScene->RequestRebuildDepthTree();
+    mParentImpl.RequestDepthTreeUpdate(true);
   }
 }
 
@@ -1024,12 +1024,12 @@ void Actor::SetDepthIndex(int32_t depthIndex)
   }
   mDepthIndex = depthIndex;
 
-  // Draw order changed: rebuild the depth tree. Note we do NOT touch mChildren,
+  // Draw order changed: move this actor in the depth tree. Note we do NOT touch mChildren,
   // so sibling order / GetChildAt() are unaffected.
   RequestRenderTaskReorder();
-  if(mScene)
+  if(OnScene())
   {
-    mScene->RequestRebuildDepthTree();
+    mParentImpl.RequestDepthTreeUpdate(true);
   }
 }
 
@@ -1732,14 +1732,12 @@ void Actor::ConnectToScene(uint32_t parentDepth, uint32_t layer3DParentsCount, b
   // It protects us when the Actor hierarchy is modified during OnSceneConnectionExternal callbacks.
   ActorContainer connectionList;
 
-  if(mScene)
-  {
-    mScene->RequestRebuildDepthTree();
-  }
-
   // This scene is not interrupted by user callbacks.
   mParentImpl.RecursiveConnectToScene(connectionList, layer3DParentsCount, parentDepth + 1);
 
+  // Only the new subtree is numbered in the depth tree
+  mParentImpl.RequestDepthTreeUpdate(true);
+
   // Notify applications about the newly connected actors.
   for(const auto& actor : connectionList)
   {
@@ -1801,11 +1799,6 @@ void Actor::DisconnectFromScene(bool notify)
   // It protects us when the Actor hierachy is modified during OnSceneDisconnectionExternal callbacks.
   ActorContainer disconnectionList;
 
-  if(mScene)
-  {
-    mScene->RequestRebuildDepthTree();
-  }
-
   // This scene is not interrupted by user callbacks
   mParentImpl.RecursiveDisconnectFromScene(disconnectionList);
 
@@ -1872,13 +1865,37 @@ void Actor::RebuildDepthTree()
   // in a single message
   OwnerPointer<SceneGraph::NodeDepths> sceneGraphNodeDepths(new SceneGraph::NodeDepths());
 
-  int32_t depthIndex = 1;
-  mParentImpl.DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex);
+  mParentImpl.RebuildDepthTree(sceneGraphNodeDepths);
 
   SetDepthIndicesMessage(GetEventThreadServices().GetUpdateManager(), sceneGraphNodeDepths);
   DALI_LOG_TIMER_END(depthTimer, gLogFilter, Debug::Concise, "Depth tree traversal time: ");
 }
 
+// This method only renumbers the subtrees which changed since the depth
+// tree was last built, within the gaps left between the depth indices,
+// and only sends the nodes whose depth changed with their ancestors.
+void Actor::UpdateDepthTree()
+{
+  if(!mParentImpl.IsDepthTreeUpdateRequired())
+  {
+    return;
+  }
+
+  DALI_LOG_TIMER_START(depthTimer);
+
+  OwnerPointer<SceneGraph::NodeDepths> sceneGraphNodeDepths(new SceneGraph::NodeDepths());
+  if(!mParentImpl.UpdateDepthTree(sceneGraphNodeDepths))
+  {
+    RebuildDepthTree();
+    return;
+  }
+
+  DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Depth tree updated, %zu nodes sent\n", sceneGraphNodeDepths->nodeDepths.size());
+
+  SetDepthIndicesMessage(GetEventThreadServices().GetUpdateManager(), sceneGraphNodeDepths);
+  DALI_LOG_TIMER_END(depthTimer, gLogFilter, Debug::Concise, "Depth tree update time: ");
+}
+
 void Actor::EmitOnSceneVisibilityChangedSignalRecursively(bool visible)
 {
   ActorContainer effectiveVisibilityActors;
@@ -2021,6 +2038,17 @@ void Actor::SetLayoutDirection(LayoutDirection::Type direction)
   }
 }
 
+void Actor::SetTouchHitAreaMargin(const Extents& extents)
+{
+  mTouchHitAreaMargin = extents;
+
+  if(mScene)
+  {
+    // The bounds of the hit-test index include the margin
+    mScene->RequestRebuildHitTestIndices();
+  }
+}
+
 void Actor::SetInheritLayoutDirectionEnabled(bool inherit)
 {
   if(mInheritLayoutDirection != inherit)
@@ -2107,6 +2135,9 @@ void Actor::SetParent(ActorParent* parent, bool notify)
     {
       emitOnSceneVisible = CalculateActorOnSceneVisible(*this);
       visiblility        = false;
+
+      // The remaining actors keep their depth, but the parent's node is sent with the depth tree
+      static_cast<Actor*>(mParent)->mParentImpl.RequestDepthTreeUpdate(false);
     }
 
     mParent = nullptr;
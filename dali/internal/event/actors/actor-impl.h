@@ -1747,10 +1747,7 @@ public:
    * Sets the touch hit area margin of an actor.
    * @param [in] offset The new extents of area.
    */
-  void SetTouchHitAreaMargin(const Extents& extents)
-  {
-    mTouchHitAreaMargin = extents;
-  }
+  void SetTouchHitAreaMargin(const Extents& extents);
 
   /**
    * Retrieve the Actor's touch hit area margin.
@@ -2208,6 +2205,13 @@ public:
    */
   void RebuildDepthTree();
 
+  /**
+   * Updates the actor depth tree from this root, if it changed since it was last built.
+   * Only the changed subtrees are renumbered, and only the nodes whose depth changed are sent to the update thread;
+   * falls back to RebuildDepthTree() when the gaps between the depth indices are exhausted.
+   */
+  void UpdateDepthTree();
+
   /**
    * Emits the on-scene visibility change signal for this actor and all its effectively visible children.
    * @param[in] visible The new on-scene visibility flag.
@@ -27,6 +27,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <limits>
 
 namespace Dali
 {
@@ -34,6 +35,19 @@ namespace Internal
 {
 namespace
 {
+constexpr int32_t DEPTH_INDEX_GAP      = 16;                                                                             ///< The increment of the depth index between consecutive actors when the depth tree is rebuilt
+constexpr int32_t FIRST_DEPTH_INDEX    = 1;                                                                              ///< The depth index of the root actor
+constexpr int32_t MAXIMUM_DEPTH_INDEX  = std::numeric_limits<int32_t>::max() / DevelLayer::SIBLING_ORDER_MULTIPLIER - 1; ///< Keeps the sorted depths, plus the depth index of the renderers, in the range of int32_t
+constexpr int32_t DEPTH_TREE_RANGE_END = MAXIMUM_DEPTH_INDEX + 1;                                                        ///< The end of the range of the root actor
+
+/**
+ * Retrieves the depth index of an actor, i.e. its sorted depth without the sibling order multiplier.
+ */
+int32_t GetDepthTreeIndex(Actor& actor)
+{
+  return static_cast<int32_t>(actor.GetSortingDepth() / DevelLayer::SIBLING_ORDER_MULTIPLIER);
+}
+
 /// Helper for emitting signals with multiple parameters
 template<typename Signal, typename... Param>
 void EmitSignal(Actor& actor, Signal& signal, Param... params)
@@ -539,11 +553,62 @@ void ActorParentImpl::InsertChild(Actor& child, Actor& target, bool above)
   EmitOrderChangedAndRebuild(child);
 }
 
+void ActorParentImpl::RebuildDepthTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths)
+{
+  int32_t depthIndex = FIRST_DEPTH_INDEX;
+  DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex, DEPTH_INDEX_GAP, false);
+
+  if(DALI_UNLIKELY(depthIndex > MAXIMUM_DEPTH_INDEX))
+  {
+    // Too many actors to leave gaps between them; spread them over the whole range instead
+    const int32_t stepCount = (depthIndex - FIRST_DEPTH_INDEX) / DEPTH_INDEX_GAP;
+    const int32_t step      = std::max(1, (MAXIMUM_DEPTH_INDEX - FIRST_DEPTH_INDEX) / stepCount);
+
+    sceneGraphNodeDepths->nodeDepths.clear();
+    depthIndex = FIRST_DEPTH_INDEX;
+    DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex, step, false);
+  }
+}
+
+bool ActorParentImpl::UpdateDepthTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths)
+{
+  if(mDepthTreeDirty || GetDepthTreeIndex(mOwner) != FIRST_DEPTH_INDEX || !PrepareDepthSubtreeUpdate(DEPTH_TREE_RANGE_END))
+  {
+    return false;
+  }
+
+  UpdateDepthSubtree(sceneGraphNodeDepths, DEPTH_TREE_RANGE_END);
+  return true;
+}
+
+void ActorParentImpl::RequestDepthTreeUpdate(bool renumber)
+{
+  mDepthTreeDirty          = mDepthTreeDirty || renumber;
+  mDepthTreeUpdateRequired = true;
+
+  // The hit-test indices follow the same render order
+  if(mOwner.mScene)
+  {
+    mOwner.mScene->RequestRebuildHitTestIndices();
+  }
+
+  // Mark the path to the root, so that the update only visits the changed subtrees
+  for(Actor* parent = mOwner.GetParent(); parent && !parent->mParentImpl.mDepthTreeUpdateRequired; parent = parent->GetParent())
+  {
+    parent->mParentImpl.mDepthTreeUpdateRequired = true;
+  }
+}
+
 void ActorParentImpl::DepthTraverseActorTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths,
-                                             int32_t&                              depthIndex)
+                                             int32_t&                              depthIndex,
+                                             int32_t                               step,
+                                             bool                                  changedOnly)
 {
-  uint32_t sortedDepth = depthIndex * DevelLayer::SIBLING_ORDER_MULTIPLIER;
+  uint32_t   sortedDepth = depthIndex * DevelLayer::SIBLING_ORDER_MULTIPLIER;
+  const bool changed     = (sortedDepth != mOwner.GetSortingDepth());
   mOwner.SetSortingDepth(sortedDepth);
+
+  const auto nodeDepthCount = sceneGraphNodeDepths->nodeDepths.size();
   sceneGraphNodeDepths->Add(const_cast<SceneGraph::Node*>(&mOwner.GetNode()), sortedDepth);
 
   // Create/add to children of this node
@@ -558,23 +623,189 @@ void ActorParentImpl::DepthTraverseActorTree(OwnerPointer<SceneGraph::NodeDepths
     {
       for(const auto& child : orderedChildren)
       {
-        ++depthIndex;
-        child->mParentImpl.DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex);
+        depthIndex += step;
+        child->mParentImpl.DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex, step, changedOnly);
       }
     }
     else
     {
       int32_t       maxDepthIndex   = depthIndex;
-      const int32_t childDepthIndex = ++depthIndex;
+      const int32_t childDepthIndex = depthIndex + step;
       for(const auto& child : orderedChildren)
       {
         depthIndex = childDepthIndex;
-        child->mParentImpl.DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex);
+        child->mParentImpl.DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex, step, changedOnly);
         maxDepthIndex = Max(maxDepthIndex, depthIndex);
       }
       depthIndex = maxDepthIndex;
     }
   }
+
+  // An unchanged node is still captured if a descendant is, so that the update thread reorders its children,
+  // or if its children were removed, so that the update thread propagates the hierarchy change.
+  if(changedOnly && !changed && !mDepthTreeUpdateRequired && sceneGraphNodeDepths->nodeDepths.size() == nodeDepthCount + 1u)
+  {
+    sceneGraphNodeDepths->nodeDepths.pop_back();
+  }
+
+  mDepthTreeEnd            = depthIndex;
+  mDepthTreeDirty          = false;
+  mDepthTreeUpdateRequired = false;
+}
+
+int32_t ActorParentImpl::GetDepthTreeStepCount() const
+{
+  int32_t stepCount = 0;
+  if(mChildren && !mChildren->empty())
+  {
+    // Same as DepthTraverseActorTree(); the order of the children does not change the count
+    if(mOwner.GetChildrenDepthIndexPolicy() == DevelActor::ChildrenDepthIndexPolicy::INCREASE)
+    {
+      for(const auto& child : *mChildren)
+      {
+        stepCount += 1 + child->mParentImpl.GetDepthTreeStepCount();
+      }
+    }
+    else
+    {
+      int32_t maxChildStepCount = 0;
+      for(const auto& child : *mChildren)
+      {
+        maxChildStepCount = Max(maxChildStepCount, child->mParentImpl.GetDepthTreeStepCount());
+      }
+      stepCount = 1 + maxChildStepCount;
+    }
+  }
+  return stepCount;
+}
+
+bool ActorParentImpl::PrepareDepthSubtreeUpdate(int32_t rangeEnd)
+{
+  if(!mChildren)
+  {
+    return true;
+  }
+
+  const ActorContainer& orderedChildren = HasNonZeroDepthIndexChildren() ? GetChildrenInDepthOrder() : *mChildren;
+  const std::size_t     childCount      = orderedChildren.size();
+
+  if(mOwner.GetChildrenDepthIndexPolicy() != DevelActor::ChildrenDepthIndexPolicy::INCREASE)
+  {
+    // The subtrees of the children overlap, so they are renumbered together
+    return std::none_of(orderedChildren.begin(), orderedChildren.end(), [](const ActorPtr& child)
+                        { return child->mParentImpl.mDepthTreeUpdateRequired; });
+  }
+
+  // Update the unchanged children within their own range, or renumber them with their changed siblings
+  for(std::size_t index = 0u; index < childCount; ++index)
+  {
+    auto& childImpl = orderedChildren[index]->mParentImpl;
+    if(childImpl.mDepthTreeUpdateRequired && !childImpl.mDepthTreeDirty &&
+       !childImpl.PrepareDepthSubtreeUpdate(GetChildDepthRangeEnd(orderedChildren, index, rangeEnd)))
+    {
+      childImpl.mDepthTreeDirty = true;
+    }
+  }
+
+  // Check that each run of changed siblings fits between its unchanged siblings
+  int32_t rangeBegin = GetDepthTreeIndex(mOwner) + 1;
+  for(std::size_t index = 0u; index < childCount;)
+  {
+    const auto& childImpl = orderedChildren[index]->mParentImpl;
+    if(!childImpl.mDepthTreeDirty)
+    {
+      rangeBegin = childImpl.mDepthTreeEnd + 1;
+      ++index;
+      continue;
+    }
+
+    int32_t depthIndexCount = 0;
+    for(; index < childCount && orderedChildren[index]->mParentImpl.mDepthTreeDirty; ++index)
+    {
+      depthIndexCount += 1 + orderedChildren[index]->mParentImpl.GetDepthTreeStepCount();
+    }
+
+    const int32_t runRangeEnd = (index < childCount) ? GetDepthTreeIndex(*orderedChildren[index]) : rangeEnd;
+    if(depthIndexCount > runRangeEnd - rangeBegin)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ActorParentImpl::UpdateDepthSubtree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths, int32_t rangeEnd)
+{
+  // The depth index of this actor does not change, but its node is captured so that the update thread
+  // reorders its children, and propagates the hierarchy change.
+  sceneGraphNodeDepths->Add(const_cast<SceneGraph::Node*>(&mOwner.GetNode()), mOwner.GetSortingDepth());
+
+  mDepthTreeEnd = GetDepthTreeIndex(mOwner);
+  if(mChildren)
+  {
+    const ActorContainer& orderedChildren = HasNonZeroDepthIndexChildren() ? GetChildrenInDepthOrder() : *mChildren;
+    const std::size_t     childCount      = orderedChildren.size();
+
+    int32_t rangeBegin = mDepthTreeEnd + 1;
+    for(std::size_t index = 0u; index < childCount;)
+    {
+      auto& childImpl = orderedChildren[index]->mParentImpl;
+      if(!childImpl.mDepthTreeDirty)
+      {
+        if(childImpl.mDepthTreeUpdateRequired)
+        {
+          childImpl.UpdateDepthSubtree(sceneGraphNodeDepths, GetChildDepthRangeEnd(orderedChildren, index, rangeEnd));
+        }
+        rangeBegin = childImpl.mDepthTreeEnd + 1;
+        ++index;
+        continue;
+      }
+
+      // Renumber the run of changed siblings, spread within the gap left by their unchanged siblings
+      const std::size_t firstIndex      = index;
+      int32_t           depthIndexCount = 0;
+      for(; index < childCount && orderedChildren[index]->mParentImpl.mDepthTreeDirty; ++index)
+      {
+        depthIndexCount += 1 + orderedChildren[index]->mParentImpl.GetDepthTreeStepCount();
+      }
+
+      const int32_t runRangeEnd = (index < childCount) ? GetDepthTreeIndex(*orderedChildren[index]) : rangeEnd;
+      const int32_t freeCount   = runRangeEnd - rangeBegin;
+      const int32_t step        = Clamp(freeCount / (depthIndexCount + 1), 1, DEPTH_INDEX_GAP);
+      const int32_t usedCount   = (depthIndexCount - 1) * step + 1;
+
+      int32_t depthIndex = rangeBegin + std::min(step - 1, (freeCount - usedCount) / 2);
+      for(std::size_t runIndex = firstIndex; runIndex < index; ++runIndex)
+      {
+        orderedChildren[runIndex]->mParentImpl.DepthTraverseActorTree(sceneGraphNodeDepths, depthIndex, step, true);
+        depthIndex += step;
+      }
+      rangeBegin = orderedChildren[index - 1u]->mParentImpl.mDepthTreeEnd + 1;
+    }
+
+    if(childCount > 0u)
+    {
+      mDepthTreeEnd = orderedChildren.back()->mParentImpl.mDepthTreeEnd;
+    }
+  }
+
+  mDepthTreeUpdateRequired = false;
+}
+
+int32_t ActorParentImpl::GetChildDepthRangeEnd(const ActorContainer& children, std::size_t index, int32_t rangeEnd) const
+{
+  if(index + 1u == children.size())
+  {
+    return rangeEnd;
+  }
+
+  // The next sibling may be renumbered right after the end of this subtree, which can not grow then
+  auto& nextSibling = *children[index + 1u];
+  if(nextSibling.mParentImpl.mDepthTreeUpdateRequired)
+  {
+    return children[index]->mParentImpl.mDepthTreeEnd + 1;
+  }
+  return GetDepthTreeIndex(nextSibling);
 }
 
 const ActorContainer& ActorParentImpl::GetChildrenInDepthOrder()
@@ -661,6 +892,10 @@ void ActorParentImpl::RecursiveDisconnectFromScene(ActorContainer& disconnection
   mOwner.mScene               = nullptr;
   mOwner.mLayer3DParentsCount = 0;
 
+  // The subtree is renumbered when it is connected again
+  mDepthTreeDirty          = false;
+  mDepthTreeUpdateRequired = false;
+
   // Recursively disconnect children
   if(mChildren)
   {
@@ -787,7 +1022,8 @@ void ActorParentImpl::EmitOrderChangedAndRebuild(Actor& child)
 
   if(mOwner.OnScene())
   {
-    mOwner.GetScene().RequestRebuildDepthTree();
+    // Only the reordered child is moved in the depth tree
+    child.mParentImpl.RequestDepthTreeUpdate(true);
   }
 }
 
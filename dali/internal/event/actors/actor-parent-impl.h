@@ -205,13 +205,36 @@ public:
   }
 
   /**
-   * Traverse the actor tree, inserting actors into the depth tree in render order.
-   * @param[in] sceneGraphNodeDepths A vector capturing the nodes and their depth index
-   * @param[in,out] depthIndex The current depth index (traversal index)
-   * @note Children are visited in render order: ascending Property::DEPTH_INDEX, with ties
-   *       broken by sibling order. mChildren itself is never reordered.
+   * Renumbers the whole depth tree from this root actor, leaving gaps between the depth indices
+   * so that actors can be inserted later without renumbering the others.
+   * @param[in] sceneGraphNodeDepths A vector capturing every node and its depth index, in render order
    */
-  void DepthTraverseActorTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths, int32_t& depthIndex);
+  void RebuildDepthTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths);
+
+  /**
+   * Updates the depth tree from this root actor, renumbering only the subtrees changed since it was last built.
+   * Each changed subtree is renumbered within the gap left between its siblings; if the gap is too small,
+   * its parent's subtree is renumbered instead.
+   * @param[in] sceneGraphNodeDepths A vector capturing, in render order, the nodes whose depth index changed,
+   *                                 with their ancestors and the parents whose children changed
+   * @return False if the whole depth tree must be rebuilt instead
+   */
+  bool UpdateDepthTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths);
+
+  /**
+   * Requests that the depth tree is updated, e.g. after this actor is added or its render order changes.
+   * @param[in] renumber Whether the subtree of this actor must be renumbered; false if only its children were removed
+   */
+  void RequestDepthTreeUpdate(bool renumber);
+
+  /**
+   * Query whether the depth tree of this actor's subtree changed since it was last built.
+   * @return True if UpdateDepthTree() is required
+   */
+  bool IsDepthTreeUpdateRequired() const
+  {
+    return mDepthTreeUpdateRequired;
+  }
 
   /**
    * @brief Whether any direct child has a non-default (non-zero) Property::DEPTH_INDEX.
@@ -337,6 +360,47 @@ private:
    */
   void EmitOrderChangedAndRebuild(Actor& child);
 
+  /**
+   * Traverse the actor tree, inserting actors into the depth tree in render order.
+   * @param[in] sceneGraphNodeDepths A vector capturing the nodes and their depth index
+   * @param[in,out] depthIndex The current depth index (traversal index)
+   * @param[in] step The increment of the depth index between consecutive actors
+   * @param[in] changedOnly Whether to capture only the nodes whose depth index changes, with their ancestors
+   * @note Children are visited in render order: ascending Property::DEPTH_INDEX, with ties
+   *       broken by sibling order. mChildren itself is never reordered.
+   */
+  void DepthTraverseActorTree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths, int32_t& depthIndex, int32_t step, bool changedOnly);
+
+  /**
+   * Counts the increments of the depth index used by the subtree of this actor, excluding itself.
+   * @return The number of increments
+   */
+  int32_t GetDepthTreeStepCount() const;
+
+  /**
+   * Checks whether the changed descendants of this actor can be renumbered within the range of its subtree.
+   * The children which can not be updated within their own range are marked to be renumbered.
+   * @param[in] rangeEnd The first depth index after the range of the subtree
+   * @return False if the subtree of this actor must be renumbered instead
+   */
+  bool PrepareDepthSubtreeUpdate(int32_t rangeEnd);
+
+  /**
+   * Renumbers the changed descendants of this actor, once PrepareDepthSubtreeUpdate() succeeded.
+   * @param[in] sceneGraphNodeDepths A vector capturing the nodes and their depth index
+   * @param[in] rangeEnd The first depth index after the range of the subtree
+   */
+  void UpdateDepthSubtree(OwnerPointer<SceneGraph::NodeDepths>& sceneGraphNodeDepths, int32_t rangeEnd);
+
+  /**
+   * Retrieves the end of the range that the subtree of an unchanged child can use.
+   * @param[in] children The children in render order
+   * @param[in] index The index of the child
+   * @param[in] rangeEnd The first depth index after the range of this actor's subtree
+   * @return The first depth index after the range of the child's subtree
+   */
+  int32_t GetChildDepthRangeEnd(const ActorContainer& children, std::size_t index, int32_t rangeEnd) const;
+
 private:
   Dali::Internal::Actor&                  mOwner; ///* Owning actor
   Dali::Actor::ChildAddedSignalType       mChildAddedSignal;
@@ -345,7 +409,10 @@ private:
   ActorContainer*                         mChildren{nullptr};                 ///< Container of referenced actors, lazily initialized
   ActorContainer*                         mRenderOrderCache{nullptr};         ///< Cached children in render order, lazily allocated only when DEPTH_INDEX is used
   uint32_t                                mChildrenWithNonZeroDepthIndex{0u}; ///< Count of children whose Property::DEPTH_INDEX != 0, for the render-order fast path
+  int32_t                                 mDepthTreeEnd{0};                   ///< The last depth index used by the subtree of the actor
   bool                                    mRenderOrderCacheDirty{true};       ///< Whether mRenderOrderCache needs rebuilding
+  bool                                    mDepthTreeDirty{false};             ///< Whether the subtree must be renumbered when the depth tree is updated
+  bool                                    mDepthTreeUpdateRequired{false};    ///< Whether the actor or a descendant changed since the depth tree was last built
 };
 
 } // namespace Internal
@@ -32,6 +32,7 @@
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/event/common/property-helper.h>
 #include <dali/internal/event/common/scene-impl.h>
+#include <dali/internal/event/events/hit-test-index.h>
 
 #include <dali/internal/update/manager/update-manager.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
@@ -322,6 +323,15 @@ bool Layer::IsHoverConsumed() const
   return mHoverConsumed;
 }
 
+HitTestIndex* Layer::GetHitTestIndex()
+{
+  if(!mHitTestIndex)
+  {
+    mHitTestIndex = std::make_unique<HitTestIndex>();
+  }
+  return mHitTestIndex->Update(*this) ? mHitTestIndex.get() : nullptr;
+}
+
 void Layer::OnSceneConnectionInternal()
 {
   if(!mIsRoot)
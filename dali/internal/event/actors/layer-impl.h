@@ -28,6 +28,7 @@ namespace Dali
 {
 namespace Internal
 {
+class HitTestIndex;
 class LayerList;
 
 namespace SceneGraph
@@ -167,6 +168,12 @@ public:
    */
   bool IsHoverConsumed() const;
 
+  /**
+   * Retrieves the spatial index used to hit-test the actors of this layer, brought up to date.
+   * @return The index, or nullptr if the layer does not use one
+   */
+  HitTestIndex* GetHitTestIndex();
+
   /**
    * Helper function to get the scene object.
    *
@@ -236,6 +243,8 @@ private:
 
   Dali::Layer::Behavior mBehavior; ///< Behavior of the layer
 
+  std::unique_ptr<HitTestIndex> mHitTestIndex; ///< Created when the layer is first hit-tested
+
   bool mDepthTestDisabled : 1; ///< Whether depth test is disabled.
   bool mTouchConsumed : 1;     ///< Whether we should consume touch (including gesture).
   bool mHoverConsumed : 1;     ///< Whether we should consume hover.
@@ -34,6 +34,9 @@ template<typename V>
 struct KeyFrameChannel
 {
   using ProgressValues = std::vector<ProgressValue<V>>;
+  using CubicSegments  = std::vector<CubicCoefficients<V>>;
+
+  static constexpr uint32_t MAX_CURSOR_STEPS = 4u; ///< The number of segments the cursor moves forward before a binary search
 
   bool IsActive(float progress) const
   {
@@ -52,55 +55,55 @@ struct KeyFrameChannel
     {
       interpolatedV = mValues.back().GetValue();
     }
-    else
+    else if(progress >= mValues.front().GetProgress())
     {
-      // Find lowest element s.t. progress is greater than progress.
-      // So start->GetProgress() <= progress < end->GetProgress() is satisfied.
-      auto end   = std::lower_bound(mValues.begin(), mValues.end(), progress, [](const auto& element, const float& progress)
-        { return element.GetProgress() <= progress; });
-      auto start = end - 1;
-
-      const bool validInterval = (end != mValues.end()) && (start->GetProgress() <= progress);
+      // start->GetProgress() <= progress < end->GetProgress() is satisfied.
+      const std::size_t segment = FindSegment(progress);
+      const auto        start   = mValues.begin() + segment;
+      const auto        end     = start + 1;
 
-      if(validInterval)
+      float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
+      if(interpolation == Dali::Animation::LINEAR)
       {
-        float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
-        if(interpolation == Dali::Animation::LINEAR)
-        {
-          Interpolate(interpolatedV, start->GetValue(), end->GetValue(), frameProgress);
-        }
-        else
+        Interpolate(interpolatedV, start->GetValue(), end->GetValue(), frameProgress);
+      }
+      else
+      {
+        if constexpr(CubicCoefficients<V>::SUPPORTED)
         {
-          //Calculate prev and next values
-          V prev;
-          if(start != mValues.begin())
-          {
-            prev = (start - 1)->GetValue();
-          }
-          else
-          {
-            //Project next value through start point
-            prev = start->GetValue() + (start->GetValue() - (start + 1)->GetValue());
-          }
-
-          V next;
-          if(end != mValues.end() - 1)
+          if(mCubicSegments.size() + 1u == mValues.size())
           {
-            next = (end + 1)->GetValue();
+            EvaluateCubic(interpolatedV, mCubicSegments[segment], start->GetValue(), frameProgress);
+            return interpolatedV;
           }
-          else
-          {
-            //Project prev value through end point
-            next = end->GetValue() + (end->GetValue() - (end - 1)->GetValue());
-          }
-
-          CubicInterpolate(interpolatedV, prev, start->GetValue(), end->GetValue(), next, frameProgress);
         }
+        CubicInterpolate(interpolatedV, GetPreviousValue(segment), start->GetValue(), end->GetValue(), GetNextValue(segment + 1u), frameProgress);
       }
     }
     return interpolatedV;
   }
 
+  /**
+   * Calculates the cubic interpolation coefficients of every segment between two key frames,
+   * so GetValue() only has to evaluate a polynomial.
+   * The key frames must not change afterwards.
+   */
+  void CalculateCubicSegments()
+  {
+    mCubicSegments.clear();
+    if constexpr(CubicCoefficients<V>::SUPPORTED)
+    {
+      if(mValues.size() >= 2u)
+      {
+        mCubicSegments.resize(mValues.size() - 1u);
+        for(std::size_t segment = 0u; segment < mCubicSegments.size(); ++segment)
+        {
+          CalculateCubicCoefficients(mCubicSegments[segment], GetPreviousValue(segment), mValues[segment].GetValue(), mValues[segment + 1u].GetValue(), GetNextValue(segment + 1u));
+        }
+      }
+    }
+  }
+
   bool OptimizeValuesLinear()
   {
     ProgressValues optimizedValues;
@@ -156,11 +159,74 @@ struct KeyFrameChannel
     if(optimized)
     {
       mValues = std::move(optimizedValues);
+      mCubicSegments.clear();
     }
     return optimized;
   }
 
   ProgressValues mValues;
+  CubicSegments  mCubicSegments; ///< The coefficients of each segment. Only valid if it has a segment between each pair of key frames
+
+private:
+  /**
+   * Finds the segment containing the progress, i.e. the index of the last key frame whose progress is not greater.
+   * The progress of an animator usually moves forward a little at each frame, so the search starts from the last segment found.
+   * @param[in] progress The progress, which must be in the range of the key frames
+   * @return The index of the key frame at the start of the segment
+   */
+  std::size_t FindSegment(float progress) const
+  {
+    std::size_t segment = mSegmentCursor;
+    if(segment + 1u < mValues.size() && mValues[segment].GetProgress() <= progress)
+    {
+      // The progress is less than the last key frame's, so the loop never passes the last segment.
+      for(uint32_t step = 0u; step < MAX_CURSOR_STEPS; ++step, ++segment)
+      {
+        if(progress < mValues[segment + 1u].GetProgress())
+        {
+          mSegmentCursor = segment;
+          return segment;
+        }
+      }
+    }
+
+    // Find lowest element s.t. progress is greater than progress.
+    auto end = std::lower_bound(mValues.begin(), mValues.end(), progress, [](const auto& element, const float& progress)
+                                { return element.GetProgress() <= progress; });
+
+    mSegmentCursor = static_cast<std::size_t>(end - mValues.begin()) - 1u;
+    return mSegmentCursor;
+  }
+
+  /**
+   * Gets the control value before the start of a segment.
+   * @param[in] start The index of the key frame at the start of the segment
+   * @return The previous key frame's value, or the next one's projected through the start point
+   */
+  V GetPreviousValue(std::size_t start) const
+  {
+    if(start > 0u)
+    {
+      return mValues[start - 1u].GetValue();
+    }
+    return mValues[start].GetValue() + (mValues[start].GetValue() - mValues[start + 1u].GetValue());
+  }
+
+  /**
+   * Gets the control value after the end of a segment.
+   * @param[in] end The index of the key frame at the end of the segment
+   * @return The next key frame's value, or the previous one's projected through the end point
+   */
+  V GetNextValue(std::size_t end) const
+  {
+    if(end + 1u < mValues.size())
+    {
+      return mValues[end + 1u].GetValue();
+    }
+    return mValues[end].GetValue() + (mValues[end].GetValue() - mValues[end - 1u].GetValue());
+  }
+
+  mutable std::size_t mSegmentCursor{0u}; ///< The last segment found. Each animator owns a copy of the channel, so it follows its progress
 };
 
 } // namespace Internal
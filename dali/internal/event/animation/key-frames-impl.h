@@ -163,6 +163,7 @@ public:
   void AddKeyFrame(float t, V v)
   {
     mChannel.mValues.push_back({t, v});
+    mChannel.mCubicSegments.clear();
   }
 
   /**
@@ -205,6 +206,7 @@ public:
   {
     auto& element  = mChannel.mValues[index];
     element.mValue = value.Get<V>();
+    mChannel.mCubicSegments.clear();
   }
 
   /**
@@ -215,6 +217,19 @@ public:
     return mChannel.OptimizeValuesLinear();
   }
 
+  /**
+   * Prepare the key frames to be animated with the given interpolation.
+   * Called once by the animator which owns this copy of the key frames.
+   * @param[in] interpolation The interpolation of the animator
+   */
+  void PrepareInterpolation(Dali::Animation::Interpolation interpolation)
+  {
+    if(interpolation == Dali::Animation::CUBIC)
+    {
+      mChannel.CalculateCubicSegments();
+    }
+  }
+
   /**
    * Return whether the progress is valid for the range of keyframes. (The first
    * keyframe doesn't have to start at 0, and the last doesn't have to end at 1.0)
@@ -110,49 +110,83 @@ inline void Interpolate(Vector4& result, const Vector4& a, const Vector4& b, flo
  * Restrictions: f(0)=p1   f(1)=p2   f'(0)=(p2-p0)*0.5   f'(1)=(p3-p1)*0.5
  */
 
-inline void CubicInterpolate(int32_t& result, int32_t p0, int32_t p1, int32_t p2, int32_t p3, float progress)
+/**
+ * Coefficients a3, a2 and a1 of the cubic interpolation of a type (a0 is p1).
+ * Types without coefficients are interpolated linearly.
+ */
+template<typename T>
+struct CubicCoefficients
 {
-  float a3 = static_cast<float>(p3) * 0.5f - static_cast<float>(p2) * 1.5f + static_cast<float>(p1) * 1.5f - static_cast<float>(p0) * 0.5f;
-  float a2 = static_cast<float>(p0) - static_cast<float>(p1) * 2.5f + static_cast<float>(p2) * 2.0f - static_cast<float>(p3) * 0.5f;
-  float a1 = static_cast<float>(p2 - p0) * 0.5f;
+  static constexpr bool SUPPORTED = false;
+};
 
-  result = static_cast<int>(a3 * progress * progress * progress + a2 * progress * progress + a1 * progress + static_cast<float>(p1) + 0.5f);
-}
+template<typename C>
+struct CubicCoefficientsBase
+{
+  static constexpr bool SUPPORTED = true;
+
+  C a3;
+  C a2;
+  C a1;
+};
 
-inline void CubicInterpolate(float& result, float p0, float p1, float p2, float p3, float progress)
+template<>
+struct CubicCoefficients<int32_t> : CubicCoefficientsBase<float>
 {
-  float a3 = p3 * 0.5f - p2 * 1.5f + p1 * 1.5f - p0 * 0.5f;
-  float a2 = p0 - p1 * 2.5f + p2 * 2.0f - p3 * 0.5f;
-  float a1 = (p2 - p0) * 0.5f;
+};
 
-  result = a3 * progress * progress * progress + a2 * progress * progress + a1 * progress + p1;
-}
+template<>
+struct CubicCoefficients<float> : CubicCoefficientsBase<float>
+{
+};
 
-inline void CubicInterpolate(Vector2& result, const Vector2& p0, const Vector2& p1, const Vector2& p2, const Vector2& p3, float progress)
+template<>
+struct CubicCoefficients<Vector2> : CubicCoefficientsBase<Vector2>
 {
-  Vector2 a3 = p3 * 0.5f - p2 * 1.5f + p1 * 1.5f - p0 * 0.5f;
-  Vector2 a2 = p0 - p1 * 2.5f + p2 * 2.0f - p3 * 0.5f;
-  Vector2 a1 = (p2 - p0) * 0.5f;
+};
 
-  result = a3 * progress * progress * progress + a2 * progress * progress + a1 * progress + p1;
+template<>
+struct CubicCoefficients<Vector3> : CubicCoefficientsBase<Vector3>
+{
+};
+
+template<>
+struct CubicCoefficients<Vector4> : CubicCoefficientsBase<Vector4>
+{
+};
+
+inline void CalculateCubicCoefficients(CubicCoefficients<int32_t>& coefficients, int32_t p0, int32_t p1, int32_t p2, int32_t p3)
+{
+  coefficients.a3 = static_cast<float>(p3) * 0.5f - static_cast<float>(p2) * 1.5f + static_cast<float>(p1) * 1.5f - static_cast<float>(p0) * 0.5f;
+  coefficients.a2 = static_cast<float>(p0) - static_cast<float>(p1) * 2.5f + static_cast<float>(p2) * 2.0f - static_cast<float>(p3) * 0.5f;
+  coefficients.a1 = static_cast<float>(p2 - p0) * 0.5f;
 }
 
-inline void CubicInterpolate(Vector3& result, const Vector3& p0, const Vector3& p1, const Vector3& p2, const Vector3& p3, float progress)
+template<typename T>
+inline void CalculateCubicCoefficients(CubicCoefficientsBase<T>& coefficients, const T& p0, const T& p1, const T& p2, const T& p3)
 {
-  Vector3 a3 = p3 * 0.5f - p2 * 1.5f + p1 * 1.5f - p0 * 0.5f;
-  Vector3 a2 = p0 - p1 * 2.5f + p2 * 2.0f - p3 * 0.5f;
-  Vector3 a1 = (p2 - p0) * 0.5f;
+  coefficients.a3 = p3 * 0.5f - p2 * 1.5f + p1 * 1.5f - p0 * 0.5f;
+  coefficients.a2 = p0 - p1 * 2.5f + p2 * 2.0f - p3 * 0.5f;
+  coefficients.a1 = (p2 - p0) * 0.5f;
+}
 
-  result = a3 * progress * progress * progress + a2 * progress * progress + a1 * progress + p1;
+inline void EvaluateCubic(int32_t& result, const CubicCoefficients<int32_t>& coefficients, int32_t p1, float progress)
+{
+  result = static_cast<int>(coefficients.a3 * progress * progress * progress + coefficients.a2 * progress * progress + coefficients.a1 * progress + static_cast<float>(p1) + 0.5f);
 }
 
-inline void CubicInterpolate(Vector4& result, const Vector4& p0, const Vector4& p1, const Vector4& p2, const Vector4& p3, float progress)
+template<typename T>
+inline void EvaluateCubic(T& result, const CubicCoefficientsBase<T>& coefficients, const T& p1, float progress)
 {
-  Vector4 a3 = p3 * 0.5f - p2 * 1.5f + p1 * 1.5f - p0 * 0.5f;
-  Vector4 a2 = p0 - p1 * 2.5f + p2 * 2.0f - p3 * 0.5f;
-  Vector4 a1 = (p2 - p0) * 0.5f;
+  result = coefficients.a3 * progress * progress * progress + coefficients.a2 * progress * progress + coefficients.a1 * progress + p1;
+}
 
-  result = a3 * progress * progress * progress + a2 * progress * progress + a1 * progress + p1;
+template<typename T>
+inline void CubicInterpolate(T& result, const T& p0, const T& p1, const T& p2, const T& p3, float progress)
+{
+  CubicCoefficients<T> coefficients;
+  CalculateCubicCoefficients(coefficients, p0, p1, p2, p3);
+  EvaluateCubic(result, coefficients, p1, progress);
 }
 
 inline void CubicInterpolate(bool& result, bool p0, bool p1, bool p2, bool p3, float progress)
@@ -95,6 +95,26 @@ public:
    */
   virtual uint32_t* ReserveMessageSlot(uint32_t size, bool updateScene = true) = 0;
 
+  /**
+   * Reserve space for a message which modifies a property; the message will cause the scene-graph node tree to require an update.
+   * The message remains the last one of the property until the messages are flushed, or another message is reserved for it.
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] property The property modified by the message.
+   * @param[in] messageTypeId Identifies the type of the message (see GetMessageTypeId()), or nullptr if no later message may be merged into it.
+   * @return A pointer to the first char allocated for the message.
+   */
+  virtual uint32_t* ReservePropertyMessageSlot(uint32_t size, const void* property, const void* messageTypeId) = 0;
+
+  /**
+   * Retrieve the last message which modifies a property since the messages were flushed, so that a new value
+   * can be merged into it instead of reserving another message.
+   * @param[in] property The property.
+   * @param[in] messageTypeId Identifies the type of the new message.
+   * @return The last message of the property, or nullptr if there is none, or if it has another type.
+   */
+  virtual uint32_t* FindLastPropertyMessage(const void* property, const void* messageTypeId) = 0;
+
   /**
    * @return true if core is still running and we can send messages
    * @note It returns false if it is called from a thread other than the main thread.
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/object/handle-devel.h>
@@ -54,6 +55,8 @@ Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_OBJ
 
 constexpr Property::Index MAX_PER_CLASS_PROPERTY_INDEX = ANIMATABLE_PROPERTY_REGISTRATION_MAX_INDEX;
 
+constexpr uint32_t HASHED_PROPERTY_LOOKUP_MINIMUM_COUNT = 8u; ///< Fewer properties are searched linearly, which is faster
+
 /// Helper to notify observers
 using ObserverNotifyMethod = void (Object::Observer::*)(Object&);
 
@@ -141,6 +144,20 @@ void SetValidSceneGraphProperty(EventThreadServices& eventThreadService, const S
 
 } // unnamed namespace
 
+/**
+ * Hashed lookup of the custom and animatable properties of an object, by their position in the containers.
+ * The containers only grow, so the properties are indexed incrementally.
+ */
+struct Object::PropertyLookup
+{
+  std::unordered_map<const char*, uint32_t>     names;               ///< Custom properties by name, the first registered wins
+  std::unordered_map<Property::Index, uint32_t> keys;                ///< Custom properties by integer key, the first registered wins
+  std::unordered_map<Property::Index, uint32_t> childIndices;        ///< Custom properties by child property index, the last registered wins
+  std::unordered_map<Property::Index, uint32_t> animatableIndices;   ///< Animatable properties by index, the first registered wins
+  uint32_t                                      customCount{0u};     ///< Number of custom properties indexed
+  uint32_t                                      animatableCount{0u}; ///< Number of animatable properties indexed
+};
+
 IntrusivePtr<Object> Object::New()
 {
   return new Object(nullptr); // no scene object by default
@@ -237,25 +254,18 @@ Property::Index Object::GetPropertyIndex(KeyRef key) const
 
   if((index == Property::INVALID_INDEX) && (mCustomProperties.Count() > 0))
   {
-    Property::Index count = PROPERTY_CUSTOM_START_INDEX;
-    const auto      end   = mCustomProperties.End();
-    for(auto iter = mCustomProperties.Begin(); iter != end; ++iter, ++count)
+    const Property::Index position = FindCustomPropertyPosition(key);
+    if(position != Property::INVALID_INDEX)
     {
-      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(*iter);
-
-      if((key.mType == Property::Key::STRING && custom->name == key.mString) ||
-         (key.mType == Property::Key::INDEX && custom->key == key.mIndex))
+      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(mCustomProperties[position]);
+      if(custom->childPropertyIndex != Property::INVALID_INDEX)
       {
-        if(custom->childPropertyIndex != Property::INVALID_INDEX)
-        {
-          // If it is a child property, return the child property index
-          index = custom->childPropertyIndex;
-        }
-        else
-        {
-          index = count;
-        }
-        break;
+        // If it is a child property, return the child property index
+        index = custom->childPropertyIndex;
+      }
+      else
+      {
+        index = PROPERTY_CUSTOM_START_INDEX + position;
       }
     }
   }
@@ -432,7 +442,9 @@ void Object::SetProperty(Property::Index index, Property::Value propertyValue)
         mCustomProperties.PushBack(custom);
       }
 
-      custom->childPropertyIndex = index;
+      const ConstString previousName = custom->name;
+      const bool        indexChanged = (custom->childPropertyIndex != index);
+      custom->childPropertyIndex     = index;
 
       // Resolve name for the child property
       Object* parent = GetParentObject();
@@ -444,6 +456,11 @@ void Object::SetProperty(Property::Index index, Property::Value propertyValue)
           custom->name = ConstString(parentTypeInfo->GetChildPropertyName(index));
         }
       }
+
+      if(indexChanged || !(custom->name == previousName))
+      {
+        InvalidatePropertyLookup();
+      }
     }
 
     if(custom)
@@ -1107,6 +1124,7 @@ Object::Object(const SceneGraph::PropertyOwner* sceneObject)
 : EventThreadServicesHolder(EventThreadServices::Get()),
   mUpdateObject(sceneObject),
   mTypeInfo(nullptr),
+  mPropertyLookup(),
   mConstraints(nullptr),
   mPropertyNotifications(nullptr),
   mObserverNotifying(false),
@@ -1199,12 +1217,24 @@ CustomPropertyMetadata* Object::FindCustomProperty(Property::Index index) const
   CustomPropertyMetadata* property = nullptr;
   if((index >= CHILD_PROPERTY_REGISTRATION_START_INDEX) && (index <= CHILD_PROPERTY_REGISTRATION_MAX_INDEX))
   {
-    for(std::size_t arrayIndex = 0; arrayIndex < mCustomProperties.Count(); arrayIndex++)
+    const PropertyLookup* lookup = GetPropertyLookup();
+    if(lookup)
     {
-      CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(mCustomProperties[arrayIndex]);
-      if(custom->childPropertyIndex == index)
+      const auto iter = lookup->childIndices.find(index);
+      if(iter != lookup->childIndices.end())
       {
-        property = custom;
+        property = static_cast<CustomPropertyMetadata*>(mCustomProperties[iter->second]);
+      }
+    }
+    else
+    {
+      for(std::size_t arrayIndex = 0; arrayIndex < mCustomProperties.Count(); arrayIndex++)
+      {
+        CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(mCustomProperties[arrayIndex]);
+        if(custom->childPropertyIndex == index)
+        {
+          property = custom;
+        }
       }
     }
   }
@@ -1224,6 +1254,13 @@ CustomPropertyMetadata* Object::FindCustomProperty(Property::Index index) const
 
 AnimatablePropertyMetadata* Object::FindAnimatableProperty(Property::Index index) const
 {
+  const PropertyLookup* lookup = GetPropertyLookup();
+  if(lookup)
+  {
+    const auto iter = lookup->animatableIndices.find(index);
+    return (iter != lookup->animatableIndices.end()) ? static_cast<AnimatablePropertyMetadata*>(mAnimatableProperties[iter->second]) : nullptr;
+  }
+
   for(auto&& entry : mAnimatableProperties)
   {
     AnimatablePropertyMetadata* property = static_cast<AnimatablePropertyMetadata*>(entry);
@@ -1235,6 +1272,70 @@ AnimatablePropertyMetadata* Object::FindAnimatableProperty(Property::Index index
   return nullptr;
 }
 
+Property::Index Object::FindCustomPropertyPosition(KeyRef key) const
+{
+  const PropertyLookup* lookup = GetPropertyLookup();
+  if(lookup)
+  {
+    if(key.mType == Property::Key::STRING)
+    {
+      const auto iter = lookup->names.find(key.mString.GetCString());
+      return (iter != lookup->names.end()) ? static_cast<Property::Index>(iter->second) : Property::INVALID_INDEX;
+    }
+    const auto iter = lookup->keys.find(key.mIndex);
+    return (iter != lookup->keys.end()) ? static_cast<Property::Index>(iter->second) : Property::INVALID_INDEX;
+  }
+
+  const auto count = static_cast<Property::Index>(mCustomProperties.Count());
+  for(Property::Index position = 0; position < count; ++position)
+  {
+    CustomPropertyMetadata* custom = static_cast<CustomPropertyMetadata*>(mCustomProperties[position]);
+    if((key.mType == Property::Key::STRING && custom->name == key.mString) ||
+       (key.mType == Property::Key::INDEX && custom->key == key.mIndex))
+    {
+      return position;
+    }
+  }
+  return Property::INVALID_INDEX;
+}
+
+const Object::PropertyLookup* Object::GetPropertyLookup() const
+{
+  const auto customCount     = static_cast<uint32_t>(mCustomProperties.Count());
+  const auto animatableCount = static_cast<uint32_t>(mAnimatableProperties.Count());
+  if(!mPropertyLookup)
+  {
+    if(customCount < HASHED_PROPERTY_LOOKUP_MINIMUM_COUNT && animatableCount < HASHED_PROPERTY_LOOKUP_MINIMUM_COUNT)
+    {
+      return nullptr;
+    }
+    mPropertyLookup.reset(new PropertyLookup());
+  }
+
+  PropertyLookup& lookup = *mPropertyLookup;
+  for(; lookup.customCount < customCount; ++lookup.customCount)
+  {
+    const CustomPropertyMetadata* custom = static_cast<const CustomPropertyMetadata*>(mCustomProperties[lookup.customCount]);
+    lookup.names.emplace(custom->name.GetCString(), lookup.customCount);
+    lookup.keys.emplace(custom->key, lookup.customCount);
+    if(custom->childPropertyIndex != Property::INVALID_INDEX)
+    {
+      lookup.childIndices[custom->childPropertyIndex] = lookup.customCount;
+    }
+  }
+  for(; lookup.animatableCount < animatableCount; ++lookup.animatableCount)
+  {
+    const AnimatablePropertyMetadata* animatable = static_cast<const AnimatablePropertyMetadata*>(mAnimatableProperties[lookup.animatableCount]);
+    lookup.animatableIndices.emplace(animatable->index, lookup.animatableCount);
+  }
+  return mPropertyLookup.get();
+}
+
+void Object::InvalidatePropertyLookup() const
+{
+  mPropertyLookup.reset();
+}
+
 Property::Index Object::RegisterSceneGraphProperty(ConstString name, Property::Index key, Property::Index index, Property::Value propertyValue) const
 {
   // Create a new property
@@ -1441,6 +1542,9 @@ void Object::ResolveChildProperties()
           }
         }
       }
+
+      // The names and child property indices may have changed
+      InvalidatePropertyLookup();
     }
   }
 }
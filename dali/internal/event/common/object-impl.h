@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <cstdint> // uint32_t
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/owner-container.h>
@@ -499,6 +500,26 @@ protected:
    */
   AnimatablePropertyMetadata* FindAnimatableProperty(Property::Index index) const;
 
+  /**
+   * Helper to find the position of a custom property in the container of custom properties
+   * @param[in] key The name or integer key of the property
+   * @return The position, or Property::INVALID_INDEX if not found
+   */
+  Property::Index FindCustomPropertyPosition(KeyRef key) const;
+
+  struct PropertyLookup;
+
+  /**
+   * Retrieves the hashed lookup of the custom and animatable properties, indexing the properties registered since the last call.
+   * @return The lookup, or nullptr if there are too few properties for hashing to be worthwhile
+   */
+  const PropertyLookup* GetPropertyLookup() const;
+
+  /**
+   * Discards the hashed lookup, after the name or child property index of an indexed custom property changed.
+   */
+  void InvalidatePropertyLookup() const;
+
   /**
    * Helper to register a scene-graph property
    * @param [in] name The name of the property.
@@ -606,6 +627,7 @@ private:
   mutable OwnerContainer<PropertyMetadata*> mCustomProperties;     ///< Used for accessing custom Node properties
   mutable OwnerContainer<PropertyMetadata*> mAnimatableProperties; ///< Used for accessing animatable Node properties
   mutable const TypeInfo*                   mTypeInfo;             ///< The type-info for this object, mutable so it can be lazy initialized from const method if it is required
+  mutable std::unique_ptr<PropertyLookup>   mPropertyLookup;       ///< Hashed lookup of the properties, built lazily for objects with many properties
 
   ConstraintContainer* mConstraints; ///< Container of owned -constraints.
 
@@ -61,6 +61,16 @@ public:
    */
   virtual bool InputInitialized() const = 0;
 
+  /**
+   * Query whether the input value may have changed during the current, or the previous frame.
+   * @note The inputs which do not track their changes always return true.
+   * @return False if the value is known to be unchanged.
+   */
+  virtual bool InputChanged() const
+  {
+    return true;
+  }
+
   /**
    * Retrieve a boolean value.
    * @pre GetType() returns Property::BOOLEAN.
@@ -292,6 +302,25 @@ public:
     return false;
   }
 
+  /**
+   * Query whether the value is inherited from the parent while the node tree is updated,
+   * rather than set, baked or animated.
+   * @return True if it is an inherited property, false otherwise
+   */
+  virtual bool IsInheritedProperty() const
+  {
+    return false;
+  }
+
+  /**
+   * Query whether reading the value computes it into a member, so that it must not be read by several threads at once.
+   * @return True if the value is computed when it is read, false otherwise
+   */
+  virtual bool IsComputedWhenRead() const
+  {
+    return false;
+  }
+
   std::size_t Hash(std::size_t seed) const
   {
     switch(GetType())
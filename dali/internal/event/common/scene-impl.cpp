@@ -62,7 +62,6 @@ Scene::Scene()
   mSize(), // Don't set the proper value here, this will be set when the surface is set later
   mDpi(),
   mBackgroundColor(DEFAULT_BACKGROUND_COLOR),
-  mDepthTreeDirty(false),
   mDepthBufferEnabled(false),
   mStencilBufferEnabled(false),
   mMSAAEnabled(false),
@@ -335,11 +334,6 @@ void Scene::Discard()
   }
 }
 
-void Scene::RequestRebuildDepthTree()
-{
-  mDepthTreeDirty = true;
-}
-
 void Scene::QueueEvent(const Integration::Event& event)
 {
   mEventProcessor.QueueEvent(event);
@@ -355,15 +349,11 @@ void Scene::SendInterruptedEvents(Dali::Internal::Actor* actor)
   mEventProcessor.SendInterruptedEvents(actor);
 }
 
-void Scene::RebuildDepthTree()
+void Scene::UpdateDepthTree()
 {
-  // If the depth tree needs rebuilding, do it in this frame only.
-  if(mDepthTreeDirty)
-  {
-    ActorPtr actor(mRootLayer.Get());
-    actor->RebuildDepthTree();
-    mDepthTreeDirty = false;
-  }
+  // Renumber only the actors changed in this frame, if any
+  ActorPtr actor(mRootLayer.Get());
+  actor->UpdateDepthTree();
   mRenderTaskList->SortTasks();
 }
 
@@ -176,9 +176,22 @@ public:
   LayerList& GetLayerList() const;
 
   /**
-   * Request that the depth tree is rebuilt
+   * Request that the hit-test indices of the layers are rebuilt before they are used next.
+   * Called when actors are added, removed or reordered on the scene, or when their touch area changes.
    */
-  void RequestRebuildDepthTree();
+  void RequestRebuildHitTestIndices()
+  {
+    ++mHitTestIndexStamp;
+  }
+
+  /**
+   * Retrieve the stamp incremented by each RequestRebuildHitTestIndices() call.
+   * @return The stamp
+   */
+  uint32_t GetHitTestIndexStamp() const
+  {
+    return mHitTestIndexStamp;
+  }
 
   /**
    * This function is called when an event is queued.
@@ -198,10 +211,11 @@ public:
   void SendInterruptedEvents(Dali::Internal::Actor* actor);
 
   /**
-   * Rebuilds the depth tree at the end of the event frame if
-   * it was requested this frame.
+   * Updates the depth tree at the end of the event frame, renumbering only the subtrees changed this frame.
+   * @note The actors request the update of their own subtree, see ActorParentImpl::RequestDepthTreeUpdate().
+   * The whole tree is rebuilt when the gaps between the depth indices are exhausted.
    */
-  void RebuildDepthTree();
+  void UpdateDepthTree();
 
   /**
    * @brief Sets the background color of the render surface.
@@ -524,7 +538,6 @@ private:
   // The list of render-tasks
   IntrusivePtr<RenderTaskList> mRenderTaskList;
 
-  bool                mDepthTreeDirty : 1; ///< True if the depth tree needs recalculating
   bool                mDepthBufferEnabled : 1;
   bool                mStencilBufferEnabled : 1;
   bool                mMSAAEnabled : 1;
@@ -546,6 +559,8 @@ private:
 
   uint32_t mOverlayContentCount{0u};
 
+  uint32_t mHitTestIndexStamp{0u}; ///< Incremented when the hit-test indices of the layers are out of date
+
   // The pan gesture state
   Dali::GestureState mPanGestureState;
 
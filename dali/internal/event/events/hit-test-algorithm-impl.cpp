@@ -30,6 +30,7 @@
 #include <dali/internal/event/actors/layer-list.h>
 #include <dali/internal/event/common/projection.h>
 #include <dali/internal/event/common/scene-impl.h>
+#include <dali/internal/event/events/hit-test-index.h>
 #include <dali/internal/event/events/ray-test.h>
 #include <dali/internal/event/render-tasks/render-task-impl.h>
 #include <dali/internal/event/render-tasks/render-task-list-impl.h>
@@ -450,7 +451,9 @@ bool HitTestActorRecursively(std::vector<std::shared_ptr<HitResult>>& hitResultL
                              HitTestInterface&                        hitCheck,
                              Dali::Layer::Behavior                    layerBehavior,
                              bool                                     isKeepingHitTestRequired,
-                             bool                                     isOverlay)
+                             bool                                     isOverlay,
+                             const HitTestIndex*                      hitTestIndex,
+                             uint32_t                                 indexEntry)
 {
   if(IsOverlayRoot(currentActor, isOverlay))
   {
@@ -471,14 +474,35 @@ bool HitTestActorRecursively(std::vector<std::shared_ptr<HitResult>>& hitResultL
                                               ? currentActor.GetChildrenInDepthOrder()
                                               : currentActor.GetChildrenInternal();
 
-    for(auto iter = orderedChildren.rbegin(), endIter = orderedChildren.rend(); iter != endIter; ++iter)
+    // With the index of the layer, only the children whose subtree the ray may hit are visited, still in render order.
+    const bool            indexed = hitTestIndex && indexEntry != HitTestIndex::INVALID_ENTRY && hitTestIndex->HasChildCount(indexEntry, static_cast<uint32_t>(orderedChildren.size()));
+    std::vector<uint32_t> candidatePositions;
+    const bool            hasCandidates = indexed && hitTestIndex->GetCandidateChildren(indexEntry, ray.origin, ray.direction, candidatePositions);
+
+    for(uint32_t i = static_cast<uint32_t>(hasCandidates ? candidatePositions.size() : orderedChildren.size()); i > 0u; --i)
     {
-      Actor& childActor = *(iter->Get());
+      const uint32_t position = hasCandidates ? candidatePositions[i - 1u] : i - 1u;
+      if(position >= orderedChildren.size())
+      {
+        continue;
+      }
+
+      Actor& childActor = *(orderedChildren[position].Get());
       if(childActor.IsLayer())
       {
         continue;
       }
 
+      uint32_t childEntry = HitTestIndex::INVALID_ENTRY;
+      if(indexed)
+      {
+        childEntry = hitTestIndex->GetChildEntry(indexEntry, position, childActor);
+        if(childEntry != HitTestIndex::INVALID_ENTRY && !hitTestIndex->MayHitSubtree(childEntry, ray.origin, ray.direction))
+        {
+          continue;
+        }
+      }
+
       if(!hitCheck.DescendActorHierarchy(&childActor))
       {
         continue;
@@ -500,7 +524,7 @@ bool HitTestActorRecursively(std::vector<std::shared_ptr<HitResult>>& hitResultL
       }
       else
       {
-        isHit = HitTestActorRecursively(hitResultList, childActor, renderTaskSourceActor, hitCommonInformation, ray, projectedNearClippingDistance, projectedFarClippingDistance, hitCheck, layerBehavior, isKeepingHitTestRequired, isOverlay);
+        isHit = HitTestActorRecursively(hitResultList, childActor, renderTaskSourceActor, hitCommonInformation, ray, projectedNearClippingDistance, projectedFarClippingDistance, hitCheck, layerBehavior, isKeepingHitTestRequired, isOverlay, hitTestIndex, childEntry);
       }
 
       if(isKeepingHitTestRequired)
@@ -607,8 +631,12 @@ bool HitTestWithinSubTree(std::vector<std::shared_ptr<HitResult>>& hitResultList
                           const float&                             projectedNearClippingDistance,
                           const float&                             projectedFarClippingDistance,
                           HitTestInterface&                        hitCheck,
-                          Dali::Layer::Behavior                    layerBehavior)
+                          Dali::Layer::Behavior                    layerBehavior,
+                          HitTestIndex*                            hitTestIndex)
 {
+  // The index is not rebuilt by the hit-tests of frame-buffer mapping actors while it is walked
+  HitTestIndex::ScopedUse hitTestIndexUse(hitTestIndex);
+
   std::vector<Actor*> validActorRoots;
   validActorRoots.push_back(&actor);
 
@@ -622,7 +650,8 @@ bool HitTestWithinSubTree(std::vector<std::shared_ptr<HitResult>>& hitResultList
   auto endIter = validActorRoots.rend();
   for(auto iter = validActorRoots.rbegin(); endIter != iter; ++iter)
   {
-    if(HitTestActorRecursively(hitResultList, *(*iter), renderTaskSourceActor, hitCommonInformation, ray, projectedNearClippingDistance, projectedFarClippingDistance, hitCheck, layerBehavior, isKeepingHitTestRequired, (*iter)->IsOverlay()))
+    const uint32_t indexEntry = hitTestIndex ? hitTestIndex->FindEntry(*(*iter)) : HitTestIndex::INVALID_ENTRY;
+    if(HitTestActorRecursively(hitResultList, *(*iter), renderTaskSourceActor, hitCommonInformation, ray, projectedNearClippingDistance, projectedFarClippingDistance, hitCheck, layerBehavior, isKeepingHitTestRequired, (*iter)->IsOverlay(), hitTestIndex, indexEntry))
     {
       break;
     }
@@ -729,7 +758,8 @@ bool HitTestRenderTask(std::vector<std::shared_ptr<HitResult>>& hitResultList,
                                                                          projectedNearClippingDistance,
                                                                          projectedFarClippingDistance,
                                                                          hitCheck,
-                                                                         layer->GetBehavior());
+                                                                         layer->GetBehavior(),
+                                                                         layer->GetHitTestIndex());
 
     if(!isHit && hitCheck.DoesLayerConsumeHit(layer))
     {
@@ -0,0 +1,619 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/event/events/hit-test-index.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
+// INTERNAL INCLUDES
+#include <dali/internal/common/environment-variable.h>
+#include <dali/internal/event/actors/actor-impl.h>
+#include <dali/internal/event/actors/layer-impl.h>
+#include <dali/internal/event/common/scene-impl.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/nodes/scene-graph-layer.h>
+#include <dali/public-api/math/math-utils.h>
+#include <dali/public-api/math/matrix.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace
+{
+constexpr const char* HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT_ENV     = "DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT"; ///< Layers with this number of actors or more use a hit-test index. 0 disables it.
+constexpr uint32_t    DEFAULT_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT = 1024u;                                     ///< Below this, walking the whole layer is cheap enough
+
+constexpr uint32_t GRID_MINIMUM_CHILD_COUNT = 64u;   ///< Children of an actor are bucketed in a grid from this number
+constexpr uint32_t GRID_CHILDREN_PER_CELL   = 2u;    ///< The average number of children per cell aimed for
+constexpr uint32_t GRID_MAXIMUM_CELL_COUNT  = 4096u; ///< The maximum number of cells of a grid
+
+constexpr float UNBOUNDED                 = std::numeric_limits<float>::max();
+constexpr float BOUNDS_RELATIVE_SLACK     = 1.0e-4f; ///< Bounds are enlarged to absorb the numeric error of the ray tests
+constexpr float BOUNDS_ABSOLUTE_SLACK     = 1.0e-3f;
+constexpr float MINIMUM_DETERMINANT_RATIO = 1.0e-4f; ///< Below this, the world matrix is too close to singular to be inverted reliably by the ray tests
+
+uint32_t GetHitTestIndexMinimumActorCount()
+{
+  return EnvironmentVariable::GetUnsignedIntegerValue(HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT_ENV, DEFAULT_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT);
+}
+
+const ActorContainer& GetChildrenInRenderOrder(Actor& actor)
+{
+  // Same order as the hit-test algorithm
+  return actor.HasNonZeroDepthIndexChildren() ? actor.GetChildrenInDepthOrder() : actor.GetChildrenInternal();
+}
+
+/**
+ * Counts the actors of a layer, up to the given count.
+ */
+uint32_t CountActors(Actor& actor, uint32_t maximumCount)
+{
+  uint32_t count = 1u;
+  if(actor.GetChildCount() == 0u)
+  {
+    return count;
+  }
+  for(const auto& child : actor.GetChildrenInternal())
+  {
+    if(count >= maximumCount)
+    {
+      break;
+    }
+    if(!child->IsLayer())
+    {
+      count += CountActors(*child, maximumCount - count);
+    }
+  }
+  return count;
+}
+
+void SetUnbounded(Vector3& boundsMin, Vector3& boundsMax)
+{
+  boundsMin = Vector3(-UNBOUNDED, -UNBOUNDED, -UNBOUNDED);
+  boundsMax = Vector3(UNBOUNDED, UNBOUNDED, UNBOUNDED);
+}
+
+void SetEmpty(Vector3& boundsMin, Vector3& boundsMax)
+{
+  boundsMin = Vector3(UNBOUNDED, UNBOUNDED, UNBOUNDED);
+  boundsMax = Vector3(-UNBOUNDED, -UNBOUNDED, -UNBOUNDED);
+}
+
+bool IsEmpty(const Vector3& boundsMin, const Vector3& boundsMax)
+{
+  return boundsMin.x > boundsMax.x || boundsMin.y > boundsMax.y || boundsMin.z > boundsMax.z;
+}
+
+bool IsBounded(const Vector3& boundsMin, const Vector3& boundsMax)
+{
+  return boundsMin.x > -UNBOUNDED && boundsMin.y > -UNBOUNDED && boundsMin.z > -UNBOUNDED &&
+         boundsMax.x < UNBOUNDED && boundsMax.y < UNBOUNDED && boundsMax.z < UNBOUNDED;
+}
+
+void Merge(Vector3& boundsMin, Vector3& boundsMax, const Vector3& otherMin, const Vector3& otherMax)
+{
+  boundsMin.x = std::min(boundsMin.x, otherMin.x);
+  boundsMin.y = std::min(boundsMin.y, otherMin.y);
+  boundsMin.z = std::min(boundsMin.z, otherMin.z);
+  boundsMax.x = std::max(boundsMax.x, otherMax.x);
+  boundsMax.y = std::max(boundsMax.y, otherMax.y);
+  boundsMax.z = std::max(boundsMax.z, otherMax.z);
+}
+
+/**
+ * Computes the world bounds of a local box centered on the origin of a world matrix.
+ */
+void TransformBox(const float* matrix, const Vector3& halfSize, Vector3& boundsMin, Vector3& boundsMax)
+{
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    const float extent = std::abs(matrix[i]) * halfSize.x + std::abs(matrix[4 + i]) * halfSize.y + std::abs(matrix[8 + i]) * halfSize.z;
+    boundsMin.AsFloat()[i] = matrix[12 + i] - extent;
+    boundsMax.AsFloat()[i] = matrix[12 + i] + extent;
+  }
+}
+
+/**
+ * Computes the world bounds of everything which the ray tests of the hit-test algorithm can hit on an actor.
+ * @see RayTest
+ */
+void ComputeActorBounds(const Actor& actor, Dali::Layer::Behavior behavior, Vector3& boundsMin, Vector3& boundsMax)
+{
+  const SceneGraph::Node& node   = actor.GetNode();
+  const float*            matrix = node.GetWorldMatrix().AsFloat();
+  const Vector3&          size   = node.GetSize();
+
+  // The ray tests invert the world matrix
+  const Vector3 xAxis(matrix[0], matrix[1], matrix[2]);
+  const Vector3 yAxis(matrix[4], matrix[5], matrix[6]);
+  const Vector3 zAxis(matrix[8], matrix[9], matrix[10]);
+  const float   axisProduct = xAxis.Length() * yAxis.Length() * zAxis.Length();
+  const float   determinant = xAxis.Dot(yAxis.Cross(zAxis));
+  const bool    finite      = std::isfinite(determinant) && std::isfinite(matrix[12]) && std::isfinite(matrix[13]) && std::isfinite(matrix[14]);
+  const bool    invertible  = finite && std::abs(determinant) > MINIMUM_DETERMINANT_RATIO * axisProduct;
+
+  if(behavior == Dali::Layer::LAYER_3D)
+  {
+    // RayTest::ActorBoundingBoxTest
+    if(!invertible)
+    {
+      SetUnbounded(boundsMin, boundsMax);
+      return;
+    }
+    TransformBox(matrix, Vector3(std::abs(size.x), std::abs(size.y), std::abs(size.z)) * 0.5f, boundsMin, boundsMax);
+  }
+  else
+  {
+    // RayTest::SphereTest, which is required by the 2D hit-test
+    const Vector3& translation        = node.GetWorldPosition();
+    const Vector3& scale              = node.GetWorldScale();
+    const Extents& touchHitAreaMargin = actor.GetTouchHitAreaMargin();
+
+    const Vector3 center(translation.x + (touchHitAreaMargin.end - touchHitAreaMargin.start) * 0.5f, translation.y + (touchHitAreaMargin.bottom - touchHitAreaMargin.top) * 0.5f, translation.z);
+    const float   width   = size.width * scale.width + touchHitAreaMargin.start + touchHitAreaMargin.end;
+    const float   height  = size.height * scale.height + touchHitAreaMargin.top + touchHitAreaMargin.bottom;
+    const float   epsilon = std::max(Dali::Epsilon<10>::value, Dali::Epsilon<1000>::value * std::max(width, height));
+    const float   radius  = std::sqrt(0.5f * (width * width + height * height) + epsilon);
+    if(!std::isfinite(radius) || !std::isfinite(center.x) || !std::isfinite(center.y) || !std::isfinite(center.z))
+    {
+      SetUnbounded(boundsMin, boundsMax);
+      return;
+    }
+    boundsMin = center - Vector3(radius, radius, radius);
+    boundsMax = center + Vector3(radius, radius, radius);
+
+    // RayTest::ActorTest, on the XY plane of the actor
+    if(invertible)
+    {
+      const float   localEpsilon = std::max(BOUNDS_ABSOLUTE_SLACK, BOUNDS_RELATIVE_SLACK * std::max(std::abs(size.x), std::abs(size.y)));
+      const Vector3 halfSize(std::abs(size.x) * 0.5f + std::max(touchHitAreaMargin.start, touchHitAreaMargin.end) + localEpsilon,
+                             std::abs(size.y) * 0.5f + std::max(touchHitAreaMargin.top, touchHitAreaMargin.bottom) + localEpsilon,
+                             0.0f);
+      Vector3 planeMin, planeMax;
+      TransformBox(matrix, halfSize, planeMin, planeMax);
+
+      boundsMin.x = std::max(boundsMin.x, planeMin.x);
+      boundsMin.y = std::max(boundsMin.y, planeMin.y);
+      boundsMin.z = std::max(boundsMin.z, planeMin.z);
+      boundsMax.x = std::min(boundsMax.x, planeMax.x);
+      boundsMax.y = std::min(boundsMax.y, planeMax.y);
+      boundsMax.z = std::min(boundsMax.z, planeMax.z);
+    }
+  }
+
+  // Absorb the numeric error of the ray tests, which work in the local reference system
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    const float slack = BOUNDS_ABSOLUTE_SLACK + BOUNDS_RELATIVE_SLACK * std::max(std::abs(boundsMin.AsFloat()[i]), std::abs(boundsMax.AsFloat()[i]));
+    boundsMin.AsFloat()[i] -= slack;
+    boundsMax.AsFloat()[i] += slack;
+  }
+}
+
+/**
+ * Query whether the line of a ray intersects a box.
+ * The whole line is tested, as the hit-test checks the distance against the clipping planes afterwards.
+ */
+bool LineIntersectsBox(const Vector4& rayOrigin, const Vector4& rayDirection, const Vector3& boundsMin, const Vector3& boundsMax)
+{
+  float distanceMin = -std::numeric_limits<float>::infinity();
+  float distanceMax = std::numeric_limits<float>::infinity();
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    const float origin    = rayOrigin.AsFloat()[i];
+    const float direction = rayDirection.AsFloat()[i];
+    if(std::fpclassify(direction) == FP_ZERO)
+    {
+      if(origin < boundsMin.AsFloat()[i] || origin > boundsMax.AsFloat()[i])
+      {
+        return false;
+      }
+    }
+    else
+    {
+      float distance1 = (boundsMin.AsFloat()[i] - origin) / direction;
+      float distance2 = (boundsMax.AsFloat()[i] - origin) / direction;
+      if(distance1 > distance2)
+      {
+        std::swap(distance1, distance2);
+      }
+      distanceMin = std::max(distanceMin, distance1);
+      distanceMax = std::min(distanceMax, distance2);
+      if(distanceMin > distanceMax)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Converts a coordinate to a cell, clamped to [-1, cellCount].
+ */
+int32_t GetCell(float coordinate, float origin, float inverseCellSize, uint32_t cellCount)
+{
+  const float cell = Dali::Clamp((coordinate - origin) * inverseCellSize, -1.0f, static_cast<float>(cellCount));
+  return static_cast<int32_t>(std::floor(cell));
+}
+
+} // unnamed namespace
+
+HitTestIndex::HitTestIndex()
+: mScene(nullptr),
+  mHierarchyStamp(0u),
+  mTransformStamp(0u),
+  mMinimumActorCount(GetHitTestIndexMinimumActorCount()),
+  mUseCount(0u),
+  mBehavior(Dali::Layer::LAYER_UI),
+  mChecked(false),
+  mBuilt(false),
+  mEnoughActors(false)
+{
+}
+
+HitTestIndex::~HitTestIndex() = default;
+
+bool HitTestIndex::Update(Layer& layer)
+{
+  if(mMinimumActorCount == 0u || !layer.OnScene())
+  {
+    return false;
+  }
+
+  if(mUseCount > 0u)
+  {
+    // The entries are being walked
+    return mBuilt;
+  }
+
+  const Scene&   scene          = layer.GetScene();
+  const uint32_t hierarchyStamp = scene.GetHitTestIndexStamp();
+  if(!mChecked || mScene != &scene || mHierarchyStamp != hierarchyStamp)
+  {
+    mScene          = &scene;
+    mHierarchyStamp = hierarchyStamp;
+    mChecked        = true;
+    mBuilt          = false;
+    mEnoughActors   = CountActors(layer, mMinimumActorCount) >= mMinimumActorCount;
+    if(!mEnoughActors)
+    {
+      std::vector<Entry>().swap(mEntries);
+      std::vector<Grid>().swap(mGrids);
+    }
+  }
+
+  if(!mEnoughActors)
+  {
+    return false;
+  }
+
+  // Only the updates which moved or resized the actors of this layer invalidate the index
+  const uint32_t transformStamp = layer.GetSceneGraphLayer().GetWorldMatrixChangeCount();
+  if(!mBuilt || mTransformStamp != transformStamp || mBehavior != layer.GetBehavior())
+  {
+    mTransformStamp = transformStamp;
+    mBehavior       = layer.GetBehavior();
+    Build(layer);
+    mBuilt = true;
+  }
+  return true;
+}
+
+uint32_t HitTestIndex::FindEntry(const Actor& actor) const
+{
+  if(mEntries.empty())
+  {
+    return INVALID_ENTRY;
+  }
+
+  // Find the path from the layer to the actor
+  std::vector<const Actor*> path;
+  const Actor*              current = &actor;
+  for(; current && current != mEntries[0].actor; current = current->GetParent())
+  {
+    path.push_back(current);
+  }
+  if(!current)
+  {
+    return INVALID_ENTRY;
+  }
+
+  uint32_t entry = 0u;
+  for(auto iter = path.rbegin(), endIter = path.rend(); iter != endIter; ++iter)
+  {
+    const Entry& parent = mEntries[entry];
+    entry               = INVALID_ENTRY;
+    for(uint32_t child = parent.firstChild, endChild = parent.firstChild + parent.childCount; child < endChild; ++child)
+    {
+      if(mEntries[child].actor == *iter)
+      {
+        entry = child;
+        break;
+      }
+    }
+    if(entry == INVALID_ENTRY)
+    {
+      break;
+    }
+  }
+  return entry;
+}
+
+uint32_t HitTestIndex::GetChildEntry(uint32_t entry, uint32_t position, const Actor& child) const
+{
+  const Entry& parent = mEntries[entry];
+  if(position < parent.childCount && mEntries[parent.firstChild + position].actor == &child)
+  {
+    return parent.firstChild + position;
+  }
+  return INVALID_ENTRY;
+}
+
+bool HitTestIndex::MayHitSubtree(uint32_t entry, const Vector4& rayOrigin, const Vector4& rayDirection) const
+{
+  const Entry& indexEntry = mEntries[entry];
+  return !IsEmpty(indexEntry.boundsMin, indexEntry.boundsMax) &&
+         LineIntersectsBox(rayOrigin, rayDirection, indexEntry.boundsMin, indexEntry.boundsMax);
+}
+
+bool HitTestIndex::GetCandidateChildren(uint32_t entry, const Vector4& rayOrigin, const Vector4& rayDirection, std::vector<uint32_t>& positions) const
+{
+  const Entry& indexEntry = mEntries[entry];
+  if(indexEntry.grid == INVALID_ENTRY || std::fpclassify(rayDirection.z) == FP_ZERO)
+  {
+    return false;
+  }
+  const Grid& grid = mGrids[indexEntry.grid];
+
+  // The children can only be hit where the ray crosses their depth range
+  const float distance1 = (grid.minZ - rayOrigin.z) / rayDirection.z;
+  const float distance2 = (grid.maxZ - rayOrigin.z) / rayDirection.z;
+  const float x1        = rayOrigin.x + rayDirection.x * distance1;
+  const float x2        = rayOrigin.x + rayDirection.x * distance2;
+  const float y1        = rayOrigin.y + rayDirection.y * distance1;
+  const float y2        = rayOrigin.y + rayDirection.y * distance2;
+  if(!std::isfinite(x1) || !std::isfinite(x2) || !std::isfinite(y1) || !std::isfinite(y2))
+  {
+    return false;
+  }
+
+  positions.assign(grid.largePositions.begin(), grid.largePositions.end());
+
+  int32_t firstColumn = GetCell(std::min(x1, x2), grid.origin.x, grid.inverseCellSize.x, grid.columns);
+  int32_t lastColumn  = GetCell(std::max(x1, x2), grid.origin.x, grid.inverseCellSize.x, grid.columns);
+  int32_t firstRow    = GetCell(std::min(y1, y2), grid.origin.y, grid.inverseCellSize.y, grid.rows);
+  int32_t lastRow     = GetCell(std::max(y1, y2), grid.origin.y, grid.inverseCellSize.y, grid.rows);
+  if(lastColumn < 0 || firstColumn >= static_cast<int32_t>(grid.columns) || lastRow < 0 || firstRow >= static_cast<int32_t>(grid.rows))
+  {
+    // The ray passes beside the grid
+    return true;
+  }
+  firstColumn = std::max(firstColumn, 0);
+  lastColumn  = std::min(lastColumn, static_cast<int32_t>(grid.columns) - 1);
+  firstRow    = std::max(firstRow, 0);
+  lastRow     = std::min(lastRow, static_cast<int32_t>(grid.rows) - 1);
+
+  const uint32_t cellCount = static_cast<uint32_t>((lastColumn - firstColumn + 1) * (lastRow - firstRow + 1));
+  if(cellCount * 2u > grid.columns * grid.rows)
+  {
+    // A slanted ray, visiting the children is as fast
+    return false;
+  }
+
+  for(int32_t row = firstRow; row <= lastRow; ++row)
+  {
+    for(int32_t column = firstColumn; column <= lastColumn; ++column)
+    {
+      const uint32_t cell = static_cast<uint32_t>(row) * grid.columns + static_cast<uint32_t>(column);
+      positions.insert(positions.end(), grid.positions.begin() + grid.cellStarts[cell], grid.positions.begin() + grid.cellStarts[cell + 1u]);
+    }
+  }
+
+  if(cellCount > 1u || !grid.largePositions.empty())
+  {
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+  }
+  return true;
+}
+
+void HitTestIndex::Build(Layer& layer)
+{
+  mEntries.clear();
+  mGrids.clear();
+
+  mEntries.push_back(Entry{&layer, Vector3::ZERO, Vector3::ZERO, 0u, 0u, INVALID_ENTRY});
+  BuildEntry(0u, layer);
+}
+
+void HitTestIndex::BuildEntry(uint32_t entry, Actor& actor)
+{
+  Vector3 boundsMin, boundsMax;
+  ComputeActorBounds(actor, mBehavior, boundsMin, boundsMax);
+
+  if(actor.GetChildCount() > 0u)
+  {
+    const ActorContainer& children   = GetChildrenInRenderOrder(actor);
+    const uint32_t        childCount = static_cast<uint32_t>(children.size());
+    const uint32_t        firstChild = static_cast<uint32_t>(mEntries.size());
+
+    // The entries of the children are added before their own children, so that they are contiguous
+    mEntries.resize(firstChild + childCount);
+    for(uint32_t i = 0u; i < childCount; ++i)
+    {
+      Entry& childEntry = mEntries[firstChild + i];
+      childEntry.actor  = children[i].Get();
+      SetEmpty(childEntry.boundsMin, childEntry.boundsMax);
+      childEntry.firstChild = 0u;
+      childEntry.childCount = 0u;
+      childEntry.grid       = INVALID_ENTRY;
+    }
+
+    uint32_t gridChildCount = 0u;
+    for(uint32_t i = 0u; i < childCount; ++i)
+    {
+      // The layers are hit-tested separately
+      Actor& child = *children[i];
+      if(!child.IsLayer())
+      {
+        BuildEntry(firstChild + i, child);
+        Merge(boundsMin, boundsMax, mEntries[firstChild + i].boundsMin, mEntries[firstChild + i].boundsMax);
+        ++gridChildCount;
+      }
+    }
+
+    mEntries[entry].firstChild = firstChild;
+    mEntries[entry].childCount = childCount;
+    if(gridChildCount >= GRID_MINIMUM_CHILD_COUNT)
+    {
+      mEntries[entry].grid = BuildGrid(entry);
+    }
+  }
+
+  mEntries[entry].boundsMin = boundsMin;
+  mEntries[entry].boundsMax = boundsMax;
+}
+
+uint32_t HitTestIndex::BuildGrid(uint32_t entry)
+{
+  const uint32_t firstChild = mEntries[entry].firstChild;
+  const uint32_t childCount = mEntries[entry].childCount;
+
+  // The extent of the bounded children
+  Vector3  extentMin, extentMax;
+  uint32_t boundedCount = 0u;
+  SetEmpty(extentMin, extentMax);
+  for(uint32_t i = 0u; i < childCount; ++i)
+  {
+    const Entry& child = mEntries[firstChild + i];
+    if(!IsEmpty(child.boundsMin, child.boundsMax) && IsBounded(child.boundsMin, child.boundsMax))
+    {
+      Merge(extentMin, extentMax, child.boundsMin, child.boundsMax);
+      ++boundedCount;
+    }
+  }
+
+  const float width  = extentMax.x - extentMin.x;
+  const float height = extentMax.y - extentMin.y;
+  if(boundedCount < GRID_MINIMUM_CHILD_COUNT || !std::isfinite(width) || !std::isfinite(height) || (width <= 0.0f && height <= 0.0f))
+  {
+    return INVALID_ENTRY;
+  }
+
+  Grid grid;
+  grid.origin = Vector2(extentMin.x, extentMin.y);
+  grid.minZ   = extentMin.z;
+  grid.maxZ   = extentMax.z;
+
+  const uint32_t targetCellCount = Dali::Clamp(boundedCount / GRID_CHILDREN_PER_CELL, 1u, GRID_MAXIMUM_CELL_COUNT);
+  if(width <= 0.0f)
+  {
+    grid.columns = 1u;
+    grid.rows    = targetCellCount;
+  }
+  else if(height <= 0.0f)
+  {
+    grid.columns = targetCellCount;
+    grid.rows    = 1u;
+  }
+  else
+  {
+    const float columns = std::round(std::sqrt(static_cast<float>(targetCellCount) * width / height));
+    grid.columns        = static_cast<uint32_t>(Dali::Clamp(columns, 1.0f, static_cast<float>(targetCellCount)));
+    grid.rows           = std::max(targetCellCount / grid.columns, 1u);
+  }
+  grid.inverseCellSize = Vector2(width > 0.0f ? static_cast<float>(grid.columns) / width : 0.0f,
+                                 height > 0.0f ? static_cast<float>(grid.rows) / height : 0.0f);
+
+  // Count, then fill the positions of each cell
+  const uint32_t totalCellCount = grid.columns * grid.rows;
+  grid.cellStarts.assign(totalCellCount + 1u, 0u);
+
+  struct CellRange
+  {
+    int32_t firstColumn, lastColumn, firstRow, lastRow;
+  };
+  std::vector<CellRange> ranges(childCount, CellRange{0, -1, 0, -1});
+
+  for(uint32_t i = 0u; i < childCount; ++i)
+  {
+    const Entry& child = mEntries[firstChild + i];
+    if(IsEmpty(child.boundsMin, child.boundsMax))
+    {
+      continue; // A layer
+    }
+    if(!IsBounded(child.boundsMin, child.boundsMax))
+    {
+      grid.largePositions.push_back(i);
+      continue;
+    }
+
+    CellRange& range  = ranges[i];
+    range.firstColumn = std::max(GetCell(child.boundsMin.x, grid.origin.x, grid.inverseCellSize.x, grid.columns), 0);
+    range.lastColumn  = std::min(GetCell(child.boundsMax.x, grid.origin.x, grid.inverseCellSize.x, grid.columns), static_cast<int32_t>(grid.columns) - 1);
+    range.firstRow    = std::max(GetCell(child.boundsMin.y, grid.origin.y, grid.inverseCellSize.y, grid.rows), 0);
+    range.lastRow     = std::min(GetCell(child.boundsMax.y, grid.origin.y, grid.inverseCellSize.y, grid.rows), static_cast<int32_t>(grid.rows) - 1);
+
+    const uint32_t cellCount = static_cast<uint32_t>((range.lastColumn - range.firstColumn + 1) * (range.lastRow - range.firstRow + 1));
+    if(cellCount * 4u > totalCellCount && totalCellCount >= 4u)
+    {
+      // e.g. a background, which would be in most of the cells
+      grid.largePositions.push_back(i);
+      range.lastColumn = -1;
+      continue;
+    }
+
+    for(int32_t row = range.firstRow; row <= range.lastRow; ++row)
+    {
+      for(int32_t column = range.firstColumn; column <= range.lastColumn; ++column)
+      {
+        ++grid.cellStarts[static_cast<uint32_t>(row) * grid.columns + static_cast<uint32_t>(column) + 1u];
+      }
+    }
+  }
+
+  for(uint32_t cell = 0u; cell < totalCellCount; ++cell)
+  {
+    grid.cellStarts[cell + 1u] += grid.cellStarts[cell];
+  }
+
+  grid.positions.resize(grid.cellStarts[totalCellCount]);
+  std::vector<uint32_t> cellEnds(grid.cellStarts.begin(), grid.cellStarts.end() - 1);
+  for(uint32_t i = 0u; i < childCount; ++i)
+  {
+    const CellRange& range = ranges[i];
+    for(int32_t row = range.firstRow; row <= range.lastRow; ++row)
+    {
+      for(int32_t column = range.firstColumn; column <= range.lastColumn; ++column)
+      {
+        grid.positions[cellEnds[static_cast<uint32_t>(row) * grid.columns + static_cast<uint32_t>(column)]++] = i;
+      }
+    }
+  }
+
+  mGrids.push_back(std::move(grid));
+  return static_cast<uint32_t>(mGrids.size() - 1u);
+}
+
+} // namespace Internal
+
+} // namespace Dali
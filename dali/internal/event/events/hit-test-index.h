@@ -0,0 +1,220 @@
+#ifndef DALI_INTERNAL_HIT_TEST_INDEX_H
+#define DALI_INTERNAL_HIT_TEST_INDEX_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/actors/layer.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+namespace Dali
+{
+namespace Internal
+{
+class Actor;
+class Layer;
+class Scene;
+
+/**
+ * Spatial index of the actors of a layer, used by the hit-test algorithm to skip the actors which a ray can not hit.
+ *
+ * The index mirrors the actor tree of the layer, in the render order used by the hit-test: each entry holds the
+ * world-space bounds of an actor and of its descendants which are not in another layer. The children of an actor
+ * with many children are also bucketed in a 2D grid, so that only the children near the ray are visited.
+ * The bounds contain everything which the ray tests of the hit-test algorithm can hit, so skipping an actor
+ * never changes the result.
+ *
+ * The index is rebuilt lazily, the first time it is used after a world matrix or a size has been changed by
+ * the update, or after an actor of the scene has been added, removed, reordered or had its touch area changed.
+ * It is only used by the layers with at least DALI_HIT_TEST_INDEX_MINIMUM_ACTOR_COUNT actors.
+ */
+class HitTestIndex
+{
+public:
+  static constexpr uint32_t INVALID_ENTRY = std::numeric_limits<uint32_t>::max();
+
+  /**
+   * Marks the index as being used by a hit-test, so that it is not rebuilt by a nested hit-test
+   * (e.g. through a frame-buffer mapping actor) while its entries are walked.
+   */
+  class ScopedUse
+  {
+  public:
+    explicit ScopedUse(HitTestIndex* index)
+    : mIndex(index)
+    {
+      if(mIndex)
+      {
+        ++mIndex->mUseCount;
+      }
+    }
+
+    ~ScopedUse()
+    {
+      if(mIndex)
+      {
+        --mIndex->mUseCount;
+      }
+    }
+
+    ScopedUse(const ScopedUse&)            = delete;
+    ScopedUse& operator=(const ScopedUse&) = delete;
+
+  private:
+    HitTestIndex* mIndex;
+  };
+
+  /**
+   * Constructor.
+   */
+  HitTestIndex();
+
+  /**
+   * Destructor.
+   */
+  ~HitTestIndex();
+
+  /**
+   * Brings the index up to date with the layer, unless it is being used.
+   * @param[in] layer The layer owning the index
+   * @return True if the index may be used to hit-test the layer
+   */
+  bool Update(Layer& layer);
+
+  /**
+   * Retrieves the entry of an actor of the layer.
+   * @param[in] actor The actor
+   * @return The entry, or INVALID_ENTRY if the actor is not in the index
+   */
+  uint32_t FindEntry(const Actor& actor) const;
+
+  /**
+   * Retrieves the entry of a child.
+   * @param[in] entry The entry of the parent
+   * @param[in] position The position of the child in the render order of the parent
+   * @param[in] child The child
+   * @return The entry, or INVALID_ENTRY if the index does not match the children of the parent
+   */
+  uint32_t GetChildEntry(uint32_t entry, uint32_t position, const Actor& child) const;
+
+  /**
+   * Query whether the entry holds the given number of children.
+   * @param[in] entry The entry
+   * @param[in] childCount The current number of children of its actor
+   * @return True if the children of the entry may be retrieved with GetChildEntry()
+   */
+  bool HasChildCount(uint32_t entry, uint32_t childCount) const
+  {
+    return mEntries[entry].childCount == childCount;
+  }
+
+  /**
+   * Query whether a ray may hit the actor of an entry, or one of its descendants which are not in another layer.
+   * @param[in] entry The entry
+   * @param[in] rayOrigin The ray origin in the world's reference system
+   * @param[in] rayDirection The ray direction in the world's reference system
+   * @return False if none of them can be hit
+   */
+  bool MayHitSubtree(uint32_t entry, const Vector4& rayOrigin, const Vector4& rayDirection) const;
+
+  /**
+   * Retrieves the children of an entry which a ray may hit, if they are bucketed in a grid.
+   * @param[in] entry The entry
+   * @param[in] rayOrigin The ray origin in the world's reference system
+   * @param[in] rayDirection The ray direction in the world's reference system
+   * @param[out] positions The positions of the children in the render order, ascending
+   * @return False if all the children must be visited instead
+   */
+  bool GetCandidateChildren(uint32_t entry, const Vector4& rayOrigin, const Vector4& rayDirection, std::vector<uint32_t>& positions) const;
+
+private:
+  /**
+   * The bounds of an actor and of its descendants.
+   */
+  struct Entry
+  {
+    const Actor* actor;
+    Vector3      boundsMin;
+    Vector3      boundsMax;
+    uint32_t     firstChild; ///< The entries of the children are contiguous, in render order
+    uint32_t     childCount;
+    uint32_t     grid; ///< Index in mGrids, or INVALID_ENTRY
+  };
+
+  /**
+   * The children of an entry bucketed by their XY bounds.
+   */
+  struct Grid
+  {
+    Vector2               origin;
+    Vector2               inverseCellSize;
+    uint32_t              columns;
+    uint32_t              rows;
+    float                 minZ;
+    float                 maxZ;
+    std::vector<uint32_t> cellStarts;     ///< Start of the positions of each cell, terminated by the position count
+    std::vector<uint32_t> positions;      ///< Positions of the children of each cell
+    std::vector<uint32_t> largePositions; ///< Positions of the children which cover too many cells, always visited
+  };
+
+  /**
+   * Builds the entries of the layer.
+   * @param[in] layer The layer
+   */
+  void Build(Layer& layer);
+
+  /**
+   * Computes the bounds of an entry and builds the entries of its children.
+   * @param[in] entry The entry of the actor
+   * @param[in] actor The actor
+   */
+  void BuildEntry(uint32_t entry, Actor& actor);
+
+  /**
+   * Buckets the children of an entry in a grid.
+   * @param[in] entry The entry
+   * @return The index of the grid, or INVALID_ENTRY if the children are not spread out
+   */
+  uint32_t BuildGrid(uint32_t entry);
+
+  std::vector<Entry> mEntries;
+  std::vector<Grid>  mGrids;
+
+  const Scene*          mScene;             ///< The scene of the layer when the index was checked
+  uint32_t              mHierarchyStamp;    ///< Scene::GetHitTestIndexStamp() when the index was checked
+  uint32_t              mTransformStamp;    ///< The world matrix change count of the layer when the index was built
+  uint32_t              mMinimumActorCount; ///< The number of actors required to use the index, 0 if disabled
+  uint32_t              mUseCount;          ///< The number of hit-tests using the index
+  Dali::Layer::Behavior mBehavior;          ///< The layer behavior when the index was built
+  bool                  mChecked : 1;       ///< Whether the actor count has been checked since the hierarchy changed
+  bool                  mBuilt : 1;         ///< Whether the entries have been built since the hierarchy changed
+  bool                  mEnoughActors : 1;  ///< Whether the layer has enough actors to use the index
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_HIT_TEST_INDEX_H
@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/object/type-registry.h>
+#include <dali/devel-api/rendering/shader-devel.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/integration-api/string-utils.h>
 #include <dali/internal/event/common/property-helper.h> // DALI_PROPERTY_TABLE_BEGIN, DALI_PROPERTY, DALI_PROPERTY_TABLE_END
@@ -51,7 +52,8 @@ Dali::Scripting::StringEnum ShaderHintsTable[] =
   {{"NONE", Dali::Shader::Hint::NONE},
    {"OUTPUT_IS_TRANSPARENT", Dali::Shader::Hint::OUTPUT_IS_TRANSPARENT},
    {"MODIFIES_GEOMETRY", Dali::Shader::Hint::MODIFIES_GEOMETRY},
-   {"FILE_CACHE_SUPPORT", Dali::Shader::Hint::FILE_CACHE_SUPPORT}};
+   {"FILE_CACHE_SUPPORT", Dali::Shader::Hint::FILE_CACHE_SUPPORT},
+   {"AUTO_INSTANCING", Dali::DevelShader::Hint::AUTO_INSTANCING}};
 
 const uint32_t ShaderHintsTableSize = static_cast<uint32_t>(sizeof(ShaderHintsTable) / sizeof(ShaderHintsTable[0]));
 
@@ -95,6 +97,11 @@ Property::Value HintString(const Dali::Shader::Hint::Value& hints)
     AppendString(s, "MODIFIES_GEOMETRY");
   }
 
+  if(hints & Dali::DevelShader::Hint::AUTO_INSTANCING)
+  {
+    AppendString(s, "AUTO_INSTANCING");
+  }
+
   return Property::Value(s.c_str());
 }
 
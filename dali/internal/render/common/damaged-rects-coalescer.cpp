@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/damaged-rects-coalescer.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <limits>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Render
+{
+namespace
+{
+constexpr uint32_t NO_PARTNER = std::numeric_limits<uint32_t>::max();
+
+/**
+ * The cost of merging two rects. Overlapping rects are always merged first, so that the result is disjoint.
+ */
+struct MergeCost
+{
+  bool operator<(const MergeCost& rhs) const
+  {
+    return overlapping != rhs.overlapping ? overlapping : wastedArea < rhs.wastedArea;
+  }
+
+  bool    overlapping{false};
+  int64_t wastedArea{std::numeric_limits<int64_t>::max()}; ///< Area of the bounding box which none of the two rects covers
+};
+
+int64_t GetArea(const BoundsInteger& rect)
+{
+  return static_cast<int64_t>(rect.width) * static_cast<int64_t>(rect.height);
+}
+
+MergeCost GetMergeCost(const BoundsInteger& lhs, const BoundsInteger& rhs)
+{
+  BoundsInteger merged = lhs;
+  merged.Merge(rhs);
+
+  MergeCost cost;
+  cost.overlapping = lhs.Intersects(rhs);
+  cost.wastedArea  = GetArea(merged) - GetArea(lhs) - GetArea(rhs);
+  if(cost.overlapping)
+  {
+    BoundsInteger intersection = lhs;
+    intersection.Intersect(rhs);
+    cost.wastedArea += GetArea(intersection);
+  }
+  return cost;
+}
+
+/**
+ * The cheapest merge of a rect.
+ */
+struct Candidate
+{
+  MergeCost cost;
+  uint32_t  partner{NO_PARTNER};
+};
+
+Candidate FindCandidate(const std::vector<BoundsInteger>& rects, const std::vector<bool>& merged, uint32_t index)
+{
+  Candidate candidate;
+  for(uint32_t other = 0u; other < rects.size(); ++other)
+  {
+    if(other != index && !merged[other])
+    {
+      const MergeCost cost = GetMergeCost(rects[index], rects[other]);
+      if(cost < candidate.cost)
+      {
+        candidate.cost    = cost;
+        candidate.partner = other;
+      }
+    }
+  }
+  return candidate;
+}
+
+/**
+ * Gets the area covered by the rects, counting the overlapping areas once.
+ * The x edges of the rects split the plane into slabs, and the y intervals of the rects crossing each slab are merged.
+ */
+int64_t GetUnionArea(const std::vector<BoundsInteger>& rects)
+{
+  std::vector<int32_t> edges;
+  edges.reserve(rects.size() * 2u);
+  for(const auto& rect : rects)
+  {
+    edges.push_back(rect.x);
+    edges.push_back(rect.x + rect.width);
+  }
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  int64_t                                  area = 0;
+  std::vector<std::pair<int32_t, int32_t>> intervals;
+  for(uint32_t i = 1u; i < edges.size(); ++i)
+  {
+    intervals.clear();
+    for(const auto& rect : rects)
+    {
+      if(rect.x <= edges[i - 1u] && edges[i] <= rect.x + rect.width)
+      {
+        intervals.emplace_back(rect.y, rect.y + rect.height);
+      }
+    }
+    std::sort(intervals.begin(), intervals.end());
+
+    int64_t height = 0;
+    int32_t end    = std::numeric_limits<int32_t>::min();
+    for(const auto& interval : intervals)
+    {
+      if(interval.second > end)
+      {
+        height += interval.second - std::max(interval.first, end);
+        end = interval.second;
+      }
+    }
+    area += height * (edges[i] - edges[i - 1u]);
+  }
+  return area;
+}
+
+} // unnamed namespace
+
+float CoalesceDamagedRects(std::vector<BoundsInteger>& damagedRects, uint32_t maximumCount)
+{
+  damagedRects.erase(std::remove_if(damagedRects.begin(), damagedRects.end(), [](const BoundsInteger& rect)
+                                    { return rect.IsEmpty() || !rect.IsValid(); }),
+                     damagedRects.end());
+
+  const int64_t damagedArea = GetUnionArea(damagedRects);
+  if(damagedArea == 0)
+  {
+    return 1.0f;
+  }
+
+  const uint32_t         count = static_cast<uint32_t>(damagedRects.size());
+  std::vector<bool>      merged(count, false); ///< Whether the rect was merged into another one
+  std::vector<Candidate> candidates(count);
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    candidates[i] = FindCandidate(damagedRects, merged, i);
+  }
+
+  uint32_t remainingCount = count;
+  while(remainingCount > 1u)
+  {
+    uint32_t best = NO_PARTNER;
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      if(!merged[i] && (best == NO_PARTNER || candidates[i].cost < candidates[best].cost))
+      {
+        best = i;
+      }
+    }
+
+    const Candidate& candidate = candidates[best];
+    if(!candidate.cost.overlapping && remainingCount <= maximumCount)
+    {
+      break;
+    }
+
+    const uint32_t partner = candidate.partner;
+    damagedRects[best].Merge(damagedRects[partner]);
+    merged[partner] = true;
+    --remainingCount;
+
+    // Only the candidates involving the two merged rects are affected
+    candidates[best] = FindCandidate(damagedRects, merged, best);
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      if(merged[i] || i == best)
+      {
+        continue;
+      }
+      if(candidates[i].partner == best || candidates[i].partner == partner)
+      {
+        candidates[i] = FindCandidate(damagedRects, merged, i);
+      }
+      else
+      {
+        const MergeCost cost = GetMergeCost(damagedRects[i], damagedRects[best]);
+        if(cost < candidates[i].cost)
+        {
+          candidates[i].cost    = cost;
+          candidates[i].partner = best;
+        }
+      }
+    }
+  }
+
+  int64_t  coalescedArea = 0;
+  uint32_t keptCount     = 0u;
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    if(!merged[i])
+    {
+      coalescedArea += GetArea(damagedRects[i]);
+      damagedRects[keptCount++] = damagedRects[i];
+    }
+  }
+  damagedRects.resize(keptCount);
+
+  return static_cast<float>(static_cast<double>(coalescedArea) / static_cast<double>(damagedArea));
+}
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
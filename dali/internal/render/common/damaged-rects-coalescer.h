@@ -0,0 +1,53 @@
+#ifndef DALI_INTERNAL_RENDER_DAMAGED_RECTS_COALESCER_H
+#define DALI_INTERNAL_RENDER_DAMAGED_RECTS_COALESCER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/vector-wrapper.h>
+#include <dali/public-api/math/rect.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Render
+{
+/**
+ * Merges the damaged rects of a frame into a few rects which do not overlap.
+ *
+ * The rects are merged pairwise: overlapping rects first, then the pair whose bounding box
+ * adds the smallest area which was not damaged, until at most maximumCount rects are left.
+ * Every damaged pixel stays covered by the result.
+ *
+ * @param[in,out] damagedRects The damaged rects, replaced by the merged rects
+ * @param[in] maximumCount The maximum number of rects to keep, which must not be zero
+ * @return The area of the merged rects divided by the area covered by the damaged rects, which is never below 1
+ */
+float CoalesceDamagedRects(std::vector<BoundsInteger>& damagedRects, uint32_t maximumCount);
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RENDER_DAMAGED_RECTS_COALESCER_H
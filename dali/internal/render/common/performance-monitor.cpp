@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/performance-monitor.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/common/environment-variable.h>
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace
+{
+constexpr const char* PERFORMANCE_MONITOR_ENV      = "DALI_PERFORMANCE_MONITOR";
+constexpr const char* PERFORMANCE_MONITOR_DUMP_ENV = "DALI_PERFORMANCE_MONITOR_DUMP";
+constexpr const char* JSON_EXTENSION               = ".json";
+
+constexpr uint32_t MAX_FRAMES_PER_METRIC = 4096u; ///< Only the latest frames are kept, so a long run never grows the histograms.
+
+constexpr int32_t ENABLED_UNKNOWN = -1;
+
+using Clock     = std::chrono::steady_clock;
+using TimePoint = Clock::time_point;
+
+std::atomic<int32_t> gEnabled{ENABLED_UNKNOWN};
+
+/**
+ * @brief Ring buffer of the per-frame values of one metric.
+ */
+struct FrameHistory
+{
+  std::vector<uint64_t> values;
+  uint32_t              writeIndex{0u};
+
+  void Record(uint64_t value)
+  {
+    if(values.size() < MAX_FRAMES_PER_METRIC)
+    {
+      values.push_back(value);
+    }
+    else
+    {
+      values[writeIndex] = value;
+    }
+    writeIndex = (writeIndex + 1u) % MAX_FRAMES_PER_METRIC;
+  }
+};
+
+/**
+ * @brief The histories of every metric, shared by all threads. Only touched once per frame per thread.
+ */
+struct Histories
+{
+  std::mutex   mutex;
+  FrameHistory metrics[PerformanceMonitor::METRIC_COUNT];
+  uint64_t     workerValues[PerformanceMonitor::METRIC_COUNT]{}; ///< Values flushed by worker threads, merged into the next update frame
+  uint32_t     workerMetrics{0u};                                ///< Bit mask of the metrics worker threads have ever flushed
+};
+
+Histories& GetHistories()
+{
+  static Histories histories;
+  return histories;
+}
+
+/**
+ * @brief The values of the frame in progress on one thread.
+ */
+struct ThreadFrame
+{
+  uint64_t  values[PerformanceMonitor::METRIC_COUNT]{};
+  TimePoint startTimes[PerformanceMonitor::METRIC_COUNT]{};
+  uint32_t  usedMetrics{0u}; ///< Bit mask of the metrics this thread has ever recorded
+  TimePoint lastFrameTime{};
+  bool      hasLastFrame{false};
+};
+
+static_assert(PerformanceMonitor::METRIC_COUNT <= 32, "usedMetrics needs more bits");
+
+thread_local ThreadFrame gThreadFrame;
+
+bool IsTimer(PerformanceMonitor::Metric metric)
+{
+  switch(metric)
+  {
+    case PerformanceMonitor::MATRIX_MULTIPLYS:
+    case PerformanceMonitor::QUATERNION_TO_MATRIX:
+    case PerformanceMonitor::FLOAT_POINT_MULTIPLY:
+    case PerformanceMonitor::ANIMATORS_APPLIED:
+    case PerformanceMonitor::CONSTRAINTS_APPLIED:
+    case PerformanceMonitor::CONSTRAINTS_SKIPPED:
+    {
+      return false;
+    }
+    default:
+    {
+      return true;
+    }
+  }
+}
+
+/**
+ * @brief Pushes the frame of the calling thread into the histories and clears it.
+ * @param[in] frame The frame of the calling thread
+ * @param[in] mergeWorkers Whether to add the values flushed by the worker threads since the last update frame
+ */
+void FlushThreadFrame(ThreadFrame& frame, bool mergeWorkers)
+{
+  if(!mergeWorkers && frame.usedMetrics == 0u)
+  {
+    return;
+  }
+
+  Histories&                  histories = GetHistories();
+  std::lock_guard<std::mutex> lock(histories.mutex);
+
+  const uint32_t workerMetrics = mergeWorkers ? histories.workerMetrics : 0u;
+  const uint32_t usedMetrics   = frame.usedMetrics | workerMetrics;
+  for(uint32_t i = 0u; i < PerformanceMonitor::METRIC_COUNT; ++i)
+  {
+    // Metrics used at least once by this thread are recorded every frame, even as zero, so the percentiles are not biased.
+    if(usedMetrics & (1u << i))
+    {
+      uint64_t value = frame.values[i];
+      if(workerMetrics & (1u << i))
+      {
+        value += histories.workerValues[i];
+        histories.workerValues[i] = 0u;
+      }
+      histories.metrics[i].Record(value);
+      frame.values[i] = 0u;
+    }
+  }
+}
+
+double Percentile(const std::vector<uint64_t>& sorted, double p)
+{
+  const std::size_t index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1u));
+  return static_cast<double>(sorted[index]);
+}
+
+} // unnamed namespace
+
+bool PerformanceMonitor::IsEnabled()
+{
+  int32_t enabled = gEnabled.load(std::memory_order_relaxed);
+  if(DALI_UNLIKELY(enabled == ENABLED_UNKNOWN))
+  {
+    enabled = EnvironmentVariable::GetBooleanValue(PERFORMANCE_MONITOR_ENV, false) ? 1 : 0;
+    gEnabled.store(enabled, std::memory_order_relaxed);
+  }
+  return enabled != 0;
+}
+
+void PerformanceMonitor::SetEnabled(bool enabled)
+{
+  gEnabled.store(enabled ? 1 : 0, std::memory_order_relaxed);
+}
+
+void PerformanceMonitor::Start(Metric metric)
+{
+  gThreadFrame.startTimes[metric] = Clock::now();
+}
+
+void PerformanceMonitor::End(Metric metric)
+{
+  ThreadFrame& frame = gThreadFrame;
+  frame.values[metric] += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - frame.startTimes[metric]).count());
+  frame.usedMetrics |= (1u << metric);
+}
+
+void PerformanceMonitor::Increase(Metric metric, uint64_t value)
+{
+  ThreadFrame& frame = gThreadFrame;
+  frame.values[metric] += value;
+  frame.usedMetrics |= (1u << metric);
+}
+
+void PerformanceMonitor::NextFrame()
+{
+  ThreadFrame& frame = gThreadFrame;
+
+  const TimePoint now = Clock::now();
+  if(frame.hasLastFrame)
+  {
+    frame.values[FRAME_RATE] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - frame.lastFrameTime).count());
+    frame.usedMetrics |= (1u << FRAME_RATE);
+  }
+  frame.lastFrameTime = now;
+  frame.hasLastFrame  = true;
+
+  FlushThreadFrame(frame, true);
+}
+
+void PerformanceMonitor::Flush()
+{
+  FlushThreadFrame(gThreadFrame, false);
+}
+
+void PerformanceMonitor::FlushWorker()
+{
+  ThreadFrame& frame = gThreadFrame;
+  if(frame.usedMetrics == 0u)
+  {
+    return;
+  }
+
+  Histories&                  histories = GetHistories();
+  std::lock_guard<std::mutex> lock(histories.mutex);
+  for(uint32_t i = 0u; i < METRIC_COUNT; ++i)
+  {
+    if(frame.usedMetrics & (1u << i))
+    {
+      histories.workerValues[i] += frame.values[i];
+      frame.values[i] = 0u;
+    }
+  }
+  histories.workerMetrics |= frame.usedMetrics;
+}
+
+PerformanceMonitor::Statistics PerformanceMonitor::GetStatistics(Metric metric)
+{
+  std::vector<uint64_t> values;
+  {
+    Histories&                  histories = GetHistories();
+    std::lock_guard<std::mutex> lock(histories.mutex);
+    values = histories.metrics[metric].values;
+  }
+
+  Statistics statistics;
+  if(values.empty())
+  {
+    return statistics;
+  }
+
+  std::sort(values.begin(), values.end());
+
+  double sum = 0.0;
+  for(auto value : values)
+  {
+    sum += static_cast<double>(value);
+  }
+
+  // Timers are recorded in nanoseconds, reported in microseconds.
+  const double scale = IsTimer(metric) ? 0.001 : 1.0;
+
+  statistics.frames = static_cast<uint32_t>(values.size());
+  statistics.mean   = scale * sum / static_cast<double>(values.size());
+  statistics.p50    = scale * Percentile(values, 0.50);
+  statistics.p95    = scale * Percentile(values, 0.95);
+  statistics.p99    = scale * Percentile(values, 0.99);
+  statistics.max    = scale * static_cast<double>(values.back());
+  return statistics;
+}
+
+const char* PerformanceMonitor::GetMetricName(Metric metric)
+{
+  switch(metric)
+  {
+    case FRAME_RATE:
+    {
+      return "FRAME_INTERVAL";
+    }
+    case MATRIX_MULTIPLYS:
+    {
+      return "MATRIX_MULTIPLYS";
+    }
+    case QUATERNION_TO_MATRIX:
+    {
+      return "QUATERNION_TO_MATRIX";
+    }
+    case FLOAT_POINT_MULTIPLY:
+    {
+      return "FLOAT_POINT_MULTIPLY";
+    }
+    case RESET_PROPERTIES:
+    {
+      return "RESET_PROPERTIES";
+    }
+    case PROCESS_MESSAGES:
+    {
+      return "PROCESS_MESSAGES";
+    }
+    case ANIMATE_NODES:
+    {
+      return "ANIMATE_NODES";
+    }
+    case ANIMATORS_APPLIED:
+    {
+      return "ANIMATORS_APPLIED";
+    }
+    case APPLY_CONSTRAINTS:
+    {
+      return "APPLY_CONSTRAINTS";
+    }
+    case CONSTRAINTS_APPLIED:
+    {
+      return "CONSTRAINTS_APPLIED";
+    }
+    case CONSTRAINTS_SKIPPED:
+    {
+      return "CONSTRAINTS_SKIPPED";
+    }
+    case UPDATE_NODES:
+    {
+      return "UPDATE_NODES";
+    }
+    case PREPARE_RENDERABLES:
+    {
+      return "PREPARE_RENDERABLES";
+    }
+    case PROCESS_RENDER_TASKS:
+    {
+      return "PROCESS_RENDER_TASKS";
+    }
+    case DRAW_NODES:
+    {
+      return "DRAW_NODES";
+    }
+    case UPDATE:
+    {
+      return "UPDATE";
+    }
+    default:
+    {
+      return "UNKNOWN";
+    }
+  }
+}
+
+std::string PerformanceMonitor::Dump(Format format)
+{
+  std::ostringstream oss;
+  oss.setf(std::ios::fixed);
+  oss.precision(3);
+
+  if(format == Format::CSV)
+  {
+    oss << "metric,unit,frames,mean,p50,p95,p99,max\n";
+  }
+  else
+  {
+    oss << "{\"metrics\":[";
+  }
+
+  bool first = true;
+  for(uint32_t i = 0u; i < METRIC_COUNT; ++i)
+  {
+    const Metric     metric     = static_cast<Metric>(i);
+    const Statistics statistics = GetStatistics(metric);
+    if(statistics.frames == 0u)
+    {
+      continue;
+    }
+
+    const char* unit = IsTimer(metric) ? "us" : "count";
+    if(format == Format::CSV)
+    {
+      oss << GetMetricName(metric) << ',' << unit << ',' << statistics.frames << ',' << statistics.mean << ',' << statistics.p50 << ','
+          << statistics.p95 << ',' << statistics.p99 << ',' << statistics.max << '\n';
+    }
+    else
+    {
+      oss << (first ? "" : ",") << "{\"name\":\"" << GetMetricName(metric) << "\",\"unit\":\"" << unit << "\",\"frames\":" << statistics.frames
+          << ",\"mean\":" << statistics.mean << ",\"p50\":" << statistics.p50 << ",\"p95\":" << statistics.p95 << ",\"p99\":" << statistics.p99
+          << ",\"max\":" << statistics.max << '}';
+    }
+    first = false;
+  }
+
+  if(format == Format::JSON)
+  {
+    oss << "]}\n";
+  }
+  return oss.str();
+}
+
+bool PerformanceMonitor::DumpToFile(const std::string& path, Format format)
+{
+#if defined(_MSC_VER)
+  FILE* file = nullptr;
+  if(fopen_s(&file, path.c_str(), "w") != 0)
+  {
+    file = nullptr;
+  }
+#else
+  FILE* file = std::fopen(path.c_str(), "w");
+#endif
+  if(!file)
+  {
+    return false;
+  }
+
+  const std::string dump    = Dump(format);
+  const bool        written = std::fwrite(dump.data(), 1u, dump.size(), file) == dump.size();
+  std::fclose(file);
+  return written;
+}
+
+bool PerformanceMonitor::DumpToEnvironmentPath()
+{
+  const auto environmentVariableValue = EnvironmentVariable::GetValue(PERFORMANCE_MONITOR_DUMP_ENV);
+  if(!environmentVariableValue || environmentVariableValue->empty())
+  {
+    return false;
+  }
+
+  const std::string& path = *environmentVariableValue;
+  const std::string extension(JSON_EXTENSION);
+  const bool        isJson = path.size() >= extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+  return DumpToFile(path, isJson ? Format::JSON : Format::CSV);
+}
+
+void PerformanceMonitor::Reset()
+{
+  // Frames in progress on other threads are still flushed as usual.
+  gThreadFrame = ThreadFrame();
+
+  Histories&                  histories = GetHistories();
+  std::lock_guard<std::mutex> lock(histories.mutex);
+  for(auto& history : histories.metrics)
+  {
+    history.values.clear();
+    history.writeIndex = 0u;
+  }
+  for(auto& value : histories.workerValues)
+  {
+    value = 0u;
+  }
+  histories.workerMetrics = 0u;
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_PERFORMANCE_MONITOR_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,13 +18,27 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <string>
+
 namespace Dali
 {
 namespace Internal
 {
 /**
  * @brief PerformanceMonitor.
- * Empty stubs should we decided to hook into monitoring counters
+ *
+ * Collects per-frame timers and counters for the update and render threads.
+ * Each thread accumulates its values in thread-local storage, so recording a metric never takes a lock.
+ * The accumulated values are pushed into per-metric histograms once per frame, by NextFrame() on the
+ * update thread and by Flush() on the render thread. Worker threads hand their values over with
+ * FlushWorker() at the end of each task, and they are added to the next update frame.
+ *
+ * The PERF_MONITOR_* macros are compiled in only when PERFORMANCE_MONITOR_ENABLED is defined
+ * (cmake -DENABLE_PERFORMANCE_MONITOR=ON), and then only record anything if the monitor is enabled
+ * at runtime with the environment variable DALI_PERFORMANCE_MONITOR=1 or SetEnabled().
+ * The statistics are written when Core is destroyed into the file named by DALI_PERFORMANCE_MONITOR_DUMP.
  */
 class PerformanceMonitor
 {
@@ -49,20 +63,167 @@ public:
     PREPARE_RENDERABLES,
     PROCESS_RENDER_TASKS,
     DRAW_NODES,
+    UPDATE,
+    METRIC_COUNT
+  };
+
+  /**
+   * @brief Output format of the dump.
+   */
+  enum class Format
+  {
+    CSV,
+    JSON
+  };
+
+  /**
+   * @brief Distribution of the per-frame values of one metric.
+   * Timers are in microseconds, counters in their own unit. FRAME_RATE holds the frame interval in microseconds.
+   */
+  struct Statistics
+  {
+    uint32_t frames{0u}; ///< Number of frames recorded
+    double   mean{0.0};
+    double   p50{0.0};
+    double   p95{0.0};
+    double   p99{0.0};
+    double   max{0.0};
   };
+
+  /**
+   * @brief Checks whether the monitor records anything.
+   * @return True if enabled by DALI_PERFORMANCE_MONITOR or SetEnabled()
+   */
+  static bool IsEnabled();
+
+  /**
+   * @brief Overrides the runtime enabled state read from the environment.
+   * @param[in] enabled True to start recording
+   */
+  static void SetEnabled(bool enabled);
+
+  /**
+   * @brief Starts a timed event on the calling thread.
+   * @param[in] metric The timer to start
+   */
+  static void Start(Metric metric);
+
+  /**
+   * @brief Ends a timed event on the calling thread and adds its duration to the current frame.
+   * @param[in] metric The timer to stop
+   */
+  static void End(Metric metric);
+
+  /**
+   * @brief Increases a counter of the current frame on the calling thread.
+   * @param[in] metric The counter
+   * @param[in] value The amount to add
+   */
+  static void Increase(Metric metric, uint64_t value);
+
+  /**
+   * @brief Pushes the current frame of the calling thread into the histograms and records the frame interval.
+   * @note Called by the update thread at the start of every update.
+   */
+  static void NextFrame();
+
+  /**
+   * @brief Pushes the current frame of the calling thread into the histograms, without recording the frame interval.
+   * @note Called by the render thread at the end of every render.
+   */
+  static void Flush();
+
+  /**
+   * @brief Hands the values of the calling worker thread over to the next update frame.
+   * @note Called at the end of every task which the update thread runs on a thread pool.
+   */
+  static void FlushWorker();
+
+  /**
+   * @brief Gets the distribution of the recorded frames of a metric.
+   * @param[in] metric The metric
+   * @return The statistics
+   */
+  static Statistics GetStatistics(Metric metric);
+
+  /**
+   * @brief Gets the name of a metric, as written by the dump.
+   * @param[in] metric The metric
+   * @return The name of the metric
+   */
+  static const char* GetMetricName(Metric metric);
+
+  /**
+   * @brief Writes the statistics of every metric into a string.
+   * @param[in] format The output format
+   * @return The dump
+   */
+  static std::string Dump(Format format);
+
+  /**
+   * @brief Writes the statistics of every metric into a file.
+   * @note Never call this from a hot path.
+   * @param[in] path The file path
+   * @param[in] format The output format
+   * @return True if the file was written
+   */
+  static bool DumpToFile(const std::string& path, Format format);
+
+  /**
+   * @brief Writes the statistics of every metric into the file named by the environment variable DALI_PERFORMANCE_MONITOR_DUMP.
+   * The file is written as JSON if its name ends with ".json", otherwise as CSV.
+   * @note Called when Core is destroyed.
+   * @return True if the variable is set and the file was written
+   */
+  static bool DumpToEnvironmentPath();
+
+  /**
+   * @brief Discards all the recorded frames, and the frame in progress on the calling thread.
+   */
+  static void Reset();
 };
 
+#if defined(PERFORMANCE_MONITOR_ENABLED)
+
+#define PERF_MONITOR_IF_ENABLED(x)                        \
+  do                                                      \
+  {                                                       \
+    if(::Dali::Internal::PerformanceMonitor::IsEnabled()) \
+    {                                                     \
+      x;                                                  \
+    }                                                     \
+  } while(0)
+
 #define PERFORMANCE_MONITOR_INIT(x)
-#define PERF_MONITOR_START(x)     // start of timed event
-#define PERF_MONITOR_END(x)       // end of a timed event
-#define INCREASE_COUNTER(x)       // increase a counter by 1
-#define INCREASE_BY(x, y)         // increase a count by x
-#define MATH_INCREASE_COUNTER(x)  // increase a math counter ( MATRIX_MULTIPLYS, QUATERNION_TO_MATRIX, FLOAT_POINT_MULTIPLY)
-#define MATH_INCREASE_BY(x, y)    // increase a math counter by x
-#define PERF_MONITOR_NEXT_FRAME() // update started rendering a new frame
+#define PERF_MONITOR_START(x) PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::Start(x))
+#define PERF_MONITOR_END(x) PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::End(x))
+#define INCREASE_COUNTER(x) PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::Increase(x, 1u))
+#define INCREASE_BY(x, y) PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::Increase(x, y))
+#define MATH_INCREASE_COUNTER(x) PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::Increase(x, 1u))
+#define MATH_INCREASE_BY(x, y) PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::Increase(x, y))
+#define PERF_MONITOR_NEXT_FRAME() PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::NextFrame())
+#define PERF_MONITOR_FLUSH() PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::Flush())
+#define PERF_MONITOR_FLUSH_WORKER() PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::FlushWorker())
+#define PERF_MONITOR_DUMP() PERF_MONITOR_IF_ENABLED(::Dali::Internal::PerformanceMonitor::DumpToEnvironmentPath())
+
+#else
+
+#define PERFORMANCE_MONITOR_INIT(x)
+#define PERF_MONITOR_START(x)       // start of timed event
+#define PERF_MONITOR_END(x)         // end of a timed event
+#define INCREASE_COUNTER(x)         // increase a counter by 1
+#define INCREASE_BY(x, y)           // increase a count by x
+#define MATH_INCREASE_COUNTER(x)    // increase a math counter ( MATRIX_MULTIPLYS, QUATERNION_TO_MATRIX, FLOAT_POINT_MULTIPLY)
+#define MATH_INCREASE_BY(x, y)      // increase a math counter by x
+#define PERF_MONITOR_NEXT_FRAME()   // update started rendering a new frame
+#define PERF_MONITOR_FLUSH()        // render thread finished a frame
+#define PERF_MONITOR_FLUSH_WORKER() // worker thread finished a task
+#define PERF_MONITOR_DUMP()         // write the statistics to the file named by DALI_PERFORMANCE_MONITOR_DUMP
+
+#endif
 
 } // namespace Internal
 
 } // namespace Dali
 
-#endif // DALI_INTERNAL_PERFORMANCE_MONITOR_H_
+#endif // DALI_INTERNAL_PERFORMANCE_MONITOR_H
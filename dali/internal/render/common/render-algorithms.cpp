@@ -18,11 +18,18 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-algorithms.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/integration-api/trace.h>
+#include <dali/internal/common/matrix-utils.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-instruction.h>
 #include <dali/internal/render/common/render-list.h>
+#include <dali/internal/render/common/render-target-graphics-objects.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/public-api/common/dali-utility.h>
@@ -404,6 +411,66 @@ inline void SetupDepthBuffer(const RenderItem& item, Graphics::CommandBuffer& co
   }
 }
 
+/**
+ * @brief Checks whether an item is outside the root clipping rect, so it should not be rendered.
+ * @param[in] item              The render item
+ * @param[in] rootClippingRect  The root clipping rect, or an empty rect if there is none
+ * @param[in] viewportRectangle The viewport
+ * @param[in] instruction       The render-instruction to process
+ * @return True if the item must be skipped
+ */
+inline bool IsOutsideRootClippingRect(const RenderItem& item, const BoundsInteger& rootClippingRect, const ClippingBox& viewportRectangle, const RenderInstruction& instruction)
+{
+  if(rootClippingRect.IsEmpty())
+  {
+    return false;
+  }
+
+  const SceneGraph::PartialRenderingData::NodeInfomations& nodeInfo = item.GetPartialRenderingDataNodeInfomations();
+
+  Vector4 updateArea = item.mRenderer ? item.mRenderer->GetVisualTransformedUpdateArea(nodeInfo.updatedPositionSize) : nodeInfo.updatedPositionSize;
+  auto    rect       = RenderItem::CalculateViewportSpaceAABB(item.mModelViewMatrix, Vector3(updateArea.x, updateArea.y, 0.0f), Vector3(updateArea.z, updateArea.w, 0.0f), viewportRectangle.width, viewportRectangle.height, instruction.mRenderedScaleFactor);
+
+  return !rect.Intersect(rootClippingRect);
+}
+
+/**
+ * @brief Checks whether the node of an item has its own uniforms, which differ from one instance to another.
+ */
+inline bool HasNodeUniforms(const RenderItem& item)
+{
+  const SceneGraph::NodeDataProvider& nodeDataProvider = *item.mNode;
+  return nodeDataProvider.GetNodeUniformMap().Count() > 0u;
+}
+
+/**
+ * @brief Checks whether an item may start an instance run, i.e. may have following items drawn as its instances.
+ */
+inline bool CanStartInstanceRun(const RenderItem& item)
+{
+  return item.mNode->GetClippingMode() == Dali::ClippingMode::DISABLED &&
+         !HasNodeUniforms(item) &&
+         !item.mRenderer->IsDrawCommandsExist() &&
+         !item.mRenderer->GetRenderCallback();
+}
+
+/**
+ * @brief Checks whether an item can be drawn as an instance of the first item of a run.
+ * Both must use the same renderer and blend the same way, so they share the same pipeline, textures and uniforms.
+ * The item must not change the clipping set up by the first item either.
+ */
+inline bool IsInstanceCompatible(const RenderItem& first, const RenderItem& item)
+{
+  return item.mRenderer == first.mRenderer &&
+         item.mIsOpaque == first.mIsOpaque &&
+         item.mNode->GetClippingMode() == Dali::ClippingMode::DISABLED &&
+         item.mNode->GetScissorDepth() == first.mNode->GetScissorDepth() &&
+         item.mNode->GetClippingId() == first.mNode->GetClippingId() &&
+         item.mNode->GetClippingDepth() == first.mNode->GetClippingDepth() &&
+         !HasNodeUniforms(item) &&
+         item.mNode->GetCacheRendererCount() == first.mNode->GetCacheRendererCount();
+}
+
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_RENDER_PROCESS, false);
 
 DALI_INIT_TIME_CHECKER_FILTER_WITH_DEFAULT_THRESHOLD(gTimeCheckerFilter, DALI_RENDER_PROCESS_THRESHOLD_TIME, 48);
@@ -667,6 +734,10 @@ inline void RenderAlgorithms::ProcessRenderList(const RenderList&
     Matrix::Multiply(clippedProjectionMatrix, projectionMatrix, mGraphicsController.GetClipMatrix(renderTargetGraphicsObjects.GetGraphicsRenderTarget()));
   }
 
+  // Merge the items using auto instancing shaders into instanced draws.
+  const Graphics::Buffer* instanceBuffer = PrepareInstanceRuns(renderList, clippedProjectionMatrix, instruction, rootClippingRect);
+  auto                    instanceRun    = mInstanceRuns.cbegin();
+
   // Loop through all RenderItems in the RenderList, set up any prerequisites to render them, then perform the render.
   for(uint32_t index = 0u; index < count; ++index)
   {
@@ -678,21 +749,22 @@ inline void RenderAlgorithms::ProcessRenderList(const RenderList&
     // Get NodeInformation as const l-value, to reduce memory access operations.
     const SceneGraph::PartialRenderingData::NodeInfomations& nodeInfo = item.GetPartialRenderingDataNodeInfomations();
 
-    // Discard renderers outside the root clipping rect
-    bool skip = true;
-    if(!rootClippingRect.IsEmpty())
+    // Draw the whole run with this item. The other items of the run need no clipping or depth setup.
+    InstanceBufferBinding  instanceBinding;
+    InstanceBufferBinding* instanceBindingPtr = nullptr;
+    if(instanceRun != mInstanceRuns.cend() && instanceRun->begin == index)
     {
-      Vector4 updateArea = item.mRenderer ? item.mRenderer->GetVisualTransformedUpdateArea(nodeInfo.updatedPositionSize) : nodeInfo.updatedPositionSize;
-      auto    rect       = RenderItem::CalculateViewportSpaceAABB(item.mModelViewMatrix, Vector3(updateArea.x, updateArea.y, 0.0f), Vector3(updateArea.z, updateArea.w, 0.0f), mViewportRectangle.width, mViewportRectangle.height, instruction.mRenderedScaleFactor);
-
-      if(rect.Intersect(rootClippingRect))
-      {
-        skip = false;
-      }
+      instanceBinding    = InstanceBufferBinding{instanceBuffer, instanceRun->offset, instanceRun->instanceCount};
+      instanceBindingPtr = &instanceBinding;
+      index              = instanceRun->end - 1u;
+      ++instanceRun;
     }
-    else
+
+    // Discard renderers hidden by the items drawn after them, or outside the root clipping rect
+    const bool skip = !instanceBindingPtr && (item.mIsOccluded || IsOutsideRootClippingRect(item, rootClippingRect, mViewportRectangle, instruction));
+    if(item.mIsOccluded && item.mRenderer)
     {
-      skip = false;
+      item.mRenderer->OnOccluded();
     }
 
     DALI_PRINT_RENDER_ITEM(item);
@@ -736,7 +808,7 @@ inline void RenderAlgorithms::ProcessRenderList(const RenderList&
         for(auto queue = 0u; queue < MAX_QUEUE; ++queue)
         {
           // Render the item. It will write into the command buffer everything it has to render
-          item.mRenderer->Render(commandBuffer, *item.mNode, nodeInfo.modelMatrix, item.mModelViewMatrix, viewMatrix, clippedProjectionMatrix, worldColor, nodeScale, nodeInfo.size, !item.mIsOpaque, instruction, renderTargetGraphicsObjects, queue);
+          item.mRenderer->Render(commandBuffer, *item.mNode, nodeInfo.modelMatrix, item.mModelViewMatrix, viewMatrix, clippedProjectionMatrix, worldColor, nodeScale, nodeInfo.size, !item.mIsOpaque, instruction, renderTargetGraphicsObjects, queue, instanceBindingPtr);
         }
       }
     }
@@ -746,12 +818,109 @@ inline void RenderAlgorithms::ProcessRenderList(const RenderList&
   Renderer::FinishedCommandBuffer();
 }
 
+const Graphics::Buffer* RenderAlgorithms::PrepareInstanceRuns(const RenderList&        renderList,
+                                                               const Matrix&            projectionMatrix,
+                                                               const RenderInstruction& instruction,
+                                                               const BoundsInteger&     rootClippingRect)
+{
+  mInstanceRuns.clear();
+  mInstanceData.clear();
+  mInstanceModelViewMatrices.clear();
+
+  const bool drawOffscreenRenderingCache = (instruction.mFrameBuffer != nullptr);
+
+  auto addInstance = [&](const RenderItem& item)
+  {
+    const SceneGraph::PartialRenderingData::NodeInfomations& nodeInfo = item.GetPartialRenderingDataNodeInfomations();
+
+    // Ignore an item's world color when rendering offscreen cache, as the non-instanced draw does.
+    const Vector4& worldColor = (drawOffscreenRenderingCache && item.mNode->GetCacheRendererCount() > 0u) ? Vector4::ONE : nodeInfo.worldColor;
+    const Vector4  color      = item.mRenderer->CalculateFinalColor(worldColor);
+
+    // The model view projection matrix is calculated with the others, after all the runs are found.
+    mInstanceModelViewMatrices.push_back(&item.mModelViewMatrix);
+
+    mInstanceData.emplace_back();
+    InstanceData& instance = mInstanceData.back();
+    std::copy(color.AsFloat(), color.AsFloat() + 4, instance.color);
+    std::copy(nodeInfo.size.AsFloat(), nodeInfo.size.AsFloat() + 3, instance.size);
+    instance.size[3] = 0.0f;
+  };
+
+  const uint32_t count = static_cast<uint32_t>(renderList.Count());
+  for(uint32_t index = 0u; index < count; ++index)
+  {
+    const RenderItem& first = renderList.GetItem(index);
+    if(!first.mRenderer || first.mIsOccluded || !first.mRenderer->IsAutoInstancingEnabled(instruction) || IsOutsideRootClippingRect(first, rootClippingRect, mViewportRectangle, instruction))
+    {
+      continue;
+    }
+
+    // Even a single item needs its instance data, as the shader only reads it from the instance attributes.
+    InstanceRun run{index, index + 1u, static_cast<uint32_t>(mInstanceData.size() * sizeof(InstanceData)), 1u};
+    addInstance(first);
+
+    if(CanStartInstanceRun(first))
+    {
+      for(; run.end < count; ++run.end)
+      {
+        const RenderItem& item = renderList.GetItem(run.end);
+        if(!IsInstanceCompatible(first, item))
+        {
+          break;
+        }
+
+        // Occluded or clipped out items are still part of the run, so they need no clipping setup either.
+        if(!item.mIsOccluded && !IsOutsideRootClippingRect(item, rootClippingRect, mViewportRectangle, instruction))
+        {
+          addInstance(item);
+          ++run.instanceCount;
+        }
+      }
+    }
+
+    mInstanceRuns.push_back(run);
+    index = run.end - 1u;
+  }
+
+  if(mInstanceRuns.empty())
+  {
+    return nullptr;
+  }
+
+  const uint32_t instanceCount = static_cast<uint32_t>(mInstanceData.size());
+  if(mInstanceMvpMatrices.size() < instanceCount)
+  {
+    mInstanceMvpMatrices.resize(instanceCount, Matrix(false));
+  }
+  MatrixUtils::MultiplyProjectionMatrices(mInstanceMvpMatrices.data(), mInstanceModelViewMatrices.data(), projectionMatrix, instanceCount);
+  for(uint32_t i = 0u; i < instanceCount; ++i)
+  {
+    std::copy(mInstanceMvpMatrices[i].AsFloat(), mInstanceMvpMatrices[i].AsFloat() + 16, mInstanceData[i].mvpMatrix);
+  }
+
+  if(mUsedInstanceBufferCount == mInstanceBuffers.size())
+  {
+    mInstanceBuffers.emplace_back(new GpuBuffer(mGraphicsController, 0 | Graphics::BufferUsage::VERTEX_BUFFER, GpuBuffer::WritePolicy::DISCARD));
+  }
+
+  // Each render list of the frame writes its own buffer, as the command buffers are only executed when submitted.
+  GpuBuffer& buffer = *mInstanceBuffers[mUsedInstanceBufferCount++];
+  buffer.UpdateDataBuffer(mGraphicsController, static_cast<uint32_t>(mInstanceData.size() * sizeof(InstanceData)), mInstanceData.data());
+  return buffer.GetGraphicsObject();
+}
+
 RenderAlgorithms::RenderAlgorithms(Graphics::Controller& graphicsController)
 : mGraphicsController(graphicsController),
   mViewportRectangle()
 {
 }
 
+void RenderAlgorithms::ResetInstanceBuffers()
+{
+  mUsedInstanceBufferCount = 0u;
+}
+
 void RenderAlgorithms::ProcessRenderInstruction(const RenderInstruction&                 instruction,
                                                 Graphics::CommandBuffer&                 commandBuffer,
                                                 bool                                     depthBufferAvailable,
@@ -769,6 +938,7 @@ void RenderAlgorithms::ProcessRenderInstruction(const RenderInstruction&
   DALI_PRINT_RENDER_INSTRUCTION(instruction);
 
   DALI_TIME_CHECKER_SCOPE(gTimeCheckerFilter, "DALI_RENDER_INSTRUCTION_PROCESS");
+  PERF_MONITOR_START(PerformanceMonitor::DRAW_NODES);
 
   const Matrix* viewMatrix       = instruction.GetViewMatrix();
   const Matrix* projectionMatrix = instruction.GetProjectionMatrix();
@@ -804,9 +974,131 @@ void RenderAlgorithms::ProcessRenderInstruction(const RenderInstruction&
       }
     }
   }
+  PERF_MONITOR_END(PerformanceMonitor::DRAW_NODES);
   DALI_TRACE_END(gTraceFilter, "DALI_RENDER_INSTRUCTION_PROCESS");
 }
 
+void RenderAlgorithms::RecordRenderLists(std::vector<RenderListRecording>& recordings)
+{
+  DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_RENDER_LISTS_RECORD", [&](std::ostringstream& oss)
+  { oss << "[" << recordings.size() << "]"; });
+
+  // The lists sharing renderers (or instance buffers) with others keep the order of the serial path.
+  mIndependentRecordings.clear();
+  for(auto&& recording : recordings)
+  {
+    if(recording.independent)
+    {
+      mIndependentRecordings.push_back(&recording);
+    }
+    else
+    {
+      RecordRenderList(recording);
+    }
+  }
+
+  const uint32_t recordingCount = static_cast<uint32_t>(mIndependentRecordings.size());
+  const uint32_t workerCount    = static_cast<uint32_t>(mWorkerAlgorithms.size());
+  if(recordingCount <= 1u || workerCount == 0u)
+  {
+    for(auto* recording : mIndependentRecordings)
+    {
+      RecordRenderList(*recording);
+    }
+  }
+  else
+  {
+    // Interleave the lists between the threads, as consecutive lists tend to have a similar cost.
+    const uint32_t threadCount = std::min(workerCount + 1u, recordingCount);
+    auto           recordLists = [this, threadCount, recordingCount](RenderAlgorithms& renderAlgorithms, uint32_t first)
+    {
+      for(uint32_t index = first; index < recordingCount; index += threadCount)
+      {
+        renderAlgorithms.RecordRenderList(*mIndependentRecordings[index]);
+      }
+    };
+
+    Renderer::SetRecordingInParallel(true);
+
+    std::vector<SharedFuture> futures;
+    futures.reserve(threadCount - 1u);
+    for(uint32_t thread = 1u; thread < threadCount; ++thread)
+    {
+      RenderAlgorithms& renderAlgorithms = *mWorkerAlgorithms[thread - 1u];
+      futures.push_back(mThreadPool->SubmitTask(thread - 1u, [&recordLists, &renderAlgorithms, thread](uint32_t)
+                                                { recordLists(renderAlgorithms, thread); }));
+    }
+
+    recordLists(*this, 0u);
+
+    for(auto& future : futures)
+    {
+      future->Wait();
+    }
+
+    Renderer::SetRecordingInParallel(false);
+  }
+  mIndependentRecordings.clear();
+
+  DALI_TRACE_END(gTraceFilter, "DALI_RENDER_LISTS_RECORD");
+}
+
+void RenderAlgorithms::SetThreadPool(Dali::ThreadPool* threadPool)
+{
+  mThreadPool = threadPool;
+
+  const std::size_t workerCount = mThreadPool ? mThreadPool->GetWorkerCount() : 0u;
+  mWorkerAlgorithms.resize(workerCount);
+  for(auto&& renderAlgorithms : mWorkerAlgorithms)
+  {
+    if(!renderAlgorithms)
+    {
+      renderAlgorithms = std::make_unique<RenderAlgorithms>(mGraphicsController);
+    }
+  }
+}
+
+void RenderAlgorithms::RecordRenderList(RenderListRecording& recording)
+{
+  const RenderInstruction& instruction      = *recording.instruction;
+  const Matrix*            viewMatrix       = instruction.GetViewMatrix();
+  const Matrix*            projectionMatrix = instruction.GetProjectionMatrix();
+
+  Graphics::CommandBuffer& commandBuffer = *recording.commandBuffer;
+  commandBuffer.Begin(Graphics::CommandBufferBeginInfo()
+                        .SetUsage(0 | Graphics::CommandBufferUsageFlagBits::ONE_TIME_SUBMIT | Graphics::CommandBufferUsageFlagBits::RENDER_PASS_CONTINUE)
+                        .SetRenderPass(*recording.renderPass)
+                        .SetRenderTarget(*recording.renderTargetGraphicsObjects->GetGraphicsRenderTarget()));
+
+  if(viewMatrix && projectionMatrix)
+  {
+    // The uniform buffer memory of an independent list is reserved up front, so that its offsets do not
+    // depend on the order the threads record in, and the retained uniforms stay valid across frames.
+    if(recording.independent)
+    {
+      UniformBufferManager::SetThreadReservedRange(&recording.uniformBufferRange);
+    }
+
+    ProcessRenderList(*recording.renderList,
+                      commandBuffer,
+                      *viewMatrix,
+                      *projectionMatrix,
+                      recording.depthBufferAvailable,
+                      recording.stencilBufferAvailable,
+                      instruction,
+                      recording.viewport,
+                      recording.rootClippingRect,
+                      recording.orientation,
+                      recording.sceneSize,
+                      *recording.renderPass,
+                      *recording.renderTargetGraphicsObjects);
+
+    UniformBufferManager::SetThreadReservedRange(nullptr);
+  }
+
+  commandBuffer.End();
+}
+
 } // namespace Render
 
 } // namespace Internal
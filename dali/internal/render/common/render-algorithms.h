@@ -18,13 +18,22 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <memory>
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/integration-api/core-enumerations.h>
 #include <dali/internal/render/common/render-list.h>
+#include <dali/internal/render/renderers/gpu-buffer.h>
+#include <dali/internal/render/renderers/render-instance-data.h>
+#include <dali/internal/render/renderers/uniform-buffer-manager.h>
 #include <dali/public-api/math/rect.h>
 
 namespace Dali
 {
+class ThreadPool;
+
 namespace Internal
 {
 namespace SceneGraph
@@ -46,6 +55,26 @@ public:
    */
   using ClippingBox = Dali::BoundsInteger;
 
+  /**
+   * @brief A render list to be recorded into its own secondary command buffer by RecordRenderLists().
+   */
+  struct RenderListRecording
+  {
+    const SceneGraph::RenderInstruction*     instruction{nullptr};
+    const SceneGraph::RenderList*            renderList{nullptr};
+    Graphics::CommandBuffer*                 commandBuffer{nullptr}; ///< The secondary command buffer to record into
+    Graphics::RenderPass*                    renderPass{nullptr};
+    SceneGraph::RenderTargetGraphicsObjects* renderTargetGraphicsObjects{nullptr};
+    BoundsInteger                            viewport;
+    BoundsInteger                            rootClippingRect;
+    Uint16Pair                               sceneSize;
+    int                                      orientation{0};
+    bool                                     depthBufferAvailable{false};
+    bool                                     stencilBufferAvailable{false};
+    bool                                     independent{false}; ///< Whether the list shares no renderer with the others and may be recorded by any thread
+    UniformBufferManager::ReservedRange      uniformBufferRange;  ///< The uniform buffer memory of an independent list
+  };
+
 public:
   /**
    * Constructor.
@@ -82,7 +111,61 @@ public:
                                 Graphics::RenderPass&                    renderPass,
                                 SceneGraph::RenderTargetGraphicsObjects& renderTargetGraphicsObjects);
 
+  /**
+   * @brief Records render lists into their secondary command buffers.
+   * The lists which are not independent are recorded first, in order, by the calling thread. The independent lists
+   * are then shared between the calling thread and the workers of the thread pool.
+   * @param[in] recordings The render lists to record
+   */
+  void RecordRenderLists(std::vector<RenderListRecording>& recordings);
+
+  /**
+   * @brief Sets the thread pool used to record the independent render lists concurrently.
+   * @param[in] threadPool The thread pool, or nullptr to record on the calling thread only.
+   */
+  void SetThreadPool(Dali::ThreadPool* threadPool);
+
+  /**
+   * @brief Checks whether render lists are recorded by several threads.
+   * @return True if a thread pool with workers is set
+   */
+  bool IsRecordingInParallelEnabled() const
+  {
+    return !mWorkerAlgorithms.empty();
+  }
+
+  /**
+   * @brief Makes the instance buffers of the previous frame available again.
+   * @note Called at the start of every frame, before any render instruction is processed.
+   */
+  void ResetInstanceBuffers();
+
 private:
+  /**
+   * @brief A run of consecutive render items drawn by a single instanced draw.
+   */
+  struct InstanceRun
+  {
+    uint32_t begin;         ///< Index of the first item, which is rendered
+    uint32_t end;           ///< Index after the last item of the run
+    uint32_t offset;        ///< Offset of the first instance in the instance buffer, in bytes
+    uint32_t instanceCount; ///< Number of items of the run which are not clipped out
+  };
+
+  /**
+   * @brief Merges the items of the render list using auto instancing shaders into instance runs, and uploads their instance data.
+   * Consecutive items are merged if they share the same renderer and if their clipping and depth setup is the same.
+   * @param[in] renderList       The render-list to process
+   * @param[in] projectionMatrix The projection matrix, including the clip matrix
+   * @param[in] instruction      The render-instruction to process
+   * @param[in] rootClippingRect The root clipping rectangle
+   * @return The buffer containing the instance data of all the runs, or nullptr if there is no run
+   */
+  const Graphics::Buffer* PrepareInstanceRuns(const Dali::Internal::SceneGraph::RenderList&        renderList,
+                                              const Matrix&                                        projectionMatrix,
+                                              const Dali::Internal::SceneGraph::RenderInstruction& instruction,
+                                              const BoundsInteger&                                 rootClippingRect);
+
   /**
    * @brief Perform any scissor clipping related operations based on the current RenderItem.
    * This includes:
@@ -149,6 +232,12 @@ private:
                                 Graphics::RenderPass&                                renderPass,
                                 SceneGraph::RenderTargetGraphicsObjects&             renderTargetGraphicsObjects);
 
+  /**
+   * @brief Records a render list into its secondary command buffer.
+   * @param[in] recording The render list to record
+   */
+  void RecordRenderList(RenderListRecording& recording);
+
   // Member variables:
 
   using ScissorStackType = std::vector<ClippingBox>; ///< The container type used to maintain the applied scissor hierarchy
@@ -157,6 +246,17 @@ private:
 
   ScissorStackType mScissorStack;      ///< Contains the currently applied scissor hierarchy (so we can undo clips)
   ClippingBox      mViewportRectangle; ///< The viewport dimensions, used to translate AABBs to scissor coordinates
+
+  std::vector<InstanceRun>                mInstanceRuns;              ///< The instance runs of the render list being processed
+  std::vector<InstanceData>               mInstanceData;              ///< The instance data of the render list being processed
+  std::vector<const Matrix*>              mInstanceModelViewMatrices; ///< The model view matrix of each instance, multiplied by the projection in one batch
+  std::vector<Matrix>                     mInstanceMvpMatrices;       ///< The model view projection matrix of each instance
+  std::vector<std::unique_ptr<GpuBuffer>> mInstanceBuffers;           ///< One buffer per render list using auto instancing in a frame
+  uint32_t                                mUsedInstanceBufferCount{0u}; ///< Number of instance buffers written this frame
+
+  std::vector<std::unique_ptr<RenderAlgorithms>> mWorkerAlgorithms;      ///< The RenderAlgorithms of each worker thread
+  std::vector<RenderListRecording*>              mIndependentRecordings; ///< The independent render lists being recorded
+  Dali::ThreadPool*                              mThreadPool{nullptr};   ///< Thread pool for recording render lists concurrently (not owned)
 };
 
 } // namespace Render
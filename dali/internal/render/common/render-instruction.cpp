@@ -51,6 +51,7 @@ void RenderInstruction::ContextDestroyed()
 {
   // Destroy allocated render list now.
   mRenderLists.Clear();
+  mSecondaryCommandBuffers.clear();
 }
 
 RenderList& RenderInstruction::GetNextFreeRenderList(size_t capacityRequired)
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/renderers/render-frame-buffer.h>
@@ -145,6 +148,25 @@ public:
     return mCommandBuffer.get();
   }
 
+  /**
+   * Get the secondary command buffer a render list is recorded into, when the render lists are recorded concurrently.
+   * @param[in] graphicsController The graphics controller
+   * @param[in] index The index of the render list
+   * @return The secondary command buffer of the render list
+   */
+  [[nodiscard]] Graphics::CommandBuffer* GetSecondaryCommandBuffer(Graphics::Controller& graphicsController, RenderListContainer::SizeType index)
+  {
+    if(mSecondaryCommandBuffers.size() <= index)
+    {
+      mSecondaryCommandBuffers.resize(index + 1u);
+    }
+    if(!mSecondaryCommandBuffers[index])
+    {
+      mSecondaryCommandBuffers[index] = graphicsController.CreateCommandBuffer(Graphics::CommandBufferCreateInfo().SetLevel(Graphics::CommandBufferLevel::SECONDARY), nullptr);
+    }
+    return mSecondaryCommandBuffers[index].get();
+  }
+
   /**
    * Get the total memory usage of the render instruction
    */
@@ -164,7 +186,8 @@ public:
   uint32_t             mRenderPassTag{0u};
 
 private:
-  Graphics::UniquePtr<Graphics::CommandBuffer> mCommandBuffer{nullptr}; ///< Output of render lists
+  Graphics::UniquePtr<Graphics::CommandBuffer>              mCommandBuffer{nullptr}; ///< Output of render lists
+  std::vector<Graphics::UniquePtr<Graphics::CommandBuffer>> mSecondaryCommandBuffers; ///< Output of each render list, when recorded concurrently
 
   Camera*                       mCamera;             ///< camera that is used
   RenderListContainer           mRenderLists;        ///< container of all render lists
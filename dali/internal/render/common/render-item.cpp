@@ -40,7 +40,8 @@ namespace SceneGraph
 RenderItemKey RenderItem::NewKey()
 {
   DALI_ASSERT_DEBUG(gMemoryPoolCollection && "RenderItem::RegisterMemoryPoolCollection not called!");
-  void* ptr = gMemoryPoolCollection->AllocateRaw(gMemoryPoolType);
+  // Render items may be created by several threads when the scenes are processed concurrently.
+  void* ptr = gMemoryPoolCollection->AllocateRawThreadSafe(gMemoryPoolType);
   auto  key = gMemoryPoolCollection->GetKeyFromPtr(gMemoryPoolType, ptr);
   new(ptr) RenderItem();
   return RenderItemKey(key);
@@ -61,9 +62,14 @@ RenderItem::RenderItem()
   mRenderer{},
   mNode(nullptr),
   mTextureSet(nullptr),
+  mVisibleArea(),
+  mOccludingArea(),
   mDepthIndex(0),
   mIsOpaque(true),
-  mIsUpdated(false)
+  mIsUpdated(false),
+  mIsOccluder(false),
+  mIsOccludable(false),
+  mIsOccluded(false)
 {
 }
 
@@ -73,7 +79,7 @@ void RenderItem::operator delete(void* ptr)
 {
   if(DALI_LIKELY(gMemoryPoolCollection))
   {
-    gMemoryPoolCollection->Free(gMemoryPoolType, ptr);
+    gMemoryPoolCollection->FreeThreadSafe(gMemoryPoolType, ptr);
   }
 }
 
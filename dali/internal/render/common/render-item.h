@@ -143,11 +143,16 @@ struct RenderItem
   Matrix              mModelViewMatrix;
   Render::RendererKey mRenderer;
   const Node*         mNode;
-  const void*         mTextureSet; ///< Used for sorting only
+  const void*         mTextureSet;    ///< Used for sorting only
+  Vector4             mVisibleArea;   ///< The area the item may draw to in node space (center x, center y, width, height). Only valid if mIsOccludable
+  Vector4             mOccludingArea; ///< The area hidden by the item in node space (center x, center y, width, height). Only valid if mIsOccluder
   int                 mDepthIndex;
 
   bool mIsOpaque : 1;
   bool mIsUpdated : 1;
+  bool mIsOccluder : 1;   ///< True if the item covers mOccludingArea with opaque pixels
+  bool mIsOccludable : 1; ///< True if the item may be skipped when the items drawn after it hide it
+  bool mIsOccluded : 1;   ///< True if the items drawn after this one hide it, so it is not rendered
 
 private:
   /**
@@ -20,9 +20,11 @@
 
 // EXTERNAL INCLUDES
 #include <memory>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/vector-wrapper.h>
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/ordered-set.h>
 #include <dali/integration-api/scene-pre-render-status.h>
@@ -34,8 +36,11 @@
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/internal/update/render-tasks/scene-graph-camera.h>
 
+#include <dali/internal/common/environment-variable.h>
 #include <dali/internal/common/owner-key-container.h>
 
+#include <dali/internal/render/common/damaged-rects-coalescer.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-algorithms.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-instruction.h>
@@ -43,6 +48,7 @@
 #include <dali/internal/render/common/render-tracker.h>
 #include <dali/internal/render/common/shared-uniform-buffer-view-container.h>
 #include <dali/internal/render/common/terminated-native-draw-manager.h>
+#include <dali/internal/render/common/texture-upload-scheduler.h>
 #include <dali/internal/render/renderers/pipeline-cache.h>
 #include <dali/internal/render/renderers/render-frame-buffer.h>
 #include <dali/internal/render/renderers/render-texture.h>
@@ -78,6 +84,30 @@ constexpr uint32_t PROGRAM_CACHE_FORCE_CLEAN_FRAME_COUNT = PROGRAM_CACHE_CLEAN_F
 static_assert(PROGRAM_CACHE_CLEAN_FRAME_COUNT <= PROGRAM_CACHE_FORCE_CLEAN_FRAME_COUNT);
 static_assert(MAXIMUM_PROGRAM_CACHE_CLEAN_THRESHOLD <= PROGRAM_CACHE_FORCE_CLEAN_FRAME_COUNT);
 
+constexpr uint32_t PREWARMED_PROGRAMS_PER_FRAME = 4u; ///< Programs of the persistent cache created per frame, to spread the compilation cost.
+
+constexpr const char* RENDER_WORKER_THREAD_COUNT_ENV = "DALI_RENDER_WORKER_THREAD_COUNT"; ///< Number of worker threads recording the render lists. 0 or unset disables it.
+
+/**
+ * @brief Reads the number of render worker threads from the environment.
+ * @return The number of worker threads, or 0 if the render lists are recorded by the render thread only.
+ */
+uint32_t GetRenderWorkerThreadCount()
+{
+  return EnvironmentVariable::GetUnsignedIntegerValue(RENDER_WORKER_THREAD_COUNT_ENV, 0u);
+}
+
+constexpr const char* TEXTURE_UPLOAD_BYTES_PER_FRAME_ENV = "DALI_TEXTURE_UPLOAD_BYTES_PER_FRAME"; ///< Number of bytes of texture data uploaded per frame. 0 or unset uploads them as soon as requested.
+
+/**
+ * @brief Reads the texture upload budget from the environment.
+ * @return The number of bytes uploaded per frame, or 0 if the uploads are not scheduled.
+ */
+uint32_t GetTextureUploadBytesPerFrame()
+{
+  return EnvironmentVariable::GetUnsignedIntegerValue(TEXTURE_UPLOAD_BYTES_PER_FRAME_ENV, 0u);
+}
+
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
 constexpr uint32_t SHRINK_TO_FIT_FRAME_COUNT = (1u << 8); ///< 256 frames. Make this value as power of 2.
 
@@ -161,6 +191,27 @@ inline void AlignDamagedRect(BoundsInteger& rect)
   rect.height = ((bottom + 17) / 16) * 16 - rect.y;
 }
 
+/**
+ * The uniform buffer memory needed by a render list, and whether any thread can record it.
+ */
+struct RenderListUsage
+{
+  uint32_t cpuSize{0u};
+  uint32_t gpuSize{0u};
+  bool     independent{true};
+};
+
+/**
+ * A render pass whose render lists are recorded into secondary command buffers.
+ */
+struct PendingRenderPass
+{
+  RenderInstruction*       instruction;
+  Graphics::CommandBuffer* commandBuffer;
+  uint32_t                 firstRecording;
+  uint32_t                 recordingCount;
+};
+
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_RENDER_PROCESS, false);
 
 DALI_INIT_TIME_CHECKER_FILTER_WITH_DEFAULT_THRESHOLD(gTimeCheckerFilter, DALI_RENDER_PROCESS_THRESHOLD_TIME, 48);
@@ -183,10 +234,35 @@ struct RenderManager::Impl
   {
     uniformBufferManager = std::make_unique<Render::UniformBufferManager>(&graphicsController);
     pipelineCache        = std::make_unique<Render::PipelineCache>(graphicsController);
+
+    const uint32_t workerThreadCount = GetRenderWorkerThreadCount();
+    if(workerThreadCount > 0u)
+    {
+      threadPool = std::make_unique<Dali::ThreadPool>();
+      if(threadPool->Initialize(workerThreadCount))
+      {
+        renderAlgorithms.SetThreadPool(threadPool.get());
+      }
+      else
+      {
+        threadPool.reset();
+      }
+    }
+
+    const uint32_t textureUploadBytesPerFrame = GetTextureUploadBytesPerFrame();
+    if(textureUploadBytesPerFrame > 0u)
+    {
+      textureUploadScheduler = std::make_unique<Render::TextureUploadScheduler>(graphicsController, textureUploadBytesPerFrame);
+    }
   }
 
   ~Impl()
   {
+    renderAlgorithms.SetThreadPool(nullptr);
+    threadPool.reset();
+
+    persistentProgramCache.Save();
+
     geometryContainer.Clear(); // clear now before the pipeline cache is deleted
     rendererContainer.Clear(); // clear now before the program contoller and the pipeline cache are deleted
     pipelineCache.reset();     // clear now before the program contoller is deleted
@@ -212,6 +288,54 @@ struct RenderManager::Impl
     programCacheCleanRequestedFrame = 0u;
   }
 
+  /**
+   * @brief Uploads a part of the queued texture data, the textures used by the current render instructions first.
+   * @param[out] status The render status, to request another frame while uploads are pending
+   */
+  void UploadPendingTextures(Integration::RenderStatus& status)
+  {
+    visibleTextures.clear();
+    for(auto* scene : sceneContainer)
+    {
+      const uint32_t instructionCount = scene->GetRenderInstructions().Count();
+      for(uint32_t i = 0u; i < instructionCount; ++i)
+      {
+        const RenderInstruction& instruction = scene->GetRenderInstructions().At(i);
+        for(uint32_t listIndex = 0u; listIndex < instruction.RenderListCount(); ++listIndex)
+        {
+          const RenderList* renderList = instruction.GetRenderList(listIndex);
+          for(uint32_t itemIndex = 0u; renderList && itemIndex < renderList->Count(); ++itemIndex)
+          {
+            const Render::RendererKey renderer = renderList->GetRenderer(itemIndex);
+            const auto*               textures = renderer ? renderer->GetTextures() : nullptr;
+            if(textures)
+            {
+              for(auto&& texture : *textures)
+              {
+                visibleTextures.insert(texture.Get());
+              }
+            }
+          }
+        }
+      }
+    }
+
+    DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_TEXTURE_UPLOAD", [&](std::ostringstream& oss) {
+      oss << "[pending:" << textureUploadScheduler->GetPendingCount() << "]";
+    });
+
+    [[maybe_unused]] const uint32_t doneCount = textureUploadScheduler->UploadPendingData(visibleTextures);
+
+    DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_TEXTURE_UPLOAD", [&](std::ostringstream& oss) {
+      oss << "[done:" << doneCount << ", pending:" << textureUploadScheduler->GetPendingCount() << "]";
+    });
+
+    if(textureUploadScheduler->GetPendingCount() > 0u)
+    {
+      status.SetNeedsUpdate(true);
+    }
+  }
+
   void UpdateTrackers()
   {
     for(auto&& iter : mRenderTrackers)
@@ -304,6 +428,11 @@ struct RenderManager::Impl
     updatedTextures.Clear();
     textureDiscardQueue.Clear();
 
+    if(textureUploadScheduler)
+    {
+      textureUploadScheduler->Clear();
+    }
+
     pipelineCache.reset(); // clear now before the program contoller is deleted
 
     if(DALI_LIKELY(uniformBufferManager))
@@ -318,6 +447,9 @@ struct RenderManager::Impl
   std::vector<SceneGraph::Scene*> sceneContainer;   ///< List of pointers to the scene graph objects of the scenes
   Render::RenderAlgorithms        renderAlgorithms; ///< The RenderAlgorithms object is used to action the renders required by a RenderInstruction
 
+  std::unique_ptr<Dali::ThreadPool>                          threadPool;           ///< Thread pool recording the render lists concurrently, if enabled
+  std::vector<Render::RenderAlgorithms::RenderListRecording> renderListRecordings; ///< The render lists recorded concurrently in the current scene
+
   std::vector<Render::FrameBuffer*>             renderedFrameBufferContainer; ///< List of rendered frame buffer
   Integration::OrderedSet<Render::Sampler>      samplerContainer;             ///< List of owned samplers
   Integration::OrderedSet<Render::FrameBuffer>  frameBufferContainer;         ///< List of owned framebuffers
@@ -330,7 +462,8 @@ struct RenderManager::Impl
 
   OwnerKeyContainer<Render::Texture> textureDiscardQueue; ///< Discarded textures
 
-  ProgramController programController; ///< Owner of the programs
+  PersistentProgramCache persistentProgramCache; ///< Programs created during previous runs
+  ProgramController      programController;      ///< Owner of the programs
 
   std::unique_ptr<Render::UniformBufferManager> uniformBufferManager; ///< The uniform buffer manager
   std::unique_ptr<Render::PipelineCache>        pipelineCache;
@@ -338,6 +471,9 @@ struct RenderManager::Impl
   SharedUniformBufferViewContainer    sharedUniformBufferViewContainer; ///< Shared Uniform Buffer Views
   Render::TerminatedNativeDrawManager terminatedNativeDrawManager;
 
+  std::unique_ptr<Render::TextureUploadScheduler> textureUploadScheduler; ///< Spreads the texture uploads over several frames, if enabled
+  Render::TextureUploadScheduler::VisibleTextures visibleTextures;        ///< The textures used by the current render instructions
+
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
   ContainerRemovedFlags containerRemovedFlags; ///< cumulative container removed flags during current frame
 #endif
@@ -487,6 +623,11 @@ void RenderManager::RemoveTexture(const Render::TextureKey& textureKey)
     // Destroy texture.
     textureKey->Destroy();
 
+    if(mImpl->textureUploadScheduler)
+    {
+      mImpl->textureUploadScheduler->RemoveTexture(*textureKey.Get());
+    }
+
     // Transfer ownership to the discard queue, this keeps the object alive, until the render-thread has finished with it
     mImpl->textureDiscardQueue.PushBack(mImpl->textureContainer.Release(iter));
 
@@ -504,6 +645,11 @@ void RenderManager::SetTextureUpdated(const Render::TextureKey& textureKey)
   mImpl->updatedTextures.PushBack(textureKey);
 }
 
+Render::TextureUploadScheduler* RenderManager::GetTextureUploadScheduler() const
+{
+  return mImpl->textureUploadScheduler.get();
+}
+
 void RenderManager::AddFrameBuffer(OwnerPointer<Render::FrameBuffer>& frameBuffer)
 {
   Render::FrameBuffer* frameBufferPtr = frameBuffer.Release();
@@ -584,6 +730,17 @@ void RenderManager::ClearProgramCache()
   mImpl->clearCacheRequired = true;
 }
 
+void RenderManager::LoadProgramCache(const std::string& filePath)
+{
+  mImpl->programController.SetPersistentCache(&mImpl->persistentProgramCache);
+  mImpl->persistentProgramCache.Load(filePath);
+}
+
+const PersistentProgramCache::Statistics& RenderManager::GetProgramCacheStatistics() const
+{
+  return mImpl->persistentProgramCache.GetStatistics();
+}
+
 void RenderManager::PreRender(Integration::RenderStatus& status, bool forceClear)
 {
   DALI_PRINT_RENDER_START();
@@ -591,6 +748,7 @@ void RenderManager::PreRender(Integration::RenderStatus& status, bool forceClear
 
   // Increment the frame count at the beginning of each frame
   ++mImpl->frameCount;
+  status.SetUniformBufferBytes(0u, 0u);
 
   uint32_t totalInstructionCount = 0u;
   for(auto& i : mImpl->sceneContainer)
@@ -614,9 +772,23 @@ void RenderManager::PreRender(Integration::RenderStatus& status, bool forceClear
     }
   }
 
+  if(mImpl->textureUploadScheduler && mImpl->textureUploadScheduler->GetPendingCount() > 0u)
+  {
+    mImpl->UploadPendingTextures(status);
+  }
+
   // Reset pipeline cache before rendering
   mImpl->pipelineCache->PreRender();
 
+  // Instance buffers written during the previous frame can be written again
+  mImpl->renderAlgorithms.ResetInstanceBuffers();
+
+  // Create a few programs of the previous runs, before the renderers need them
+  if(DALI_LIKELY(mImpl->uniformBufferManager))
+  {
+    mImpl->programController.Prewarm(mImpl->graphicsController, *mImpl->uniformBufferManager, PREWARMED_PROGRAMS_PER_FRAME);
+  }
+
   // Check we need to clean up program cache
   mImpl->RequestProgramCacheCleanIfNeed();
 
@@ -660,6 +832,7 @@ void RenderManager::PreRenderScene(Integration::Scene& scene, Integration::Scene
   status.SetHadRenderInstructionToScene(sceneObject->HasRenderInstructionToScene());
   status.SetHasRenderInstructionToScene(renderToScene);
   status.SetSkipRendering(sceneObject->IsRenderingSkipped());
+  status.SetDamagedAreaRatio(1.0f);
 
   // Do not update render instruction infomation if rendering skipped!
   if(!sceneObject->IsRenderingSkipped())
@@ -827,8 +1000,9 @@ void RenderManager::PreRenderScene(Integration::Scene& scene, Integration::Scene
               BoundsInteger rect;
               DirtyRectKey  dirtyRectKey(item.mNode, item.mRenderer);
               // If the item refers to updated node or renderer.
+              // The changes of an occluded renderer are not visible, and it keeps them until it is rendered.
               if(item.mIsUpdated ||
-                 (item.mNode->Updated() || (item.mRenderer && item.mRenderer->Updated())))
+                 (item.mNode->Updated() || (item.mRenderer && !item.mIsOccluded && item.mRenderer->Updated())))
               {
                 item.mIsUpdated = false; /// DevNote : Reset flag here, since RenderItem could be reused by renderList.ReuseCachedItems().
 
@@ -919,6 +1093,11 @@ void RenderManager::PreRenderScene(Integration::Scene& scene, Integration::Scene
   if(!cleanDamagedRect)
   {
     damagedRectCleaner.SetCleanOnReturn(false);
+
+    if(status.GetMaximumDamagedRectCount() > 0u)
+    {
+      status.SetDamagedAreaRatio(Render::CoalesceDamagedRects(damagedRects, status.GetMaximumDamagedRectCount()));
+    }
   }
 }
 
@@ -971,6 +1150,19 @@ void RenderManager::RenderScene(Integration::RenderStatus& status, Integration::
   bool sceneNeedsDepthBuffer   = false;
   bool sceneNeedsStencilBuffer = false;
 
+  // When the render lists can be recorded concurrently, find out the memory each list needs, and
+  // the lists which share nothing with the others (the same renderer in two lists, a render callback
+  // or the instance buffers of the auto instancing must stay on this thread).
+  const bool                                            recordingInParallelEnabled = mImpl->renderAlgorithms.IsRecordingInParallelEnabled();
+  std::vector<RenderListUsage>                          renderListUsages;
+  std::vector<uint32_t>                                 firstRenderListUsages;
+  std::unordered_map<const Render::Renderer*, uint32_t> rendererRenderLists;
+  uint32_t                                              independentRenderListCount = 0u;
+  if(recordingInParallelEnabled)
+  {
+    firstRenderListUsages.resize(instructionCount, 0u);
+  }
+
   DALI_LOG_INFO(gLogFilter, Debug::General, "Instruction count: %d\n", instructionCount);
   for(uint32_t i = 0; i < instructionCount; ++i)
   {
@@ -982,16 +1174,45 @@ void RenderManager::RenderScene(Integration::RenderStatus& status, Integration::
       bool usesDepthBuffer   = false;
       bool usesStencilBuffer = false;
 
+      if(recordingInParallelEnabled)
+      {
+        firstRenderListUsages[i] = static_cast<uint32_t>(renderListUsages.size());
+      }
+
       for(auto j = 0u; j < instruction.RenderListCount(); ++j)
       {
         const auto& renderList = instruction.GetRenderList(j);
         bool        autoDepthTestMode(depthBufferAvailable &&
                                !(renderList->GetSourceLayer()->IsDepthTestDisabled()) &&
                                renderList->HasColorRenderItems());
+
+        RenderListUsage* renderListUsage = nullptr;
+        if(recordingInParallelEnabled)
+        {
+          renderListUsage = &renderListUsages.emplace_back();
+        }
+
         for(auto k = 0u; k < renderList->Count(); ++k)
         {
           auto& item        = renderList->GetItem(k);
           usesStencilBuffer = usesStencilBuffer || item.UsesStencilBuffer();
+
+          if(renderListUsage && item.mRenderer)
+          {
+            const uint32_t renderListIndex = static_cast<uint32_t>(renderListUsages.size() - 1u);
+            if(item.mRenderer->GetRenderCallback() || item.mRenderer->IsAutoInstancingEnabled(instruction))
+            {
+              renderListUsage->independent = false;
+            }
+
+            auto iter = rendererRenderLists.emplace(item.mRenderer.Get(), renderListIndex).first;
+            if(iter->second != renderListIndex)
+            {
+              renderListUsage->independent               = false;
+              renderListUsages[iter->second].independent = false;
+            }
+          }
+
           if(item.mRenderer && item.mRenderer->NeedsProgram())
           {
             usesDepthBuffer = usesDepthBuffer || item.UsesDepthBuffer(autoDepthTestMode);
@@ -1016,12 +1237,15 @@ void RenderManager::RenderScene(Integration::RenderStatus& status, Integration::
                 (*it).second.count++;
               }
 
+              const uint32_t gpuSizeRequired = memoryRequirements.totalGpuSizeRequired + (item.mRenderer->UseSharedUniformBlock() ? 0u : memoryRequirements.sharedGpuSizeRequired);
+
               totalSizeCPU += memoryRequirements.totalCpuSizeRequired;
-              totalSizeGPU += memoryRequirements.totalGpuSizeRequired;
+              totalSizeGPU += gpuSizeRequired;
 
-              if(!item.mRenderer->UseSharedUniformBlock())
+              if(renderListUsage)
               {
-                totalSizeGPU += memoryRequirements.sharedGpuSizeRequired;
+                renderListUsage->cpuSize += memoryRequirements.totalCpuSizeRequired;
+                renderListUsage->gpuSize += gpuSizeRequired;
               }
             }
           }
@@ -1040,6 +1264,12 @@ void RenderManager::RenderScene(Integration::RenderStatus& status, Integration::
     }
   }
 
+  for(const auto& renderListUsage : renderListUsages)
+  {
+    independentRenderListCount += renderListUsage.independent ? 1u : 0u;
+  }
+  const bool recordRenderListsInParallel = independentRenderListCount > 1u;
+
   if(!renderToFbo)
   {
     auto sceneRenderTarget = sceneObject->GetSurfaceRenderTarget();
@@ -1118,6 +1348,31 @@ void RenderManager::RenderScene(Integration::RenderStatus& status, Integration::
   }
 
   std::vector<Graphics::CommandBuffer*> commandBuffers;
+  std::vector<PendingRenderPass>        pendingRenderPasses;
+
+  auto& renderListRecordings = mImpl->renderListRecordings;
+  renderListRecordings.clear();
+
+  auto endRenderPass = [this](RenderInstruction& instruction, Graphics::CommandBuffer& commandBuffer)
+  {
+    Graphics::SyncObject* syncObject{nullptr};
+
+    // If the render instruction has an associated render tracker (owned separately)
+    // and framebuffer, create a one shot sync object, and use it to determine when
+    // the render pass has finished executing on GPU.
+    if(instruction.mRenderTracker && instruction.mFrameBuffer)
+    {
+      syncObject                 = instruction.mRenderTracker->CreateSyncObject(mImpl->graphicsController);
+      instruction.mRenderTracker = nullptr;
+    }
+    commandBuffer.EndRenderPass(syncObject);
+
+    if(instruction.mFrameBuffer && instruction.mFrameBuffer->IsKeepingRenderResultRequested())
+    {
+      commandBuffer.ReadPixels(instruction.mFrameBuffer->GetRenderResultBuffer());
+      mImpl->renderedFrameBufferContainer.push_back(instruction.mFrameBuffer);
+    }
+  };
 
   for(uint32_t i = 0; i < instructionCount; ++i)
   {
@@ -1277,41 +1532,93 @@ void RenderManager::RenderScene(Integration::RenderStatus& status, Integration::
                                             scissorArea,
                                             currentClearValues);
 
-      // Note, don't set the viewport/scissor on primary command buffer.
-      mImpl->renderAlgorithms.ProcessRenderInstruction(instruction,
-                                                       *currentCommandBuffer,
-                                                       depthBufferAvailable,
-                                                       stencilBufferAvailable,
-                                                       viewportRect,
-                                                       clippingRect,
-                                                       surfaceOrientation,
-                                                       Uint16Pair(surfaceRect.width, surfaceRect.height),
-                                                       currentRenderPass,
-                                                       *currentRenderTargetGraphicsObjects);
-
-      Graphics::SyncObject* syncObject{nullptr};
-
-      // If the render instruction has an associated render tracker (owned separately)
-      // and framebuffer, create a one shot sync object, and use it to determine when
-      // the render pass has finished executing on GPU.
-      if(instruction.mRenderTracker && instruction.mFrameBuffer)
+      if(recordRenderListsInParallel)
       {
-        syncObject                 = instruction.mRenderTracker->CreateSyncObject(mImpl->graphicsController);
-        instruction.mRenderTracker = nullptr;
+        // Each render list is recorded into its own secondary command buffer once every pass is known,
+        // and the primary command buffer executes them in order.
+        PendingRenderPass pendingRenderPass{&instruction, currentCommandBuffer, static_cast<uint32_t>(renderListRecordings.size()), 0u};
+        for(auto j = 0u; j < instruction.RenderListCount(); ++j)
+        {
+          const RenderList* renderList = instruction.GetRenderList(j);
+          if(renderList && !renderList->IsEmpty())
+          {
+            const RenderListUsage& renderListUsage = renderListUsages[firstRenderListUsages[i] + j];
+
+            auto& recording                       = renderListRecordings.emplace_back();
+            recording.instruction                 = &instruction;
+            recording.renderList                  = renderList;
+            recording.commandBuffer               = instruction.GetSecondaryCommandBuffer(mImpl->graphicsController, j);
+            recording.renderPass                  = &currentRenderPass;
+            recording.renderTargetGraphicsObjects = currentRenderTargetGraphicsObjects;
+            recording.viewport                    = viewportRect;
+            recording.rootClippingRect            = clippingRect;
+            recording.sceneSize                   = Uint16Pair(surfaceRect.width, surfaceRect.height);
+            recording.orientation                 = surfaceOrientation;
+            recording.depthBufferAvailable        = depthBufferAvailable;
+            recording.stencilBufferAvailable      = stencilBufferAvailable;
+            recording.independent                 = renderListUsage.independent;
+            if(renderListUsage.independent)
+            {
+              recording.uniformBufferRange = uboManager->ReserveRange(renderListUsage.cpuSize, renderListUsage.gpuSize);
+            }
+            recording.commandBuffer->Reset();
+            ++pendingRenderPass.recordingCount;
+          }
+        }
+        pendingRenderPasses.push_back(pendingRenderPass);
+      }
+      else
+      {
+        // Note, don't set the viewport/scissor on primary command buffer.
+        mImpl->renderAlgorithms.ProcessRenderInstruction(instruction,
+                                                         *currentCommandBuffer,
+                                                         depthBufferAvailable,
+                                                         stencilBufferAvailable,
+                                                         viewportRect,
+                                                         clippingRect,
+                                                         surfaceOrientation,
+                                                         Uint16Pair(surfaceRect.width, surfaceRect.height),
+                                                         currentRenderPass,
+                                                         *currentRenderTargetGraphicsObjects);
+
+        endRenderPass(instruction, *currentCommandBuffer);
       }
-      currentCommandBuffer->EndRenderPass(syncObject);
+    }
+  }
+
+  if(!pendingRenderPasses.empty())
+  {
+    mImpl->renderAlgorithms.RecordRenderLists(renderListRecordings);
 
-      if(instruction.mFrameBuffer && instruction.mFrameBuffer->IsKeepingRenderResultRequested())
+    std::vector<const Graphics::CommandBuffer*> secondaryCommandBuffers;
+    for(const auto& pendingRenderPass : pendingRenderPasses)
+    {
+      secondaryCommandBuffers.clear();
+      for(uint32_t index = 0u; index < pendingRenderPass.recordingCount; ++index)
+      {
+        secondaryCommandBuffers.push_back(renderListRecordings[pendingRenderPass.firstRecording + index].commandBuffer);
+      }
+      if(!secondaryCommandBuffers.empty())
       {
-        currentCommandBuffer->ReadPixels(instruction.mFrameBuffer->GetRenderResultBuffer());
-        mImpl->renderedFrameBufferContainer.push_back(instruction.mFrameBuffer);
+        pendingRenderPass.commandBuffer->ExecuteCommandBuffers(std::move(secondaryCommandBuffers));
       }
+      endRenderPass(*pendingRenderPass.instruction, *pendingRenderPass.commandBuffer);
     }
+    renderListRecordings.clear();
   }
 
   // Flush UBOs
   mImpl->uniformBufferManager->Flush(sceneObject, renderToFbo);
 
+  // Count the uniforms written, and the ones used again from the previous frame
+  if(instructionCount)
+  {
+    const auto* cpuUniformBuffer = uboManager->GetUniformBufferForScene(sceneObject, renderToFbo, true);
+    const auto* gpuUniformBuffer = uboManager->GetUniformBufferForScene(sceneObject, renderToFbo, false);
+    status.SetUniformBufferBytes(status.GetUniformBufferBytesWritten() + cpuUniformBuffer->GetWrittenBytes() + gpuUniformBuffer->GetWrittenBytes(),
+                                 status.GetUniformBufferBytesRetained() + cpuUniformBuffer->GetRetainedBytes() + gpuUniformBuffer->GetRetainedBytes());
+  }
+
   // Submit command buffers
   Graphics::SubmitInfo submitInfo;
   submitInfo.flags = 0 | Graphics::SubmitFlagBits::FLUSH;
@@ -1457,6 +1764,9 @@ void RenderManager::PostRender()
   }
   mImpl->renderedFrameBufferContainer.clear();
 
+  // Render thread frame is complete; push its timers into the histograms.
+  PERF_MONITOR_FLUSH();
+
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
   // Shrink relevant containers if required.
   if(mImpl->containerRemovedFlags & ContainerRemovedFlagBits::RENDERER)
@@ -25,6 +25,7 @@
 #include <dali/internal/event/rendering/texture-impl.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/render/renderers/render-vertex-buffer.h>
+#include <dali/internal/render/shaders/persistent-program-cache.h>
 #include <dali/public-api/math/rect.h>
 
 #include <dali/graphics-api/graphics-texture-upload-helper.h> // for Graphics::UploadParams
@@ -51,6 +52,7 @@ class Sampler;
 class RenderTracker;
 class Geometry;
 class Texture;
+class TextureUploadScheduler;
 } // namespace Render
 
 namespace SceneGraph
@@ -170,6 +172,12 @@ public:
    */
   void SetTextureUpdated(const Render::TextureKey& textureKey);
 
+  /**
+   * Retrieves the scheduler spreading the texture uploads over several frames.
+   * @return The scheduler, or nullptr if the textures are uploaded as soon as requested
+   */
+  Render::TextureUploadScheduler* GetTextureUploadScheduler() const;
+
   /**
    * Adds a framebuffer to the render manager
    * @param[in] frameBuffer The framebuffer to add
@@ -220,6 +228,20 @@ public:
    */
   void ClearProgramCache();
 
+  /**
+   * Starts reading the file of the programs created during previous runs. They are created ahead of time,
+   * a few per frame, and the programs created on demand are written back to the file when the manager is destroyed.
+   * Multi-threading note: this method should be called before rendering starts.
+   * @param[in] filePath The path of the program cache file
+   */
+  void LoadProgramCache(const std::string& filePath);
+
+  /**
+   * @brief Returns the counters of the program cache file.
+   * @return The statistics of the persistent program cache.
+   */
+  const PersistentProgramCache::Statistics& GetProgramCacheStatistics() const;
+
   // This method should be called from Core::PreRender()
 
   /**
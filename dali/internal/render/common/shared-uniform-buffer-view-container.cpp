@@ -164,7 +164,9 @@ void SharedUniformBufferViewContainer::Initialize(Render::UniformBufferManager&
     auto& ubo = *(item.second.get());
 
     // Write to the buffer view here, by value at sharedUniformBlock.
+    // The views are kept until Finalize(), so count their bytes now, with the rest of the frame.
     sharedUniformBlock.WriteUniforms(programIndex, ubo);
+    ubo.CommitWrittenBytes();
   }
   DALI_LOG_INFO(gLogFilter, Debug::Verbose, "Registered : %zu, SharedUniformBufferView count : %u, total block size:%u %u\n", mImpl->mSharedUniformBlockBufferViews.size(), totalUniformBufferViewCount, totalSize, mImpl->mTotalAlignedBlockSize);
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/common/texture-upload-scheduler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/graphics-api/graphics-controller.h>
+#include <dali/internal/render/renderers/render-texture.h>
+
+namespace Dali::Internal::Render
+{
+TextureUploadScheduler::TextureUploadScheduler(Graphics::Controller& graphicsController, uint32_t bytesPerFrame)
+: mGraphicsController(graphicsController),
+  mPendingUploads(),
+  mPendingCount(),
+  mBytesPerFrame(bytesPerFrame)
+{
+}
+
+void TextureUploadScheduler::ScheduleUpload(Render::Texture& texture, PixelDataPtr pixelData, const Graphics::UploadParams& params)
+{
+  // Compressed formats have no bytes per pixel, count their whole buffer.
+  const uint32_t bytePerPixel = Pixel::GetBytesPerPixel(pixelData->GetPixelFormat());
+  const uint32_t byteSize     = bytePerPixel ? static_cast<uint32_t>(params.dataWidth) * params.dataHeight * bytePerPixel : pixelData->GetBufferSize();
+
+  mPendingUploads.push_back({&texture, std::move(pixelData), params, byteSize});
+  ++mPendingCount[&texture];
+}
+
+bool TextureUploadScheduler::ScheduleGenerateMipmaps(Render::Texture& texture)
+{
+  auto iter = mPendingCount.find(&texture);
+  if(iter == mPendingCount.end())
+  {
+    return false;
+  }
+
+  // The mipmaps must be generated from the data uploaded before, so it is queued behind them.
+  mPendingUploads.push_back({&texture, PixelDataPtr(), Graphics::UploadParams{}, 0u});
+  ++iter->second;
+  return true;
+}
+
+void TextureUploadScheduler::RemoveTexture(const Render::Texture& texture)
+{
+  if(mPendingCount.erase(&texture) > 0u)
+  {
+    mPendingUploads.erase(std::remove_if(mPendingUploads.begin(), mPendingUploads.end(), [&texture](const PendingUpload& upload) { return upload.texture == &texture; }),
+                          mPendingUploads.end());
+  }
+}
+
+void TextureUploadScheduler::Clear()
+{
+  mPendingUploads.clear();
+  mPendingCount.clear();
+}
+
+uint32_t TextureUploadScheduler::UploadPendingData(const VisibleTextures& visibleTextures)
+{
+  if(mPendingUploads.empty())
+  {
+    return 0u;
+  }
+
+  // Uploads to the same texture keep their order, as the visibility is the same for all of them.
+  if(!visibleTextures.empty())
+  {
+    std::stable_partition(mPendingUploads.begin(), mPendingUploads.end(), [&visibleTextures](const PendingUpload& upload) { return visibleTextures.find(upload.texture) != visibleTextures.end(); });
+  }
+
+  uint32_t       uploadedBytes = 0u;
+  uint32_t       doneCount     = 0u;
+  const uint32_t pendingCount  = GetPendingCount();
+  for(; doneCount < pendingCount; ++doneCount)
+  {
+    PendingUpload& upload = mPendingUploads[doneCount];
+
+    // Always upload something, so that a single big image can not block the queue.
+    if(uploadedBytes > 0u && uploadedBytes + upload.byteSize > mBytesPerFrame)
+    {
+      break;
+    }
+
+    auto iter = mPendingCount.find(upload.texture);
+    if(--iter->second == 0u)
+    {
+      mPendingCount.erase(iter);
+    }
+
+    // A texture may re-create its graphics object when the data is prepared, which would invalidate the batched
+    // uploads to its previous object. The mipmaps need the batched data too.
+    if(!upload.pixelData || std::find(mBatchTextures.begin(), mBatchTextures.end(), upload.texture) != mBatchTextures.end())
+    {
+      FlushBatch();
+    }
+
+    if(upload.pixelData)
+    {
+      mBatchInfos.emplace_back();
+      mBatchSourceInfos.emplace_back();
+      mBatchTextures.push_back(upload.texture);
+      upload.texture->PrepareUpload(upload.pixelData, upload.params, mBatchInfos.back(), mBatchSourceInfos.back());
+      mBatchInfos.back().srcReference = static_cast<uint32_t>(mBatchSourceInfos.size() - 1u); // The source of this upload in the batch
+      uploadedBytes += upload.byteSize;
+    }
+    else
+    {
+      upload.texture->GenerateMipmapsImmediately();
+    }
+  }
+
+  FlushBatch();
+  mPendingUploads.erase(mPendingUploads.begin(), mPendingUploads.begin() + doneCount);
+
+  return doneCount;
+}
+
+void TextureUploadScheduler::FlushBatch()
+{
+  if(mBatchInfos.empty())
+  {
+    return;
+  }
+
+  mGraphicsController.UpdateTextures(mBatchInfos, mBatchSourceInfos);
+
+  for(auto* texture : mBatchTextures)
+  {
+    texture->FinishUpload();
+  }
+
+  mBatchInfos.clear();
+  mBatchSourceInfos.clear();
+  mBatchTextures.clear();
+}
+
+} // namespace Dali::Internal::Render
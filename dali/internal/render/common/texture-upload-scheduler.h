@@ -0,0 +1,157 @@
+#ifndef DALI_INTERNAL_RENDER_TEXTURE_UPLOAD_SCHEDULER_H
+#define DALI_INTERNAL_RENDER_TEXTURE_UPLOAD_SCHEDULER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/graphics-api/graphics-texture-upload-helper.h> ///< for Graphics::UploadParams
+#include <dali/graphics-api/graphics-types.h>
+#include <dali/internal/event/images/pixel-data-impl.h> ///< for PixelDataPtr
+
+namespace Dali
+{
+namespace Graphics
+{
+class Controller;
+} // namespace Graphics
+
+namespace Internal::Render
+{
+class Texture;
+
+/**
+ * @brief Spreads the texture uploads over several frames.
+ *
+ * Without a scheduler, every upload message is executed as soon as the render thread processes it,
+ * so a frame may have to upload dozens of images at once. The scheduler queues them instead, and
+ * uploads at most a given number of bytes per frame. The textures used by the current render
+ * instructions are uploaded first, and the uploads of a frame are sent to the controller at once.
+ *
+ * Only used from the render thread.
+ */
+class TextureUploadScheduler
+{
+public:
+  using VisibleTextures = std::unordered_set<const Render::Texture*>;
+
+  /**
+   * @brief Constructor
+   * @param[in] graphicsController The graphics controller
+   * @param[in] bytesPerFrame The number of bytes to upload per frame. At least one upload is done per frame.
+   */
+  TextureUploadScheduler(Graphics::Controller& graphicsController, uint32_t bytesPerFrame);
+
+  /**
+   * @brief Destructor
+   */
+  ~TextureUploadScheduler() = default;
+
+  TextureUploadScheduler(const TextureUploadScheduler&)            = delete;
+  TextureUploadScheduler& operator=(const TextureUploadScheduler&) = delete;
+
+public:
+  /**
+   * @brief Queues an upload to the texture.
+   * @param[in] texture The texture to upload to
+   * @param[in] pixelData The pixel data to upload
+   * @param[in] params Upload parameters. See UploadParams
+   */
+  void ScheduleUpload(Render::Texture& texture, PixelDataPtr pixelData, const Graphics::UploadParams& params);
+
+  /**
+   * @brief Queues the mipmap generation of the texture after its pending uploads.
+   * @param[in] texture The texture
+   * @return True if queued, false if the texture has no pending upload, i.e. the mipmaps can be generated now
+   */
+  bool ScheduleGenerateMipmaps(Render::Texture& texture);
+
+  /**
+   * @brief Drops the pending uploads of a texture which is being destroyed.
+   * @param[in] texture The texture
+   */
+  void RemoveTexture(const Render::Texture& texture);
+
+  /**
+   * @brief Drops every pending upload.
+   */
+  void Clear();
+
+  /**
+   * @brief Uploads the queued data within the budget of the frame.
+   * @param[in] visibleTextures The textures used by the current render instructions, which are uploaded first
+   * @return The number of queued uploads and mipmap generations done
+   */
+  uint32_t UploadPendingData(const VisibleTextures& visibleTextures);
+
+  /**
+   * @return The number of queued uploads and mipmap generations
+   */
+  uint32_t GetPendingCount() const
+  {
+    return static_cast<uint32_t>(mPendingUploads.size());
+  }
+
+  /**
+   * @return The number of bytes uploaded per frame
+   */
+  uint32_t GetBytesPerFrame() const
+  {
+    return mBytesPerFrame;
+  }
+
+private:
+  /**
+   * @brief An upload, or a mipmap generation if pixelData is null.
+   */
+  struct PendingUpload
+  {
+    Render::Texture*       texture;
+    PixelDataPtr           pixelData;
+    Graphics::UploadParams params;
+    uint32_t               byteSize;
+  };
+
+  /**
+   * @brief Sends the batched uploads to the controller, and notifies their textures.
+   */
+  void FlushBatch();
+
+private:
+  Graphics::Controller& mGraphicsController;
+
+  std::vector<PendingUpload>                           mPendingUploads; ///< Queue, in the order of the messages
+  std::unordered_map<const Render::Texture*, uint32_t> mPendingCount;   ///< Number of pending uploads per texture
+
+  std::vector<Graphics::TextureUpdateInfo>       mBatchInfos;       ///< Uploads of the current batch
+  std::vector<Graphics::TextureUpdateSourceInfo> mBatchSourceInfos; ///< Sources of the current batch
+  std::vector<Render::Texture*>                  mBatchTextures;    ///< Textures of the current batch
+
+  uint32_t mBytesPerFrame;
+};
+
+} // namespace Internal::Render
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RENDER_TEXTURE_UPLOAD_SCHEDULER_H
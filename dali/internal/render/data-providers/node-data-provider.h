@@ -43,6 +43,11 @@ public:
    */
   virtual const UniformMap& GetNodeUniformMap() const = 0;
 
+  /**
+   * Query whether a property of the node has changed during this frame
+   */
+  virtual bool IsNodeUpdated() const = 0;
+
 protected:
   /**
    * Virtual destructor, this is an interface, no deletion through this interface
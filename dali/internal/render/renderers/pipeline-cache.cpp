@@ -19,11 +19,13 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstddef>
 
 // INTERNAL INCLUDES
 #include <dali/graphics-api/graphics-types.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/render/common/render-instruction.h>
+#include <dali/internal/render/renderers/render-instance-data.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/render/renderers/render-vertex-buffer.h>
 #include <dali/internal/render/shaders/program.h>
@@ -197,6 +199,39 @@ constexpr Graphics::BlendOp ConvertBlendEquation(Dali::BlendEquation::Type blend
   }
   return Graphics::BlendOp{};
 }
+/**
+ * @brief Adds the per-instance buffer binding of the auto instancing shaders after the geometry bindings.
+ */
+void AddInstanceInputState(Graphics::VertexInputState& vertexInputState, const Graphics::Reflection& reflection, uint32_t bindingIndex)
+{
+  vertexInputState.bufferBindings.emplace_back(static_cast<uint32_t>(sizeof(InstanceData)), Graphics::VertexInputRate::PER_INSTANCE);
+
+  const int32_t matrixLocation = reflection.GetVertexAttributeLocation(INSTANCE_MVP_MATRIX_ATTRIBUTE_NAME);
+  if(-1 != matrixLocation)
+  {
+    // A mat4 attribute uses one location per column.
+    for(uint32_t column = 0u; column < 4u; ++column)
+    {
+      vertexInputState.attributes.emplace_back(static_cast<uint32_t>(matrixLocation) + column,
+                                               bindingIndex,
+                                               static_cast<uint32_t>(offsetof(InstanceData, mvpMatrix) + column * 4u * sizeof(float)),
+                                               Graphics::VertexInputFormat::FVECTOR4);
+    }
+  }
+
+  const int32_t colorLocation = reflection.GetVertexAttributeLocation(INSTANCE_COLOR_ATTRIBUTE_NAME);
+  if(-1 != colorLocation)
+  {
+    vertexInputState.attributes.emplace_back(static_cast<uint32_t>(colorLocation), bindingIndex, static_cast<uint32_t>(offsetof(InstanceData, color)), Graphics::VertexInputFormat::FVECTOR4);
+  }
+
+  const int32_t sizeLocation = reflection.GetVertexAttributeLocation(INSTANCE_SIZE_ATTRIBUTE_NAME);
+  if(-1 != sizeLocation)
+  {
+    vertexInputState.attributes.emplace_back(static_cast<uint32_t>(sizeLocation), bindingIndex, static_cast<uint32_t>(offsetof(InstanceData, size)), Graphics::VertexInputFormat::FVECTOR3);
+  }
+}
+
 } // namespace
 
 PipelineCacheL0Ptr PipelineCache::GetPipelineCacheL0(Program* program, Render::Geometry* geometry, SceneGraph::RenderTargetGraphicsObjects* renderTargetGraphicsObjects)
@@ -256,6 +291,12 @@ PipelineCacheL0Ptr PipelineCache::GetPipelineCacheL0(Program* program, Render::G
       }
       ++bindingIndex;
     }
+
+    if(program->GetShaderData()->HintEnabled(Dali::DevelShader::Hint::AUTO_INSTANCING))
+    {
+      AddInstanceInputState(vertexInputState, reflection, bindingIndex);
+    }
+
     PipelineCacheL0 level0;
     level0.program                     = program;
     level0.geometry                    = geometry;
@@ -182,15 +182,15 @@ void Geometry::Upload(Graphics::Controller& graphicsController)
   }
 }
 
-bool Geometry::BindVertexAttributes(Graphics::CommandBuffer& commandBuffer)
+bool Geometry::BindVertexAttributes(Graphics::CommandBuffer& commandBuffer, const InstanceBufferBinding* instanceBinding)
 {
   // Bind buffers to attribute locations
   const auto vertexBufferCount = static_cast<uint32_t>(mVertexBuffers.Count());
 
   std::vector<const Graphics::Buffer*> buffers;
   std::vector<uint32_t>                offsets;
-  buffers.reserve(vertexBufferCount);
-  offsets.reserve(vertexBufferCount);
+  buffers.reserve(vertexBufferCount + 1u);
+  offsets.reserve(vertexBufferCount + 1u);
 
   for(uint32_t i = 0; i < vertexBufferCount; ++i)
   {
@@ -212,6 +212,12 @@ bool Geometry::BindVertexAttributes(Graphics::CommandBuffer& commandBuffer)
     return false;
   }
 
+  if(instanceBinding)
+  {
+    buffers.emplace_back(instanceBinding->buffer);
+    offsets.emplace_back(instanceBinding->offset);
+  }
+
   commandBuffer.BindVertexBuffers(0, buffers, offsets);
 
   return true;
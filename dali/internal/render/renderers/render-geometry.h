@@ -25,6 +25,7 @@
 #include <dali/graphics-api/graphics-controller.h>
 #include <dali/graphics-api/graphics-types.h>
 #include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/render/renderers/render-instance-data.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/rendering/geometry.h>
 
@@ -168,9 +169,10 @@ public:
    * @brief Set up the attributes bind commaneds
    *
    * @param[in,out] commandBuffer The current command buffer queue
+   * @param[in] instanceBinding The instance buffer to bind after the vertex buffers, if any
    * @return true if the bind command was issued, false otherwise
    */
-  bool BindVertexAttributes(Graphics::CommandBuffer& commandBuffer);
+  bool BindVertexAttributes(Graphics::CommandBuffer& commandBuffer, const InstanceBufferBinding* instanceBinding = nullptr);
 
   /**
    * Allows Geometry to track the life-cycle of this object.
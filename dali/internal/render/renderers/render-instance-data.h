@@ -0,0 +1,64 @@
+#ifndef DALI_INTERNAL_RENDER_INSTANCE_DATA_H
+#define DALI_INTERNAL_RENDER_INSTANCE_DATA_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali/graphics-api/graphics-buffer.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Render
+{
+/**
+ * @brief Per-instance vertex data of the shaders with the Dali::DevelShader::Hint::AUTO_INSTANCING hint.
+ */
+struct InstanceData
+{
+  float mvpMatrix[16]; ///< aInstanceMvpMatrix, column major
+  float color[4];      ///< aInstanceColor
+  float size[4];       ///< aInstanceSize (xyz), w is padding
+};
+
+static_assert(sizeof(InstanceData) == 96u, "InstanceData must be tightly packed");
+
+constexpr const char* INSTANCE_MVP_MATRIX_ATTRIBUTE_NAME = "aInstanceMvpMatrix";
+constexpr const char* INSTANCE_COLOR_ATTRIBUTE_NAME      = "aInstanceColor";
+constexpr const char* INSTANCE_SIZE_ATTRIBUTE_NAME       = "aInstanceSize";
+
+/**
+ * @brief The instance buffer range used by one instanced draw.
+ */
+struct InstanceBufferBinding
+{
+  const Graphics::Buffer* buffer{nullptr}; ///< The buffer containing InstanceData
+  uint32_t                offset{0u};      ///< Offset of the first instance in bytes
+  uint32_t                instanceCount{0u};
+};
+
+} // namespace Render
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_RENDER_INSTANCE_DATA_H
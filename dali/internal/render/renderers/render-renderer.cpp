@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstring>
+#include <mutex>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/signals/render-callback.h>
@@ -55,6 +57,30 @@ namespace
 Dali::Internal::SceneGraph::MemoryPoolCollection*                                 gMemoryPoolCollection = nullptr;
 static constexpr Dali::Internal::SceneGraph::MemoryPoolCollection::MemoryPoolType gMemoryPoolType       = Dali::Internal::SceneGraph::MemoryPoolCollection::MemoryPoolType::RENDER_RENDERER;
 
+constexpr std::size_t NODE_INDEX_LINEAR_SEARCH_LIMIT  = 8u;  ///< The number of render items of a renderer found by a linear search
+constexpr uint32_t    UNIFORM_MAP_LINEAR_SEARCH_LIMIT = 16u; ///< The number of collected uniforms merged with the node uniforms by a linear search
+
+bool       gRecordingInParallel = false; ///< Whether render lists are being recorded by several threads
+std::mutex gSharedCacheMutex;            ///< Guards the programs, pipelines, textures and samplers while recording in parallel
+
+/**
+ * @brief Locks the caches shared by all the renderers, if render lists are being recorded by several threads.
+ * @return The lock, which owns nothing when recording on a single thread
+ */
+inline std::unique_lock<std::mutex> LockSharedCaches()
+{
+  return gRecordingInParallel ? std::unique_lock<std::mutex>(gSharedCacheMutex) : std::unique_lock<std::mutex>();
+}
+
+/**
+ * @brief Compares the bytes of two values, as the uniforms written from them must be exactly the same.
+ */
+template<typename T>
+inline bool IsBitwiseEqual(const T& lhs, const T& rhs)
+{
+  return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
 /**
  * @brief Store latest bound pipeline, and help that we can skip duplicated pipeline bind.
  *
@@ -63,7 +89,7 @@ static constexpr Dali::Internal::SceneGraph::MemoryPoolCollection::MemoryPoolTyp
  */
 inline bool ReuseLatestBoundPipeline(const Graphics::Pipeline* pipeline)
 {
-  static const Graphics::Pipeline* gLatestPipeline = nullptr;
+  thread_local const Graphics::Pipeline* gLatestPipeline = nullptr;
   if(gLatestPipeline == pipeline)
   {
     return true;
@@ -80,7 +106,7 @@ inline bool ReuseLatestBoundPipeline(const Graphics::Pipeline* pipeline)
  */
 inline bool ReuseLatestBoundVertexAttributes(const Render::Geometry* geometry)
 {
-  static const Render::Geometry* gLatestVertexBoundGeometry = nullptr;
+  thread_local const Render::Geometry* gLatestVertexBoundGeometry = nullptr;
   if(gLatestVertexBoundGeometry == geometry)
   {
     return true;
@@ -97,9 +123,9 @@ inline bool ReuseLatestBoundVertexAttributes(const Render::Geometry* geometry)
  */
 inline bool ReuseLatestBoundBlendingOptions(bool blendEnabled, bool preMultipliedAlpha, const BlendingOptions* blendingOptions)
 {
-  static bool                   gBlendEnabled         = false;
-  static bool                   gPreMultipliedAlpha   = false;
-  static const BlendingOptions* gLatestBlendingOption = nullptr;
+  thread_local bool                   gBlendEnabled         = false;
+  thread_local bool                   gPreMultipliedAlpha   = false;
+  thread_local const BlendingOptions* gLatestBlendingOption = nullptr;
 
   if((gBlendEnabled == blendEnabled) &&
      (!blendEnabled || gPreMultipliedAlpha == preMultipliedAlpha) &&
@@ -121,7 +147,8 @@ namespace
 {
 Render::UboViewContainer& GetUboViewList()
 {
-  static Render::UboViewContainer gUboViews;
+  // Each thread recording render lists has its own views
+  thread_local Render::UboViewContainer gUboViews;
   return gUboViews;
 }
 } // namespace
@@ -146,6 +173,11 @@ void Renderer::FinishedCommandBuffer()
   GetUboViewList().Clear();
 }
 
+void Renderer::SetRecordingInParallel(bool recordingInParallel)
+{
+  gRecordingInParallel = recordingInParallel;
+}
+
 RendererKey Renderer::NewKey(SceneGraph::RenderDataProvider* dataProvider)
 {
   DALI_ASSERT_DEBUG(gMemoryPoolCollection && "Renderer::RegisterMemoryPoolCollection not called!");
@@ -183,6 +215,7 @@ Renderer::Renderer(SceneGraph::RenderDataProvider* dataProvider)
   mDepthTestMode(DepthTestMode::AUTO),
   mPremultipliedAlphaEnabled(false),
   mShaderChanged(false),
+  mShaderUpdated(false),
   mPipelineCached(false),
   mPipelineNotifierCached(false),
   mUseSharedUniformBlock(true)
@@ -462,39 +495,7 @@ Program* Renderer::PrepareProgram(const SceneGraph::RenderInstruction& instructi
   // If program doesn't have Gfx program object assigned yet, prepare it.
   if(!program->GetGraphicsProgramPtr())
   {
-    Graphics::ShaderCreateInfo vertexShaderCreateInfo;
-    vertexShaderCreateInfo.SetPipelineStage(Graphics::PipelineStage::VERTEX_SHADER);
-    vertexShaderCreateInfo.SetSourceMode(Graphics::ShaderSourceMode::TEXT);
-    const std::vector<char>& vertexShaderSrc = shaderData->GetShaderForPipelineStage(Graphics::PipelineStage::VERTEX_SHADER);
-    vertexShaderCreateInfo.SetSourceSize(static_cast<uint32_t>(vertexShaderSrc.size()));
-    vertexShaderCreateInfo.SetSourceData(static_cast<const void*>(vertexShaderSrc.data()));
-    vertexShaderCreateInfo.SetShaderVersion(shaderData->GetVertexShaderVersion());
-    auto vertexShader = mGraphicsController->CreateShader(vertexShaderCreateInfo, nullptr);
-
-    Graphics::ShaderCreateInfo fragmentShaderCreateInfo;
-    fragmentShaderCreateInfo.SetPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER);
-    fragmentShaderCreateInfo.SetSourceMode(Graphics::ShaderSourceMode::TEXT);
-    const std::vector<char>& fragmentShaderSrc = shaderData->GetShaderForPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER);
-    fragmentShaderCreateInfo.SetSourceSize(static_cast<uint32_t>(fragmentShaderSrc.size()));
-    fragmentShaderCreateInfo.SetSourceData(static_cast<const void*>(fragmentShaderSrc.data()));
-    fragmentShaderCreateInfo.SetShaderVersion(shaderData->GetFragmentShaderVersion());
-    auto fragmentShader = mGraphicsController->CreateShader(fragmentShaderCreateInfo, nullptr);
-
-    std::vector<Graphics::ShaderState> shaderStates{
-      Graphics::ShaderState()
-        .SetShader(*vertexShader.get())
-        .SetPipelineStage(Graphics::PipelineStage::VERTEX_SHADER),
-      Graphics::ShaderState()
-        .SetShader(*fragmentShader.get())
-        .SetPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER)};
-
-    auto createInfo = Graphics::ProgramCreateInfo();
-    createInfo.SetShaderState(shaderStates);
-    createInfo.SetName(shaderData->GetName());
-    createInfo.SetFileCaching(shaderData->GetHints() & Dali::Shader::Hint::Value::FILE_CACHE_SUPPORT);
-    createInfo.SetInternal(shaderData->GetHints() & Dali::Shader::Hint::Value::INTERNAL);
-    auto graphicsProgram = mGraphicsController->CreateProgram(createInfo, nullptr);
-    program->SetGraphicsProgram(std::move(graphicsProgram), *mUniformBufferManager, connectedUniformBlocks); // generates reflection, defines memory reqs
+    program->CreateGraphicsProgram(*mUniformBufferManager, connectedUniformBlocks); // generates reflection, defines memory reqs
 
     // DevNode : We always clear the program caches whenever shared uniform blocks information changed to some shader.
     //           So we can always assume that current Graphics::Program could be use current shader's connected uniform blocks.
@@ -543,7 +544,8 @@ bool Renderer::Render(Graphics::CommandBuffer&                             comma
                       bool                                                 blend,
                       const Dali::Internal::SceneGraph::RenderInstruction& instruction,
                       SceneGraph::RenderTargetGraphicsObjects&             renderTargetGraphicsObjects,
-                      uint32_t                                             queueIndex)
+                      uint32_t                                             queueIndex,
+                      const InstanceBufferBinding*                         instanceBinding)
 {
   // Before doing anything test if the call happens in the right queue
   if(!IsDrawCommandsExist() && queueIndex > 0)
@@ -654,6 +656,9 @@ bool Renderer::Render(Graphics::CommandBuffer&                             comma
 
   bool drawn = false;
 
+  // The textures, programs and pipelines are shared with the renderers recorded by other threads.
+  auto sharedCacheLock = LockSharedCaches();
+
   // Check all textures are prepared first.
   if(!BindTextures(commandBuffer))
   {
@@ -666,6 +671,10 @@ bool Renderer::Render(Graphics::CommandBuffer&                             comma
   {
     // Prepare the graphics pipeline. This may either re-use an existing pipeline or create a new one.
     auto& pipeline = PrepareGraphicsPipeline(*program, instruction, renderTargetGraphicsObjects, node, blend);
+    if(sharedCacheLock.owns_lock())
+    {
+      sharedCacheLock.unlock();
+    }
 
     if(!ReuseLatestBoundPipeline(&pipeline))
     {
@@ -707,14 +716,16 @@ bool Renderer::Render(Graphics::CommandBuffer&                             comma
     if(queueIndex == 0)
     {
       std::size_t nodeIndex = BuildUniformIndexMap(node, *program);
-      WriteUniformBuffer(commandBuffer, program, instruction, modelMatrix, modelViewMatrix, viewMatrix, projectionMatrix, worldColor, scale, size, nodeIndex);
+      WriteUniformBuffer(commandBuffer, node, program, instruction, modelMatrix, modelViewMatrix, viewMatrix, projectionMatrix, worldColor, scale, size, nodeIndex);
     }
 
     // @todo We should detect this case much earlier to prevent unnecessary work
     // Reuse latest bound vertex attributes location, or Bind buffers to attribute locations.
-    if(ReuseLatestBoundVertexAttributes(mGeometry) || mGeometry->BindVertexAttributes(commandBuffer))
+    // The instance buffer range changes from one draw to another, so it is always bound again.
+    const bool reuseVertexAttributes = ReuseLatestBoundVertexAttributes(mGeometry) && !instanceBinding;
+    if(reuseVertexAttributes || mGeometry->BindVertexAttributes(commandBuffer, instanceBinding))
     {
-      uint32_t instanceCount = mRenderDataProvider->GetInstanceCount();
+      const uint32_t instanceCount = instanceBinding ? instanceBinding->instanceCount : mRenderDataProvider->GetInstanceCount();
 
       if(!IsDrawCommandsExist())
       {
@@ -738,6 +749,32 @@ bool Renderer::Render(Graphics::CommandBuffer&                             comma
   return drawn;
 }
 
+bool Renderer::IsAutoInstancingEnabled(const SceneGraph::RenderInstruction& instruction) const
+{
+  // Render callbacks and empty renderers have no shader to instance
+  if(!NeedsProgram())
+  {
+    return false;
+  }
+
+  const ShaderDataPtr& shaderData = mRenderDataProvider->GetShader().GetShaderData(instruction.mRenderPassTag);
+  return shaderData && shaderData->HintEnabled(Dali::DevelShader::Hint::AUTO_INSTANCING);
+}
+
+Vector4 Renderer::CalculateFinalColor(const Vector4& worldColor) const
+{
+  const Vector4& mixColor   = mRenderDataProvider->GetMixColor(); ///< Renderer's mix color
+  Vector4        finalColor = worldColor * mixColor;              ///< Applied Actor's original color to renderer's mix color
+  if(mPremultipliedAlphaEnabled)
+  {
+    const float alpha = finalColor.a;
+    finalColor.r *= alpha;
+    finalColor.g *= alpha;
+    finalColor.b *= alpha;
+  }
+  return finalColor;
+}
+
 std::size_t Renderer::BuildUniformIndexMap(const SceneGraph::NodeDataProvider& node, Program& program)
 {
   // Check if the map has changed
@@ -760,8 +797,21 @@ std::size_t Renderer::BuildUniformIndexMap(const SceneGraph::NodeDataProvider& n
   const auto nodeChangeCounter          = nodePtr ? uniformMapNode.GetChangeCounter() : 0;
   const auto renderItemMapChangeCounter = uniformMap.GetChangeCounter();
 
-  auto iter = std::find_if(mNodeIndexMap.begin(), mNodeIndexMap.end(), [nodePtr, programPtr](RenderItemLookup& element)
-  { return (element.node == nodePtr && element.program == programPtr); });
+  // A few render items are found faster by a linear search. When many nodes share this renderer, use the hashed lookup.
+  auto iter = mNodeIndexMap.end();
+  if(mNodeIndexMap.size() <= NODE_INDEX_LINEAR_SEARCH_LIMIT)
+  {
+    iter = std::find_if(mNodeIndexMap.begin(), mNodeIndexMap.end(), [nodePtr, programPtr](RenderItemLookup& element)
+    { return (element.node == nodePtr && element.program == programPtr); });
+  }
+  else
+  {
+    auto lookupIter = mNodeIndexLookup.find(RenderItemKey{nodePtr, programPtr});
+    if(lookupIter != mNodeIndexLookup.end())
+    {
+      iter = mNodeIndexMap.begin() + lookupIter->second;
+    }
+  }
 
   std::size_t renderItemMapIndex;
   if(iter == mNodeIndexMap.end())
@@ -775,6 +825,23 @@ std::size_t Renderer::BuildUniformIndexMap(const SceneGraph::NodeDataProvider& n
     renderItemLookup.renderItemMapChangeCounter = renderItemMapChangeCounter;
     mNodeIndexMap.emplace_back(renderItemLookup);
 
+    if(mNodeIndexMap.size() > NODE_INDEX_LINEAR_SEARCH_LIMIT)
+    {
+      if(mNodeIndexLookup.empty())
+      {
+        // Index all the render items found so far
+        mNodeIndexLookup.reserve(mNodeIndexMap.size());
+        for(std::size_t i = 0u; i < mNodeIndexMap.size(); ++i)
+        {
+          mNodeIndexLookup.emplace(RenderItemKey{mNodeIndexMap[i].node, mNodeIndexMap[i].program}, i);
+        }
+      }
+      else
+      {
+        mNodeIndexLookup.emplace(RenderItemKey{nodePtr, programPtr}, mNodeIndexMap.size() - 1u);
+      }
+    }
+
     updateMaps = true;
     mUniformIndexMaps.resize(mUniformIndexMaps.size() + 1);
   }
@@ -794,10 +861,17 @@ std::size_t Renderer::BuildUniformIndexMap(const SceneGraph::NodeDataProvider& n
   {
     // Reset shader pointer
     mShaderChanged = false;
+    mShaderUpdated = false;
 
     const uint32_t mapCount     = uniformMap.Count();
     const uint32_t mapNodeCount = uniformMapNode.Count();
 
+    // The uniforms written with the previous map are written again
+    if(renderItemMapIndex < mRetainedUniforms.size())
+    {
+      mRetainedUniforms[renderItemMapIndex].frameStamp = 0u;
+    }
+
     mUniformIndexMaps[renderItemMapIndex].clear(); // Clear contents, but keep memory if we don't change size
     mUniformIndexMaps[renderItemMapIndex].resize(mapCount + mapNodeCount);
 
@@ -816,19 +890,47 @@ std::size_t Renderer::BuildUniformIndexMap(const SceneGraph::NodeDataProvider& n
     {
       const auto& nodeMapContainer = uniformMapNode.GetUniformMapContainer();
 
+      // The collected map is shared by all the render items, so its names are indexed once per change.
+      const bool useHashLookup = mapCount > UNIFORM_MAP_LINEAR_SEARCH_LIMIT;
+      if(useHashLookup && (mCollectedUniformLookup.empty() || mCollectedUniformLookupCounter != renderItemMapChangeCounter))
+      {
+        mCollectedUniformLookup.clear();
+        mCollectedUniformLookup.reserve(mapCount);
+        for(uint32_t i = 0; i < mapCount; ++i)
+        {
+          // Keep the first of the same hashes, as the linear search would find.
+          mCollectedUniformLookup.emplace(uniformMap.mUniformMap[i].uniformNameHash, i);
+        }
+        mCollectedUniformLookupCounter = renderItemMapChangeCounter;
+      }
+
       for(const auto& uniformMap : nodeMapContainer)
       {
         const auto& uniformName      = uniformMap.first;
         const auto& propertyMappings = uniformMap.second;
 
         bool found(false);
-        for(uint32_t i = 0; i < mapCount; ++i)
+        if(useHashLookup)
         {
-          if(mUniformIndexMaps[renderItemMapIndex][i].uniformName == uniformName)
+          auto lookupIter = mCollectedUniformLookup.find(propertyMappings.uniformNameHash);
+          if(lookupIter != mCollectedUniformLookup.end() && mUniformIndexMaps[renderItemMapIndex][lookupIter->second].uniformName == uniformName)
           {
-            mUniformIndexMaps[renderItemMapIndex][i].propertyValue = propertyMappings.propertyPtr;
-            found                                                  = true;
-            break;
+            mUniformIndexMaps[renderItemMapIndex][lookupIter->second].propertyValue = propertyMappings.propertyPtr;
+            found                                                                   = true;
+          }
+        }
+
+        // Search linearly for small maps, or if the names of the hash are different.
+        if(!found && (!useHashLookup || mCollectedUniformLookup.count(propertyMappings.uniformNameHash) != 0u))
+        {
+          for(uint32_t i = 0; i < mapCount; ++i)
+          {
+            if(mUniformIndexMaps[renderItemMapIndex][i].uniformName == uniformName)
+            {
+              mUniformIndexMaps[renderItemMapIndex][i].propertyValue = propertyMappings.propertyPtr;
+              found                                                  = true;
+              break;
+            }
           }
         }
 
@@ -851,6 +953,7 @@ std::size_t Renderer::BuildUniformIndexMap(const SceneGraph::NodeDataProvider& n
 
 void Renderer::WriteUniformBuffer(
   Graphics::CommandBuffer&             commandBuffer,
+  const SceneGraph::NodeDataProvider&  node,
   Program*                             program,
   const SceneGraph::RenderInstruction& instruction,
   const Matrix&                        modelMatrix,
@@ -876,6 +979,11 @@ void Renderer::WriteUniformBuffer(
   auto uboCount = reflection.GetUniformBlockCount();
   mUniformBufferBindings.resize(uboCount);
 
+  // Only the standalone uniforms are kept in a persistent buffer, so the uniforms of the
+  // items using other blocks (which are not shared) are always written.
+  UniformBufferView* standaloneView     = nullptr;
+  bool               onlyStandaloneView = true;
+
   for(auto i = 0u; i < blockCount; ++i)
   {
     bool standaloneUniforms = (i == 0);
@@ -908,7 +1016,11 @@ void Renderer::WriteUniformBuffer(
           // If this block IS shared, Get uboView from SharedUniformBufferViewContainer,
           // which all uniform values are written already.
           // Write GPU buffer and offset to unfirom buffer bindings.
-          auto sharedUniformBufferViewPtr = mSharedUniformBufferViewContainer->GetSharedUniformBlockBufferView(*program, *sharedUniformBlock);
+          UniformBufferView* sharedUniformBufferViewPtr = nullptr;
+          {
+            auto sharedCacheLock       = LockSharedCaches();
+            sharedUniformBufferViewPtr = mSharedUniformBufferViewContainer->GetSharedUniformBlockBufferView(*program, *sharedUniformBlock);
+          }
 
           DALI_ASSERT_ALWAYS(sharedUniformBufferViewPtr && "SharedUniformBufferView not exist!");
 
@@ -929,6 +1041,14 @@ void Renderer::WriteUniformBuffer(
         mUniformBufferBindings[i].offset = uniformBufferView->GetOffset();
 
         uboViews[i] = uniformBufferView.release();
+        if(standaloneUniforms)
+        {
+          standaloneView = uboViews[i];
+        }
+        else
+        {
+          onlyStandaloneView = false;
+        }
       }
     }
   }
@@ -938,6 +1058,41 @@ void Renderer::WriteUniformBuffer(
   // don't process bindings if there are no uniform buffers allocated
   if(!uboViews.IsEmpty())
   {
+    const Vector4 finalColor = CalculateFinalColor(worldColor);
+
+    // Use the uniforms written during the previous frame again, if the item has the same memory and nothing they depend on has changed.
+    RetainedUniforms* retainedUniforms = nullptr;
+    UniformBufferV2*  uniformBuffer    = nullptr;
+    if(standaloneView && onlyStandaloneView && mUniformBufferManager->IsRetainedModeEnabled())
+    {
+      if(nodeIndex >= mRetainedUniforms.size())
+      {
+        mRetainedUniforms.resize(nodeIndex + 1u);
+      }
+      retainedUniforms = &mRetainedUniforms[nodeIndex];
+      uniformBuffer    = standaloneView->GetUniformBuffer();
+
+      if(uniformBuffer->IsRetained(retainedUniforms->frameStamp) &&
+         retainedUniforms->uniformBuffer == uniformBuffer &&
+         retainedUniforms->offset == standaloneView->GetOffset() &&
+         !node.IsNodeUpdated() &&
+         !mRenderDataProvider->IsUpdated() &&
+         IsBitwiseEqual(retainedUniforms->modelMatrix, modelMatrix) &&
+         IsBitwiseEqual(retainedUniforms->modelViewMatrix, modelViewMatrix) &&
+         IsBitwiseEqual(retainedUniforms->viewMatrix, viewMatrix) &&
+         IsBitwiseEqual(retainedUniforms->projectionMatrix, projectionMatrix) &&
+         IsBitwiseEqual(retainedUniforms->color, finalColor) &&
+         IsBitwiseEqual(retainedUniforms->worldColor, worldColor) &&
+         IsBitwiseEqual(retainedUniforms->scale, scale) &&
+         IsBitwiseEqual(retainedUniforms->size, size))
+      {
+        retainedUniforms->frameStamp = uniformBuffer->GetFrameStamp();
+        uniformBuffer->AddRetainedBytes(retainedUniforms->writtenBytes);
+
+        commandBuffer.BindUniformBuffers(mUniformBufferBindings);
+        return;
+      }
+    }
     // Write default uniforms
     WriteDefaultUniformV2(program->GetDefaultUniform(Program::DefaultUniformIndex::MODEL_MATRIX), uboViews, modelMatrix);
     WriteDefaultUniformV2(program->GetDefaultUniform(Program::DefaultUniformIndex::VIEW_MATRIX), uboViews, viewMatrix);
@@ -963,15 +1118,6 @@ void Renderer::WriteUniformBuffer(
 
     WriteDefaultUniformV2(program->GetDefaultUniform(Program::DefaultUniformIndex::SCALE), uboViews, scale);
 
-    const Vector4& mixColor   = mRenderDataProvider->GetMixColor(); ///< Renderer's mix color
-    Vector4        finalColor = worldColor * mixColor;              ///< Applied Actor's original color to renderer's mix color
-    if(mPremultipliedAlphaEnabled)
-    {
-      const float alpha = finalColor.a;
-      finalColor.r *= alpha;
-      finalColor.g *= alpha;
-      finalColor.b *= alpha;
-    }
     WriteDefaultUniformV2(program->GetDefaultUniform(Program::DefaultUniformIndex::COLOR), uboViews, finalColor);
     WriteDefaultUniformV2(program->GetDefaultUniform(Program::DefaultUniformIndex::ACTOR_COLOR), uboViews, worldColor);
 
@@ -982,6 +1128,22 @@ void Renderer::WriteUniformBuffer(
     // Write uSize in the end, as it shouldn't be overridable by dynamic properties.
     WriteDefaultUniformV2(program->GetDefaultUniform(Program::DefaultUniformIndex::SIZE), uboViews, size);
 
+    if(retainedUniforms)
+    {
+      retainedUniforms->uniformBuffer    = uniformBuffer;
+      retainedUniforms->frameStamp       = uniformBuffer->GetFrameStamp();
+      retainedUniforms->offset           = standaloneView->GetOffset();
+      retainedUniforms->writtenBytes     = standaloneView->GetWrittenBytes();
+      retainedUniforms->modelMatrix      = modelMatrix;
+      retainedUniforms->modelViewMatrix  = modelViewMatrix;
+      retainedUniforms->viewMatrix       = viewMatrix;
+      retainedUniforms->projectionMatrix = projectionMatrix;
+      retainedUniforms->color            = finalColor;
+      retainedUniforms->worldColor       = worldColor;
+      retainedUniforms->scale            = scale;
+      retainedUniforms->size             = size;
+    }
+
     commandBuffer.BindUniformBuffers(mUniformBufferBindings);
   }
 }
@@ -1129,12 +1291,18 @@ void Renderer::WriteDynUniform(
 void Renderer::SetShaderChanged(bool value)
 {
   mShaderChanged = value;
+  mShaderUpdated = value;
   mSharedUboCache.reset();
 }
 
+void Renderer::OnOccluded()
+{
+  mShaderUpdated = false;
+}
+
 bool Renderer::Updated()
 {
-  if(mRenderCallback || mShaderChanged || (DALI_LIKELY(mGeometry) && mGeometry->Updated()) || mRenderDataProvider->IsUpdated())
+  if(mRenderCallback || mShaderUpdated || (DALI_LIKELY(mGeometry) && mGeometry->Updated()) || mRenderDataProvider->IsUpdated())
   {
     return true;
   }
@@ -1174,9 +1342,13 @@ void Renderer::DetachFromNodeDataProvider(const SceneGraph::NodeDataProvider& no
   //        We don't worry about the mNodeIndexMap and mUniformIndexMaps become invalidated after this call.
   mNodeIndexMap.clear();
   mUniformIndexMaps.clear();
+  mRetainedUniforms.clear();
+  mNodeIndexLookup.clear();
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
   mNodeIndexMap.shrink_to_fit();
   mUniformIndexMaps.shrink_to_fit();
+  mRetainedUniforms.shrink_to_fit();
+  mNodeIndexLookup.rehash(0u);
 #endif
 }
 
@@ -1206,9 +1378,13 @@ void Renderer::PipelineCacheInvalidated(PipelineCacheL0::LifecycleObserver::Noti
       //        We don't worry about the mNodeIndexMap and mUniformIndexMaps become invalidated after this call.
       mNodeIndexMap.clear();
       mUniformIndexMaps.clear();
+      mRetainedUniforms.clear();
+      mNodeIndexLookup.clear();
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
       mNodeIndexMap.shrink_to_fit();
       mUniformIndexMaps.shrink_to_fit();
+      mRetainedUniforms.shrink_to_fit();
+      mNodeIndexLookup.rehash(0u);
 #endif
       break;
     }
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <memory> ///< for std::unique_ptr
+#include <unordered_map>
 #include <unordered_set>
 
 // INTERNAL INCLUDES
@@ -42,6 +43,7 @@
 #include <dali/internal/render/common/render-target-graphics-objects.h> ///< For RenderTargetGraphicsObjects::LifecycleObserver
 #include <dali/internal/render/data-providers/render-data-provider.h>
 #include <dali/internal/render/renderers/pipeline-cache.h>
+#include <dali/internal/render/renderers/render-instance-data.h>
 #include <dali/internal/render/renderers/uniform-buffer-manager.h>
 #include <dali/internal/update/manager/render-instruction-processor.h>
 
@@ -139,6 +141,14 @@ public:
    */
   static void FinishedCommandBuffer();
 
+  /**
+   * @brief Sets whether render lists are being recorded by several threads at the same time.
+   * While set, the programs, pipelines, textures and samplers, which are shared by all the renderers, are locked when used.
+   * @note PrepareCommandBuffer() and FinishedCommandBuffer() act on the calling thread only.
+   * @param[in] recordingInParallel True while render lists are recorded by several threads
+   */
+  static void SetRecordingInParallel(bool recordingInParallel);
+
   /**
    * Create a new renderer instance
    * @param[in] dataProviders The data providers for the renderer
@@ -431,6 +441,7 @@ public:
    * @param[in] instruction. for use case like reflection where CullFace needs to be adjusted
    * @param[in] renderTargetGraphicsObjects render target associated with instruction
    * @param[in] queueIndex Index of the render queue
+   * @param[in] instanceBinding The per-instance data to draw with, if the shader uses auto instancing
    *
    * @return True if commands have been added to the command buffer
    */
@@ -446,7 +457,22 @@ public:
               bool                                                 blend,
               const Dali::Internal::SceneGraph::RenderInstruction& instruction,
               SceneGraph::RenderTargetGraphicsObjects&             renderTargetGraphicsObjects,
-              uint32_t                                             queueIndex);
+              uint32_t                                             queueIndex,
+              const InstanceBufferBinding*                         instanceBinding = nullptr);
+
+  /**
+   * Checks whether the shader used for the instruction reads its per-item data from instance attributes.
+   * @param[in] instruction The render instruction
+   * @return True if the shader has the Dali::DevelShader::Hint::AUTO_INSTANCING hint
+   */
+  [[nodiscard]] bool IsAutoInstancingEnabled(const SceneGraph::RenderInstruction& instruction) const;
+
+  /**
+   * Calculates the color written to uColor, from the world color of a node using this renderer.
+   * @param[in] worldColor The world color of the node
+   * @return The world color mixed with the renderer's mix color, and premultiplied if required
+   */
+  [[nodiscard]] Vector4 CalculateFinalColor(const Vector4& worldColor) const;
 
   /**
    * Returns true if this will create a draw command with it's own geometry
@@ -527,6 +553,12 @@ public:
    */
   void SetShaderChanged(bool value);
 
+  /**
+   * Called instead of rendering when the items drawn after the renderer hide it.
+   * The shader change is not visible, so Updated() stops reporting it.
+   */
+  void OnOccluded();
+
   /**
    * Check if the renderer attributes/uniforms are updated and returns the flag
    */
@@ -572,6 +604,16 @@ public:
    */
   void DetachFromNodeDataProvider(const SceneGraph::NodeDataProvider& node);
 
+  /**
+   * @brief Gets the textures used by the renderer.
+   *
+   * @return The textures, or nullptr if the renderer has no texture set
+   */
+  const Dali::Vector<Render::TextureKey>* GetTextures() const
+  {
+    return mRenderDataProvider->GetTextures();
+  }
+
   /**
    * @brief Gets the update area of textures.
    *
@@ -670,6 +712,7 @@ private:
    * @param[in] The node index
    */
   void WriteUniformBuffer(Graphics::CommandBuffer&             commandBuffer,
+                          const SceneGraph::NodeDataProvider&  node,
                           Program*                             program,
                           const SceneGraph::RenderInstruction& instruction,
                           const Matrix&                        modelMatrix,
@@ -771,12 +814,65 @@ private:
   using UniformIndexMappings = std::vector<UniformIndexMap>;
   std::vector<UniformIndexMappings> mUniformIndexMaps; ///< Cached map per node/renderer/shader.
 
+  /** The standalone uniforms written for a render item, so that they can be used again in the next frame */
+  struct RetainedUniforms
+  {
+    const UniformBufferV2* uniformBuffer{nullptr}; ///< The buffer the uniforms were written into
+    uint64_t               frameStamp{0u};         ///< Frame stamp of the buffer when the uniforms were written. 0 if they must be written again
+    uint32_t               offset{0u};             ///< Offset of the uniforms in the buffer
+    uint32_t               writtenBytes{0u};       ///< Number of bytes written for the uniforms
+
+    // The values the default uniforms are calculated from
+    Matrix  modelMatrix{false};
+    Matrix  modelViewMatrix{false};
+    Matrix  viewMatrix{false};
+    Matrix  projectionMatrix{false};
+    Vector4 color;      ///< The final color, after the mix color and the premultiplied alpha are applied
+    Vector4 worldColor; ///< The color of the actor, written to uActorColor
+    Vector3 scale;
+    Vector3 size;
+  };
+  std::vector<RetainedUniforms> mRetainedUniforms; ///< Parallel to mUniformIndexMaps. Only used in the retained mode of the uniform buffer manager.
+
+  /** Key of a render item (node / program pair) in mNodeIndexLookup */
+  struct RenderItemKey
+  {
+    const SceneGraph::NodeDataProvider* node{nullptr};
+    const Program*                      program{nullptr};
+
+    bool operator==(const RenderItemKey& rhs) const
+    {
+      return node == rhs.node && program == rhs.program;
+    }
+
+    struct RenderItemKeyHash
+    {
+      // Reference by : https://stackoverflow.com/a/21062236
+      std::size_t operator()(RenderItemKey const& key) const noexcept
+      {
+        constexpr std::size_t alignmentShift = 3u;                      // The lower bits of heap pointers are always zero
+        constexpr std::size_t zitterShift    = sizeof(std::size_t) * 4; // zitter shift to avoid hash collision
+
+        return ((reinterpret_cast<std::size_t>(key.node) >> alignmentShift) << zitterShift) ^
+               (reinterpret_cast<std::size_t>(key.program) >> alignmentShift);
+      }
+    };
+  };
+
+  using NodeIndexLookup       = std::unordered_map<RenderItemKey, std::size_t, RenderItemKey::RenderItemKeyHash>;
+  using UniformNameHashLookup = std::unordered_map<Hash, uint32_t>;
+
+  NodeIndexLookup       mNodeIndexLookup;                   ///< Index into mNodeIndexMap per render item. Only used when many nodes share this renderer.
+  UniformNameHashLookup mCollectedUniformLookup;            ///< Index into the collected uniform map per uniform name hash. Only used when the map is large.
+  std::size_t           mCollectedUniformLookupCounter{0u}; ///< Change counter of the collected uniform map when mCollectedUniformLookup was built
+
   DepthFunction::Type   mDepthFunction : 4;             ///< The depth function
   FaceCullingMode::Type mFaceCullingMode : 3;           ///< The mode of face culling
   DepthWriteMode::Type  mDepthWriteMode : 3;            ///< The depth write mode
   DepthTestMode::Type   mDepthTestMode : 3;             ///< The depth test mode
   bool                  mPremultipliedAlphaEnabled : 1; ///< Flag indicating whether the Pre-multiplied Alpha Blending is required
   bool                  mShaderChanged : 1;             ///< Flag indicating the shader changed and uniform maps have to be updated
+  bool                  mShaderUpdated : 1;             ///< Flag indicating the shader changed since the renderer was last drawn
   bool                  mPipelineCached : 1;            ///< Flag indicating whether renderer cache valid pipeline or not.
   bool                  mPipelineNotifierCached : 1;    ///< Flag indicating whether renderer cache valid pipeline notifier or not.
   bool                  mUseSharedUniformBlock : 1;     ///< Flag whether we should use shared uniform block or not. Usually it must be true.
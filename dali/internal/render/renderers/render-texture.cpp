@@ -24,6 +24,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/internal/common/memory-pool-object-allocator.h>
 #include <dali/internal/render/common/render-manager.h>
+#include <dali/internal/render/common/texture-upload-scheduler.h>
 #include <dali/internal/update/common/scene-graph-memory-pool-collection.h>
 
 namespace Dali
@@ -251,6 +252,26 @@ void Texture::Upload(PixelDataPtr pixelData, const Graphics::UploadParams& param
   DALI_ASSERT_ALWAYS(!mNativeImage);
   DALI_ASSERT_ALWAYS(mResourceId == 0u);
 
+  if(mRenderManager)
+  {
+    if(auto* uploadScheduler = mRenderManager->GetTextureUploadScheduler())
+    {
+      uploadScheduler->ScheduleUpload(*this, std::move(pixelData), params);
+      return;
+    }
+  }
+
+  Graphics::TextureUpdateInfo       info{};
+  Graphics::TextureUpdateSourceInfo updateSourceInfo{};
+  PrepareUpload(pixelData, params, info, updateSourceInfo);
+
+  mGraphicsController->UpdateTextures({info}, {updateSourceInfo});
+
+  FinishUpload();
+}
+
+void Texture::PrepareUpload(const PixelDataPtr& pixelData, const Graphics::UploadParams& params, Graphics::TextureUpdateInfo& info, Graphics::TextureUpdateSourceInfo& updateSourceInfo)
+{
   const uint32_t srcStrideBytes = pixelData->GetStrideBytes();
   uint32_t       srcOffset      = 0u;
   uint32_t       srcSize        = pixelData->GetBufferSize();
@@ -316,8 +337,6 @@ void Texture::Upload(PixelDataPtr pixelData, const Graphics::UploadParams& param
     Create(static_cast<Graphics::TextureUsageFlags>(Graphics::TextureUsageFlagBits::SAMPLE), isSubImage ? Graphics::TextureAllocationPolicy::CREATION : Graphics::TextureAllocationPolicy::UPLOAD);
   }
 
-  Graphics::TextureUpdateInfo info{};
-
   info.dstTexture   = mGraphicsTexture.get();
   info.dstOffset2D  = {params.xOffset, params.yOffset};
   info.layer        = params.layer;
@@ -331,12 +350,12 @@ void Texture::Upload(PixelDataPtr pixelData, const Graphics::UploadParams& param
 
   mUpdatedArea = Rect<uint16_t>(params.xOffset, params.yOffset, params.width, params.height);
 
-  Graphics::TextureUpdateSourceInfo updateSourceInfo{};
   updateSourceInfo.sourceType                = Graphics::TextureUpdateSourceInfo::Type::PIXEL_DATA;
   updateSourceInfo.pixelDataSource.pixelData = Dali::PixelData(pixelData.Get());
+}
 
-  mGraphicsController->UpdateTextures({info}, {updateSourceInfo});
-
+void Texture::FinishUpload()
+{
   SetUpdated(true);
 
   NotifyTextureUpdated();
@@ -370,6 +389,20 @@ void Texture::GenerateMipmaps()
 {
   DALI_ASSERT_ALWAYS(mResourceId == 0u);
 
+  if(mRenderManager)
+  {
+    auto* uploadScheduler = mRenderManager->GetTextureUploadScheduler();
+    if(uploadScheduler && uploadScheduler->ScheduleGenerateMipmaps(*this))
+    {
+      return;
+    }
+  }
+
+  GenerateMipmapsImmediately();
+}
+
+void Texture::GenerateMipmapsImmediately()
+{
   // Compressed pixel doesn't support mipmap generation.
   if(Pixel::IsCompressed(mPixelFormat))
   {
@@ -147,17 +147,37 @@ public:
   void Destroy();
 
   /**
-   * Uploads data to the texture.
+   * Uploads data to the texture, or queues the upload if the render manager has a texture upload scheduler.
    * @param[in] pixelData A pixel data object
    * @param[in] params Upload parameters. See UploadParams
    */
   void Upload(PixelDataPtr pixelData, const Graphics::UploadParams& params);
 
   /**
-   * Auto generates mipmaps for the texture
+   * Creates the graphics texture if needed, and fills the information to upload data to it.
+   * FinishUpload() must be called once the upload is sent to the graphics controller.
+   * @param[in] pixelData A pixel data object
+   * @param[in] params Upload parameters. See UploadParams
+   * @param[out] info The update information of the upload
+   * @param[out] updateSourceInfo The source of the upload
+   */
+  void PrepareUpload(const PixelDataPtr& pixelData, const Graphics::UploadParams& params, Graphics::TextureUpdateInfo& info, Graphics::TextureUpdateSourceInfo& updateSourceInfo);
+
+  /**
+   * Marks the texture as updated after an upload.
+   */
+  void FinishUpload();
+
+  /**
+   * Auto generates mipmaps for the texture, after the queued uploads if any.
    */
   void GenerateMipmaps();
 
+  /**
+   * Auto generates mipmaps for the texture now.
+   */
+  void GenerateMipmapsImmediately();
+
   /**
    * Retrieve whether the texture has an alpha channel
    * @return True if the texture has alpha channel, false otherwise
@@ -19,6 +19,7 @@
 #include <dali/internal/render/renderers/uniform-buffer-manager.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/common/environment-variable.h>
 #include <dali/internal/render/renderers/uniform-buffer-view.h>
 #include <dali/internal/render/renderers/uniform-buffer.h>
 
@@ -33,12 +34,30 @@
 namespace
 {
 uint32_t CPU_MEMORY_ALIGNMENT{256};
+
+constexpr const char* RETAINED_UNIFORM_BUFFER_ENV = "DALI_RETAINED_UNIFORM_BUFFER"; ///< Set to 1 to keep the uniforms of the unchanged render items across frames
+
+bool IsRetainedModeEnabledByEnvironment()
+{
+  return Dali::Internal::EnvironmentVariable::GetBooleanValue(RETAINED_UNIFORM_BUFFER_ENV, false);
 }
 
+uint32_t AlignSize(uint32_t size, uint32_t alignment)
+{
+  return ((size + alignment - 1u) / alignment) * alignment;
+}
+} // namespace
+
 namespace Dali::Internal::Render
 {
+namespace
+{
+thread_local UniformBufferManager::ReservedRange* gThreadReservedRange = nullptr; ///< The range the calling thread creates its views in, if any
+} // namespace
+
 UniformBufferManager::UniformBufferManager(Dali::Graphics::Controller* controller)
-: mController(controller)
+: mController(controller),
+  mRetainedModeEnabled(IsRetainedModeEnabledByEnvironment())
 {
 }
 
@@ -73,6 +92,18 @@ Graphics::UniquePtr<UniformBufferView> UniformBufferManager::CreateUniformBuffer
   UBOSet::BufferType                    bufferType = UBOSet::GetBufferType(mCurrentSceneOffscreen, emulated);
   Graphics::UniquePtr<UniformBufferV2>& ubo        = mCurrentUBOSet->GetBuffer(bufferType);
 
+  if(gThreadReservedRange)
+  {
+    // Take the memory from the range of this thread, as other threads are creating views too
+    uint32_t& rangeOffset = emulated ? gThreadReservedRange->cpuOffset : gThreadReservedRange->gpuOffset;
+
+    auto offset = rangeOffset;
+    rangeOffset += AlignSize(size, ubo->GetBlockAlignment());
+    DALI_ASSERT_ALWAYS(rangeOffset <= (emulated ? gThreadReservedRange->cpuEnd : gThreadReservedRange->gpuEnd) && "Reserved uniform buffer range overflow");
+
+    return Graphics::UniquePtr<UniformBufferView>(UniformBufferView::TryRecycle(oldView, *ubo.get(), offset));
+  }
+
   // Use current offset and increment it after
   auto offset = ubo->GetCurrentOffset();
   auto retval = Graphics::UniquePtr<UniformBufferView>(UniformBufferView::TryRecycle(oldView, *ubo.get(), offset));
@@ -81,6 +112,33 @@ Graphics::UniquePtr<UniformBufferView> UniformBufferManager::CreateUniformBuffer
   return retval;
 }
 
+UniformBufferManager::ReservedRange UniformBufferManager::ReserveRange(uint32_t cpuSize, uint32_t gpuSize)
+{
+  ReservedRange range;
+  if(mCurrentUBOSet)
+  {
+    auto& cpuBuffer = mCurrentUBOSet->GetBuffer(UBOSet::GetBufferType(mCurrentSceneOffscreen, true));
+    auto& gpuBuffer = mCurrentUBOSet->GetBuffer(UBOSet::GetBufferType(mCurrentSceneOffscreen, false));
+
+    range.cpuOffset = range.cpuEnd = cpuBuffer->GetCurrentOffset();
+    range.gpuOffset = range.gpuEnd = gpuBuffer->GetCurrentOffset();
+    if(cpuSize)
+    {
+      range.cpuEnd = cpuBuffer->IncrementOffsetBy(cpuSize);
+    }
+    if(gpuSize)
+    {
+      range.gpuEnd = gpuBuffer->IncrementOffsetBy(gpuSize);
+    }
+  }
+  return range;
+}
+
+void UniformBufferManager::SetThreadReservedRange(ReservedRange* range)
+{
+  gThreadReservedRange = range;
+}
+
 void UniformBufferManager::RegisterScene(SceneGraph::Scene* scene)
 {
   auto iter = mUBOMap.find(scene);
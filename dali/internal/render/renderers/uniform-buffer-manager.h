@@ -41,6 +41,17 @@ class UniformBufferView;
 class UniformBufferManager
 {
 public:
+  /**
+   * Ranges of the current uniform buffers, reserved for the views created by one thread.
+   */
+  struct ReservedRange
+  {
+    uint32_t cpuOffset{0u}; ///< Offset of the next view in the CPU buffer
+    uint32_t cpuEnd{0u};    ///< End of the range in the CPU buffer
+    uint32_t gpuOffset{0u}; ///< Offset of the next view in the GPU buffer
+    uint32_t gpuEnd{0u};    ///< End of the range in the GPU buffer
+  };
+
   explicit UniformBufferManager(Dali::Graphics::Controller* controller);
 
   ~UniformBufferManager();
@@ -49,6 +60,22 @@ public:
 
   Graphics::UniquePtr<UniformBufferView> CreateUniformBufferView(UniformBufferView*& oldView, uint32_t size, bool emulated = true);
 
+  /**
+   * @brief Reserves memory of the current uniform buffers, from which the views of another thread are created.
+   * Only called from the render thread, once the buffers are specified for the frame.
+   * @param[in] cpuSize The size to reserve in the CPU buffer, including the alignment of each block
+   * @param[in] gpuSize The size to reserve in the GPU buffer, including the alignment of each block
+   * @return The reserved ranges
+   */
+  ReservedRange ReserveRange(uint32_t cpuSize, uint32_t gpuSize);
+
+  /**
+   * @brief Makes CreateUniformBufferView() create the views of the calling thread in the given range,
+   * so that several threads can create views at the same time.
+   * @param[in] range The range reserved with ReserveRange(), or nullptr to create the views at the end of the buffers again
+   */
+  static void SetThreadReservedRange(ReservedRange* range);
+
   /**
    * @brief Registers scene with the manager
    * The manager creates a set of UBOs per scene.
@@ -96,6 +123,17 @@ public:
    */
   uint32_t GetUniformBlockAlignment(bool emulated);
 
+  /**
+   * Checks whether the render items may use again the uniforms they wrote during the previous frame,
+   * instead of writing them again, when nothing they depend on has changed.
+   * Disabled unless the environment variable DALI_RETAINED_UNIFORM_BUFFER is set to 1.
+   * @return True if the retained mode is enabled
+   */
+  bool IsRetainedModeEnabled() const
+  {
+    return mRetainedModeEnabled;
+  }
+
 private:
   Dali::Graphics::Controller* mController;
 
@@ -177,6 +215,7 @@ private:
   UBOSet*                              mCurrentUBOSet{nullptr};
   uint32_t                             mCachedUniformBlockAlignment{0u};
   bool                                 mCurrentSceneOffscreen{false};
+  bool                                 mRetainedModeEnabled{true};
 };
 
 } // namespace Dali::Internal::Render
@@ -35,7 +35,8 @@ static constexpr Dali::Internal::SceneGraph::MemoryPoolCollection::MemoryPoolTyp
 UniformBufferView* UniformBufferView::New(UniformBufferV2& ubo, uint32_t offset)
 {
   DALI_ASSERT_DEBUG(gMemoryPoolCollection && "UniformBufferView::RegisterMemoryPoolCollection not called!");
-  return new(gMemoryPoolCollection->AllocateRaw(gMemoryPoolType)) UniformBufferView(ubo, offset);
+  // The views may be created by the threads recording render lists concurrently
+  return new(gMemoryPoolCollection->AllocateRawThreadSafe(gMemoryPoolType)) UniformBufferView(ubo, offset);
 }
 
 UniformBufferView* UniformBufferView::TryRecycle(UniformBufferView*& oldView, UniformBufferV2& ubo, uint32_t offset)
@@ -43,6 +44,7 @@ UniformBufferView* UniformBufferView::TryRecycle(UniformBufferView*& oldView, Un
   auto* ptr = oldView;
   if(ptr)
   {
+    ptr->CommitWrittenBytes();
     oldView             = nullptr;
     ptr->mUniformBuffer = &ubo;
     ptr->mOffset        = offset;
@@ -67,13 +69,16 @@ UniformBufferView::UniformBufferView(UniformBufferV2& ubo, uint32_t offset)
 {
 }
 
-UniformBufferView::~UniformBufferView() = default;
+UniformBufferView::~UniformBufferView()
+{
+  CommitWrittenBytes();
+}
 
 void UniformBufferView::operator delete(void* ptr)
 {
   if(DALI_LIKELY(gMemoryPoolCollection))
   {
-    gMemoryPoolCollection->Free(gMemoryPoolType, ptr);
+    gMemoryPoolCollection->FreeThreadSafe(gMemoryPoolType, ptr);
   }
 }
 
@@ -81,6 +86,16 @@ void UniformBufferView::Write(const void* data, uint32_t size, uint32_t offset)
 {
   // Write into mapped buffer
   mUniformBuffer->Write(data, size, offset + mOffset);
+  mWrittenBytes += size;
+}
+
+void UniformBufferView::CommitWrittenBytes()
+{
+  if(mWrittenBytes)
+  {
+    mUniformBuffer->AddWrittenBytes(mWrittenBytes);
+    mWrittenBytes = 0u;
+  }
 }
 
 Graphics::Buffer* UniformBufferView::GetBuffer() const
@@ -104,6 +104,21 @@ public:
    */
   void Write(const void* data, uint32_t size, uint32_t offset);
 
+  /**
+   * @brief Returns the number of bytes written through this view since it was created or recycled
+   * @return The number of bytes
+   */
+  [[nodiscard]] uint32_t GetWrittenBytes() const
+  {
+    return mWrittenBytes;
+  }
+
+  /**
+   * @brief Adds the bytes written through this view to the statistics of its uniform buffer, and resets the count.
+   * Called when the view is recycled or destroyed.
+   */
+  void CommitWrittenBytes();
+
   /**
    * @brief Returns the offset within the UBO
    * @return Offset
@@ -120,6 +135,16 @@ public:
    */
   [[nodiscard]] Graphics::Buffer* GetBuffer() const;
 
+  /**
+   * @brief Returns the uniform buffer this view looks into
+   *
+   * @return Pointer to a valid UniformBufferV2 object
+   */
+  [[nodiscard]] UniformBufferV2* GetUniformBuffer() const
+  {
+    return mUniformBuffer;
+  }
+
 protected:
   /**
    * Protected constructor. See New()
@@ -129,6 +154,7 @@ protected:
 private:
   UniformBufferV2* mUniformBuffer{nullptr}; ///< UniformBuffer that the view views
   uint32_t         mOffset{0u};             ///< Offset within the buffer
+  uint32_t         mWrittenBytes{0u};       ///< Bytes written through this view, not yet added to the buffer
 };
 } // namespace Render
 } // namespace Internal
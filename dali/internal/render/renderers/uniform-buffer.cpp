@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/uniform-buffer.h>
 
+// EXTERNAL INCLUDES
+#include <atomic>
+
 // INTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 
@@ -33,6 +36,9 @@ namespace
 constexpr uint32_t INTERNAL_UBO_BUFFER_COUNT = 2u;
 constexpr uint32_t DEFAUT_MEMORY_ALIGNMENT{1};
 
+// Frame stamps are shared by all the buffers, so that the stamp of a destroyed buffer is never matched by a new one.
+std::atomic<uint64_t> gFrameStampCounter{0u};
+
 /**
  * Align size to the current block size.
  */
@@ -143,6 +149,11 @@ void UniformBufferV2::Rollback()
   {
     mBufferList[mCurrentGraphicsBufferIndex].currentOffset = 0; // reset offset
   }
+
+  mPreviousFrameStamp = mFrameStamp;
+  mFrameStamp         = ++gFrameStampCounter;
+  mWrittenBytes       = 0u;
+  mRetainedBytes      = 0u;
 }
 
 uint32_t UniformBufferV2::IncrementOffsetBy(uint32_t value)
@@ -166,6 +177,21 @@ bool UniformBufferV2::MemoryCompare(void* data, uint32_t offset, uint32_t size)
   return !memcmp(data, reinterpret_cast<uint8_t*>(mMappedPtr) + offset, size);
 }
 
+bool UniformBufferV2::IsRetained(uint64_t frameStamp) const
+{
+  return mEmulated && mMappedPtr && frameStamp != 0u && frameStamp == mPreviousFrameStamp;
+}
+
+void UniformBufferV2::AddRetainedBytes(uint32_t size)
+{
+  mRetainedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void UniformBufferV2::AddWrittenBytes(uint32_t size)
+{
+  mWrittenBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
 uint32_t UniformBufferV2::GetBlockAlignment() const
 {
   return mBlockAlignment;
@@ -225,6 +251,9 @@ void UniformBufferV2::ReSpecifyCPU(uint32_t sizeInBytes)
     gfxBuffer.currentOffset  = 0;
 
     mBufferList[0] = std::move(gfxBuffer);
+
+    // The memory written in the previous frame is gone
+    mPreviousFrameStamp = 0u;
     // make sure buffer is created (move creation to run in parallel in the backed
     // as this may be a major slowdown)
     mController->WaitIdle();
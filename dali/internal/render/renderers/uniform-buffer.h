@@ -22,6 +22,7 @@
 #include <dali/graphics-api/graphics-controller.h>
 
 // EXTERNAL INCLUDES
+#include <atomic>
 #include <memory>
 
 namespace Dali::Internal::Render
@@ -71,6 +72,52 @@ public:
 
   bool MemoryCompare(void* data, uint32_t offset, uint32_t size);
 
+  /**
+   * Checks whether the memory written during the given frame still holds the written values.
+   * Only the persistent CPU buffer keeps its contents, and only until the end of the frame which
+   * follows the one it was written in, as the same memory is handed out again after each Rollback().
+   * @param[in] frameStamp The frame stamp of this buffer when the memory was written
+   * @return True if the memory can be used again without writing it
+   */
+  [[nodiscard]] bool IsRetained(uint64_t frameStamp) const;
+
+  /**
+   * Records that memory written during the previous frame is used again without being written.
+   * @param[in] size The number of bytes used again
+   */
+  void AddRetainedBytes(uint32_t size);
+
+  /**
+   * Records bytes written into this buffer. The views count their own writes and add them here,
+   * so that the views written by different threads do not update the same counter for every write.
+   * @param[in] size The number of bytes written
+   */
+  void AddWrittenBytes(uint32_t size);
+
+  /**
+   * @return The stamp of the current frame of this buffer, unique among all the buffers. Changed by Rollback().
+   */
+  [[nodiscard]] uint64_t GetFrameStamp() const
+  {
+    return mFrameStamp;
+  }
+
+  /**
+   * @return The number of bytes written since the last Rollback()
+   */
+  [[nodiscard]] uint32_t GetWrittenBytes() const
+  {
+    return mWrittenBytes.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return The number of bytes used again without being written since the last Rollback()
+   */
+  [[nodiscard]] uint32_t GetRetainedBytes() const
+  {
+    return mRetainedBytes.load(std::memory_order_relaxed);
+  }
+
   [[nodiscard]] uint32_t GetBlockAlignment() const;
 
   [[nodiscard]] uint32_t GetCurrentOffset() const;
@@ -115,6 +162,10 @@ private:
   std::vector<GfxBuffer> mBufferList;
   void*                  mMappedPtr{nullptr};
   uint32_t               mCurrentGraphicsBufferIndex{0u};
+  uint64_t               mFrameStamp{0u};         ///< Stamp of the current frame, 0 until the first Rollback()
+  uint64_t               mPreviousFrameStamp{0u}; ///< Stamp of the previous frame, 0 if its contents were lost
+  std::atomic<uint32_t>  mWrittenBytes{0u};       ///< Bytes written since the last Rollback()
+  std::atomic<uint32_t>  mRetainedBytes{0u};      ///< Bytes used again without being written since the last Rollback()
   bool                   mEmulated{false};
 };
 } // namespace Dali::Internal::Render
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/shaders/persistent-program-cache.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/dali-core-version.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace
+{
+constexpr uint32_t FILE_MAGIC          = 0x43505044u; ///< "DPPC"
+constexpr uint32_t FILE_FORMAT_VERSION = 1u;
+
+constexpr uint32_t MAXIMUM_ENTRY_COUNT   = 256u;
+constexpr uint32_t MAXIMUM_SOURCE_LENGTH = 1u << 20u; ///< Guards against reading a corrupted length
+
+FILE* OpenFile(const std::string& path, const char* mode)
+{
+#if defined(_MSC_VER)
+  FILE* file = nullptr;
+  if(fopen_s(&file, path.c_str(), mode) != 0)
+  {
+    file = nullptr;
+  }
+  return file;
+#else
+  return std::fopen(path.c_str(), mode);
+#endif
+}
+
+template<typename T>
+bool Read(FILE* file, T& value)
+{
+  return std::fread(&value, sizeof(T), 1u, file) == 1u;
+}
+
+bool Read(FILE* file, std::string& value)
+{
+  uint32_t length = 0u;
+  if(!Read(file, length) || length > MAXIMUM_SOURCE_LENGTH)
+  {
+    return false;
+  }
+  value.resize(length);
+  return length == 0u || std::fread(&value[0], 1u, length, file) == length;
+}
+
+template<typename T>
+bool Write(FILE* file, const T& value)
+{
+  return std::fwrite(&value, sizeof(T), 1u, file) == 1u;
+}
+
+bool Write(FILE* file, const std::string& value)
+{
+  const uint32_t length = static_cast<uint32_t>(value.size());
+  return Write(file, length) && (length == 0u || std::fwrite(value.data(), 1u, length, file) == length);
+}
+
+/**
+ * Reads the cache file. Runs in a separate thread.
+ */
+std::vector<PersistentProgramCache::Entry> ReadCacheFile(std::string filePath)
+{
+  std::vector<PersistentProgramCache::Entry> entries;
+
+  FILE* file = OpenFile(filePath, "rb");
+  if(!file)
+  {
+    return entries;
+  }
+
+  // The file is discarded if it was written by another version, as the internal shaders may differ.
+  const uint32_t expectedHeader[5] = {FILE_MAGIC, FILE_FORMAT_VERSION, CORE_MAJOR_VERSION, CORE_MINOR_VERSION, CORE_MICRO_VERSION};
+  uint32_t       header[6]         = {};
+
+  bool valid = std::fread(header, sizeof(uint32_t), 6u, file) == 6u &&
+               std::equal(expectedHeader, expectedHeader + 5u, header) &&
+               header[5] <= MAXIMUM_ENTRY_COUNT;
+
+  const uint32_t count = valid ? header[5] : 0u;
+  entries.reserve(count);
+  for(uint32_t i = 0u; valid && i < count; ++i)
+  {
+    PersistentProgramCache::Entry entry;
+    uint64_t                      hash  = 0u;
+    uint32_t                      hints = 0u;
+
+    valid = Read(file, hash) && Read(file, hints) && Read(file, entry.renderPassTag) &&
+            Read(file, entry.name) && Read(file, entry.vertexSource) && Read(file, entry.fragmentSource);
+
+    // Drop the entries which do not match their sources, e.g. if the hash function changed.
+    entry.hash  = static_cast<std::size_t>(hash);
+    entry.hints = static_cast<Dali::Shader::Hint::Value>(hints);
+    if(valid && entry.hash == CalculateHash(std::string_view(entry.vertexSource), std::string_view(entry.fragmentSource)))
+    {
+      entries.push_back(std::move(entry));
+    }
+  }
+  std::fclose(file);
+
+  if(!valid)
+  {
+    DALI_LOG_ERROR("Program cache file is not valid: %s\n", filePath.c_str());
+    entries.clear();
+  }
+  return entries;
+}
+
+} // namespace
+
+PersistentProgramCache::PersistentProgramCache()
+: mPrewarmIndex(0u),
+  mModified(false)
+{
+}
+
+PersistentProgramCache::~PersistentProgramCache()
+{
+  CollectLoadedEntries(true);
+}
+
+void PersistentProgramCache::Load(const std::string& filePath)
+{
+  CollectLoadedEntries(true);
+
+  mFilePath   = filePath;
+  mLoadFuture = std::async(std::launch::async, ReadCacheFile, filePath);
+}
+
+ShaderDataPtr PersistentProgramCache::GetNextProgramToPrewarm()
+{
+  CollectLoadedEntries(false);
+
+  if(mPrewarmIndex >= mPrewarmQueue.size())
+  {
+    return nullptr;
+  }
+
+  const Entry&  entry      = mEntries[mPrewarmQueue[mPrewarmIndex++]];
+  ShaderDataPtr shaderData = new ShaderData(std::string_view(entry.vertexSource), std::string_view(entry.fragmentSource), entry.hints, entry.renderPassTag, entry.name);
+  shaderData->SetHashValue(entry.hash);
+
+  ++mStatistics.prewarmedCount;
+  return shaderData;
+}
+
+void PersistentProgramCache::AddProgram(const ShaderData& shaderData)
+{
+  ++mStatistics.missCount;
+
+  if(mFilePath.empty() || mEntries.size() >= MAXIMUM_ENTRY_COUNT || !mHashes.insert(shaderData.GetHashValue()).second)
+  {
+    return;
+  }
+
+  Entry entry;
+  entry.hash           = shaderData.GetHashValue();
+  entry.hints          = shaderData.GetHints();
+  entry.renderPassTag  = shaderData.GetRenderPassTag();
+  entry.name           = shaderData.GetName();
+  entry.vertexSource   = shaderData.GetVertexShader();
+  entry.fragmentSource = shaderData.GetFragmentShader();
+  mEntries.push_back(std::move(entry));
+
+  mModified = true;
+}
+
+bool PersistentProgramCache::Save()
+{
+  // The entries of the file must be kept, even if they were not read in time to be prewarmed.
+  CollectLoadedEntries(true);
+
+  if(!mModified || mFilePath.empty())
+  {
+    return !mFilePath.empty();
+  }
+
+  // Write to a temporary file first, so that a concurrent reader never sees a partial file.
+  const std::string temporaryPath = mFilePath + ".tmp";
+  FILE*             file          = OpenFile(temporaryPath, "wb");
+  if(!file)
+  {
+    DALI_LOG_ERROR("Failed to write program cache file: %s\n", temporaryPath.c_str());
+    return false;
+  }
+
+  const uint32_t header[6] = {FILE_MAGIC, FILE_FORMAT_VERSION, CORE_MAJOR_VERSION, CORE_MINOR_VERSION, CORE_MICRO_VERSION, static_cast<uint32_t>(mEntries.size())};
+  bool           written   = std::fwrite(header, sizeof(uint32_t), 6u, file) == 6u;
+  for(auto iter = mEntries.begin(); written && iter != mEntries.end(); ++iter)
+  {
+    written = Write(file, static_cast<uint64_t>(iter->hash)) && Write(file, static_cast<uint32_t>(iter->hints)) && Write(file, iter->renderPassTag) &&
+              Write(file, iter->name) && Write(file, iter->vertexSource) && Write(file, iter->fragmentSource);
+  }
+  written = (std::fclose(file) == 0) && written;
+
+  if(written && std::rename(temporaryPath.c_str(), mFilePath.c_str()) != 0)
+  {
+    // rename() does not replace an existing file on every platform
+    std::remove(mFilePath.c_str());
+    written = std::rename(temporaryPath.c_str(), mFilePath.c_str()) == 0;
+  }
+  if(!written)
+  {
+    DALI_LOG_ERROR("Failed to write program cache file: %s\n", mFilePath.c_str());
+    std::remove(temporaryPath.c_str());
+    return false;
+  }
+
+  mModified = false;
+  return true;
+}
+
+void PersistentProgramCache::CollectLoadedEntries(bool wait)
+{
+  if(!mLoadFuture.valid() ||
+     (!wait && mLoadFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+  {
+    return;
+  }
+
+  std::vector<Entry> loadedEntries = mLoadFuture.get();
+  mStatistics.loadedCount += static_cast<uint32_t>(loadedEntries.size());
+
+  for(auto&& entry : loadedEntries)
+  {
+    if(mEntries.size() < MAXIMUM_ENTRY_COUNT && mHashes.insert(entry.hash).second)
+    {
+      mPrewarmQueue.push_back(static_cast<uint32_t>(mEntries.size()));
+      mEntries.push_back(std::move(entry));
+    }
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
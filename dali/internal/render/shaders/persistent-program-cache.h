@@ -0,0 +1,149 @@
+#ifndef DALI_INTERNAL_PERSISTENT_PROGRAM_CACHE_H
+#define DALI_INTERNAL_PERSISTENT_PROGRAM_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <future>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/common/shader-data.h>
+
+namespace Dali
+{
+namespace Internal
+{
+/**
+ * Remembers the shaders of the programs created by the application, across launches.
+ *
+ * The file lists the sources of every program created during previous runs. It is read
+ * asynchronously, and the programs are handed back one by one so that they can be created
+ * before the first renderer asks for them. The compiled binaries themselves are cached by
+ * the graphics backend (see Dali::Shader::Hint::FILE_CACHE_SUPPORT).
+ *
+ * Apart from the file reading, this class is only used from the render thread.
+ */
+class PersistentProgramCache
+{
+public:
+  /**
+   * A program recorded in the file.
+   */
+  struct Entry
+  {
+    std::size_t               hash{0u}; ///< The hash of the vertex and fragment sources
+    Dali::Shader::Hint::Value hints{Dali::Shader::Hint::NONE};
+    uint32_t                  renderPassTag{0u};
+    std::string               name;
+    std::string               vertexSource;
+    std::string               fragmentSource;
+  };
+
+  /**
+   * Counters to measure the efficiency of the cache.
+   */
+  struct Statistics
+  {
+    uint32_t loadedCount{0u};    ///< Number of programs read from the file
+    uint32_t prewarmedCount{0u}; ///< Number of programs handed out to be created ahead of time
+    uint32_t hitCount{0u};       ///< Number of programs requested by renderers which had been prewarmed
+    uint32_t missCount{0u};      ///< Number of programs requested by renderers which had to be created on demand
+  };
+
+  /**
+   * Constructor
+   */
+  PersistentProgramCache();
+
+  /**
+   * Destructor, waits for the file to be read.
+   */
+  ~PersistentProgramCache();
+
+  PersistentProgramCache(const PersistentProgramCache&)            = delete;
+  PersistentProgramCache& operator=(const PersistentProgramCache&) = delete;
+
+public: // API
+  /**
+   * Starts reading the cache file in a separate thread. The file is also the one written by Save().
+   * A missing, truncated or outdated file is ignored.
+   * @param[in] filePath The path of the cache file
+   */
+  void Load(const std::string& filePath);
+
+  /**
+   * Retrieves the next program read from the file, without waiting for the file to be read.
+   * @return The shader data of the program, or nullptr if there is nothing (yet) to prewarm
+   */
+  ShaderDataPtr GetNextProgramToPrewarm();
+
+  /**
+   * Records a program created on demand, so that it is prewarmed on the next launch.
+   * @param[in] shaderData The shader data of the program
+   */
+  void AddProgram(const ShaderData& shaderData);
+
+  /**
+   * Notifies that a renderer used a prewarmed program.
+   */
+  void NotifyProgramHit()
+  {
+    ++mStatistics.hitCount;
+  }
+
+  /**
+   * Writes the cache file if new programs were recorded since it was read.
+   * @return True if the file is up to date
+   */
+  bool Save();
+
+  /**
+   * @return The counters of the cache
+   */
+  const Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
+private:
+  /**
+   * Takes the entries read from the file once they are available.
+   * @param[in] wait Whether to block until the file is read
+   */
+  void CollectLoadedEntries(bool wait);
+
+private:
+  std::string                     mFilePath;
+  std::future<std::vector<Entry>> mLoadFuture;   ///< Result of the file reading
+  std::vector<Entry>              mEntries;      ///< Every program known by the cache
+  std::unordered_set<std::size_t> mHashes;       ///< Hashes of mEntries
+  std::vector<uint32_t>           mPrewarmQueue; ///< Indices of mEntries which were read from the file
+  uint32_t                        mPrewarmIndex; ///< Next index of mPrewarmQueue to hand out
+  Statistics                      mStatistics;
+  bool                            mModified; ///< Whether the file needs to be written
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PERSISTENT_PROGRAM_CACHE_H
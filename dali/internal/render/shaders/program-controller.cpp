@@ -32,7 +32,9 @@ static_assert(1u <= MAXIMUM_COLLECTING_ITEM_COUNTS_PER_GC_CALL); /// Should dele
 } // namespace
 
 ProgramController::ProgramController()
-: mProgramCacheAdded(false)
+: mPersistentCache(nullptr),
+  mProgramCacheAdded(false),
+  mPrewarming(false)
 {
   mProgramCache.Reserve(32);
 
@@ -90,6 +92,15 @@ Program* ProgramController::GetProgram(size_t shaderHash)
     {
       (*iter)->MarkAsUsed();
       program = (*iter)->GetProgram();
+
+      if((*iter)->IsPrewarmed() && !mPrewarming)
+      {
+        (*iter)->SetPrewarmed(false);
+        if(mPersistentCache)
+        {
+          mPersistentCache->NotifyProgramHit();
+        }
+      }
       break;
     }
   }
@@ -100,9 +111,52 @@ void ProgramController::AddProgram(size_t shaderHash, Program* program)
 {
   // we expect unique hash values so it is caller's job to guarantee that
   // AddProgram is only called after program checks that GetProgram returns NULL
-  mProgramCache.PushBack(new ProgramPair(program, shaderHash));
+  auto* programPair = new ProgramPair(program, shaderHash);
+  mProgramCache.PushBack(programPair);
 
   mProgramCacheAdded = true;
+
+  if(mPrewarming)
+  {
+    programPair->SetPrewarmed(true);
+  }
+  else if(mPersistentCache && shaderHash == program->GetShaderData()->GetHashValue())
+  {
+    // Only the programs without shared uniform blocks can be recreated from the shader data alone.
+    mPersistentCache->AddProgram(*program->GetShaderData());
+  }
+}
+
+uint32_t ProgramController::Prewarm(Graphics::Controller& graphicsController, Render::UniformBufferManager& uniformBufferManager, uint32_t maximumCount)
+{
+  if(!mPersistentCache)
+  {
+    return 0u;
+  }
+
+  static const SceneGraph::Shader::UniformBlockContainer noSharedUniformBlocks;
+
+  uint32_t createdCount = 0u;
+  while(createdCount < maximumCount)
+  {
+    ShaderDataPtr shaderData = mPersistentCache->GetNextProgramToPrewarm();
+    if(!shaderData)
+    {
+      break;
+    }
+
+    mPrewarming      = true;
+    Program* program = Program::New(*this, shaderData, 0u, graphicsController);
+    mPrewarming      = false;
+
+    // The program already exists if a renderer requested it before the cache file was read.
+    if(!program->GetGraphicsProgramPtr())
+    {
+      program->CreateGraphicsProgram(uniformBufferManager, noSharedUniformBlocks);
+      ++createdCount;
+    }
+  }
+  return createdCount;
 }
 
 } // namespace Internal
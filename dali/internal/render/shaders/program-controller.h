@@ -22,6 +22,7 @@
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/graphics-api/graphics-controller.h>
 #include <dali/internal/common/shader-data.h>
+#include <dali/internal/render/shaders/persistent-program-cache.h>
 #include <dali/internal/render/shaders/program-cache.h>
 #include <dali/internal/render/shaders/program.h>
 
@@ -50,7 +51,8 @@ public:
     ProgramPair(Program* program, size_t shaderHash)
     : mProgram(program),
       mShaderHash(shaderHash),
-      mUsed{true} ///< Initialize as be used at construct time.
+      mUsed{true}, ///< Initialize as be used at construct time.
+      mPrewarmed{false}
     {
     }
 
@@ -95,6 +97,16 @@ public:
       mUsed = false;
     }
 
+    [[nodiscard]] inline bool IsPrewarmed() const
+    {
+      return mPrewarmed;
+    }
+
+    void SetPrewarmed(bool prewarmed)
+    {
+      mPrewarmed = prewarmed;
+    }
+
     ProgramPair(const ProgramPair&)            = delete;
     ProgramPair& operator=(const ProgramPair&) = delete;
 
@@ -102,6 +114,7 @@ public:
     Program* mProgram;
     size_t   mShaderHash;
     bool     mUsed : 1;
+    bool     mPrewarmed : 1; ///< Created from the persistent cache, and not requested by a renderer yet.
   };
 
   /**
@@ -151,6 +164,26 @@ public: // API
     return static_cast<uint32_t>(mProgramCache.Count());
   }
 
+  /**
+   * @brief Set the persistent cache which records the programs created on demand, and provides the programs to prewarm.
+   *
+   * @param[in] persistentCache The persistent cache, or nullptr to stop using it.
+   */
+  void SetPersistentCache(PersistentProgramCache* persistentCache)
+  {
+    mPersistentCache = persistentCache;
+  }
+
+  /**
+   * @brief Create the programs read from the persistent cache, before any renderer requests them.
+   *
+   * @param[in] graphicsController The graphics controller
+   * @param[in] uniformBufferManager The uniform buffer manager
+   * @param[in] maximumCount The maximum number of programs to create by this call
+   * @return The number of programs created.
+   */
+  uint32_t Prewarm(Graphics::Controller& graphicsController, Render::UniformBufferManager& uniformBufferManager, uint32_t maximumCount);
+
 private: // From ProgramCache
   /**
    * @copydoc ProgramCache::GetProgram
@@ -168,7 +201,11 @@ private: // Data
   ProgramContainer mProgramCache;
 
   ProgramIterator mClearCacheIterator;
-  bool            mProgramCacheAdded : 1;
+
+  PersistentProgramCache* mPersistentCache; ///< Not owned
+
+  bool mProgramCacheAdded : 1;
+  bool mPrewarming : 1; ///< True while a program is created by Prewarm()
 };
 
 } // namespace Internal
@@ -252,6 +252,46 @@ void Program::SetGraphicsProgram(
   BuildRequirements(mGfxController.GetProgramReflection(*mGfxProgram.get()), uniformBufferManager, sharedUniformBlockContainer);
 }
 
+void Program::CreateGraphicsProgram(
+  Render::UniformBufferManager&                    uniformBufferManager,
+  const SceneGraph::Shader::UniformBlockContainer& sharedUniformBlockContainer)
+{
+  Graphics::ShaderCreateInfo vertexShaderCreateInfo;
+  vertexShaderCreateInfo.SetPipelineStage(Graphics::PipelineStage::VERTEX_SHADER);
+  vertexShaderCreateInfo.SetSourceMode(Graphics::ShaderSourceMode::TEXT);
+  const std::vector<char>& vertexShaderSrc = mProgramData->GetShaderForPipelineStage(Graphics::PipelineStage::VERTEX_SHADER);
+  vertexShaderCreateInfo.SetSourceSize(static_cast<uint32_t>(vertexShaderSrc.size()));
+  vertexShaderCreateInfo.SetSourceData(static_cast<const void*>(vertexShaderSrc.data()));
+  vertexShaderCreateInfo.SetShaderVersion(mProgramData->GetVertexShaderVersion());
+  auto vertexShader = mGfxController.CreateShader(vertexShaderCreateInfo, nullptr);
+
+  Graphics::ShaderCreateInfo fragmentShaderCreateInfo;
+  fragmentShaderCreateInfo.SetPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER);
+  fragmentShaderCreateInfo.SetSourceMode(Graphics::ShaderSourceMode::TEXT);
+  const std::vector<char>& fragmentShaderSrc = mProgramData->GetShaderForPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER);
+  fragmentShaderCreateInfo.SetSourceSize(static_cast<uint32_t>(fragmentShaderSrc.size()));
+  fragmentShaderCreateInfo.SetSourceData(static_cast<const void*>(fragmentShaderSrc.data()));
+  fragmentShaderCreateInfo.SetShaderVersion(mProgramData->GetFragmentShaderVersion());
+  auto fragmentShader = mGfxController.CreateShader(fragmentShaderCreateInfo, nullptr);
+
+  std::vector<Graphics::ShaderState> shaderStates{
+    Graphics::ShaderState()
+      .SetShader(*vertexShader.get())
+      .SetPipelineStage(Graphics::PipelineStage::VERTEX_SHADER),
+    Graphics::ShaderState()
+      .SetShader(*fragmentShader.get())
+      .SetPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER)};
+
+  auto createInfo = Graphics::ProgramCreateInfo();
+  createInfo.SetShaderState(shaderStates);
+  createInfo.SetName(mProgramData->GetName());
+  createInfo.SetFileCaching(mProgramData->GetHints() & Dali::Shader::Hint::Value::FILE_CACHE_SUPPORT);
+  createInfo.SetInternal(mProgramData->GetHints() & Dali::Shader::Hint::Value::INTERNAL);
+  auto graphicsProgram = mGfxController.CreateProgram(createInfo, nullptr);
+
+  SetGraphicsProgram(std::move(graphicsProgram), uniformBufferManager, sharedUniformBlockContainer);
+}
+
 bool Program::GetUniform(const std::string_view& name, Hash hashedName, Hash hashedNameNoArray, Graphics::UniformInfo& out) const
 {
   if(mReflection.empty())
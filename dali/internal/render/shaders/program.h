@@ -133,6 +133,13 @@ public:
    */
   void SetGraphicsProgram(Graphics::UniquePtr<Graphics::Program>&& program, Render::UniformBufferManager& uniformBufferManager, const SceneGraph::Shader::UniformBlockContainer& sharedUniformBlockContainer);
 
+  /**
+   * Creates the actual program from the shader data, and ensure that it's reflection is generated.
+   * @param[in] uniformBufferManager The uniform buffer manager
+   * @param[in] sharedUniformBlockContainer The shared uniform blocks connected to the shader
+   */
+  void CreateGraphicsProgram(Render::UniformBufferManager& uniformBufferManager, const SceneGraph::Shader::UniformBlockContainer& sharedUniformBlockContainer);
+
   /**
    * Retrieves uniform data.
    * The lookup tries to minimise string comparisons. Ideally, when the hashedName is known
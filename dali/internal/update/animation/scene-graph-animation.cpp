@@ -26,6 +26,7 @@
 #include <dali/integration-api/trace.h>
 #include <dali/internal/common/memory-pool-object-allocator.h>
 #include <dali/internal/render/common/performance-monitor.h>
+#include <dali/internal/update/animation/scene-graph-animator-scheduler.h>
 #include <dali/internal/update/common/scene-graph-memory-pool-collection.h>
 #include <dali/public-api/math/math-utils.h>
 
@@ -290,7 +291,7 @@ void Animation::Bake(EndAction action)
     }
   }
 
-  UpdateAnimators(true /*bake the final result*/, true /*animation finished*/);
+  UpdateAnimators(true /*bake the final result*/, true /*animation finished*/, nullptr);
 }
 
 void Animation::SetAnimatorsActive(bool active)
@@ -398,7 +399,7 @@ void Animation::AddAnimator(OwnerPointer<AnimatorBase>& animator)
   mAnimators.PushBack(animator.Release());
 }
 
-void Animation::Update(float elapsedSeconds, bool& stopped, bool& finished, bool& progressReached)
+void Animation::Update(float elapsedSeconds, bool& stopped, bool& finished, bool& progressReached, AnimatorScheduler* animatorScheduler)
 {
   // Reset mIsStopped flag now.
   stopped    = mIsStopped;
@@ -480,7 +481,7 @@ void Animation::Update(float elapsedSeconds, bool& stopped, bool& finished, bool
 
           // Make elapsed second as edge of range forcely.
           mElapsedSeconds = edgeRangeSeconds + signSpeedFactor * Math::MACHINE_EPSILON_10;
-          UpdateAnimators(finished && (mEndAction != Dali::Animation::DISCARD), finished);
+          UpdateAnimators(finished && (mEndAction != Dali::Animation::DISCARD), finished, animatorScheduler);
 
           // After update animation, mElapsedSeconds must be begin of value
           mElapsedSeconds = playRangeStartSeconds + playRangeEndSeconds - edgeRangeSeconds;
@@ -523,11 +524,11 @@ void Animation::Update(float elapsedSeconds, bool& stopped, bool& finished, bool
   // Already updated when finished. So skip.
   if(!finished)
   {
-    UpdateAnimators(false, false);
+    UpdateAnimators(false, false, animatorScheduler);
   }
 }
 
-void Animation::UpdateAnimators(bool bake, bool animationFinished)
+void Animation::UpdateAnimators(bool bake, bool animationFinished, AnimatorScheduler* animatorScheduler)
 {
   mIsActive = false;
 
@@ -571,7 +572,14 @@ void Animation::UpdateAnimators(bool bake, bool animationFinished)
             progress = 2.0f * std::abs(progress - 0.5f);
           }
         }
-        animator->Update(progress, mIsFirstLoop ? mBlendPoint : 0.0f, bake);
+        if(animatorScheduler)
+        {
+          animatorScheduler->Add(*animator, progress, mIsFirstLoop ? mBlendPoint : 0.0f, bake);
+        }
+        else
+        {
+          animator->Update(progress, mIsFirstLoop ? mBlendPoint : 0.0f, bake);
+        }
 
         if(animatorDuration > 0.0f && (elapsedSecondsClamped - intervalDelay) <= animatorDuration)
         {
@@ -32,6 +32,7 @@ namespace Internal
 {
 namespace SceneGraph
 {
+class AnimatorScheduler;
 class MemoryPoolCollection;
 /**
  * Animations are used to change the properties of scene graph objects, as part of a scene
@@ -312,8 +313,9 @@ public:
    * @param[out] stopped True if the animation stopped this loop
    * @param[out] finished True if the animation has finished.
    * @param[out] progressReached True if progress marker reached
+   * @param[in] animatorScheduler If not nullptr, the animators are added to it rather than updated at once.
    */
-  void Update(float elapsedSeconds, bool& stopped, bool& finished, bool& progressReached);
+  void Update(float elapsedSeconds, bool& stopped, bool& finished, bool& progressReached, AnimatorScheduler* animatorScheduler);
 
 protected:
   /**
@@ -326,8 +328,9 @@ private:
    * Helper for Update, also used to bake when the animation is stopped or destroyed.
    * @param[in] bake True if the final result should be baked.
    * @param[in] animationFinished True if the animation has finished.
+   * @param[in] animatorScheduler If not nullptr, the animators are added to it rather than updated at once.
    */
-  void UpdateAnimators(bool bake, bool animationFinished);
+  void UpdateAnimators(bool bake, bool animationFinished, AnimatorScheduler* animatorScheduler);
 
   /**
    * Helper function to bake the result of the animation when it is stopped or
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-animator-scheduler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/integration-api/trace.h>
+#include <dali/internal/common/environment-variable.h>
+#include <dali/internal/update/animation/scene-graph-animator.h>
+#include <dali/internal/update/animation/scene-graph-batch-scheduling.h>
+
+namespace Dali::Internal::SceneGraph
+{
+namespace
+{
+DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_UPDATE_PROCESS, false);
+
+constexpr const char* PARALLEL_ANIMATOR_MINIMUM_COUNT_ENV = "DALI_PARALLEL_ANIMATOR_MINIMUM_COUNT"; ///< With this number of animator updates or more, they are evaluated in parallel. 0 or unset disables it.
+
+constexpr uint32_t MINIMUM_ANIMATORS_PER_TASK = 16u; ///< Batches with fewer animators than this per thread are evaluated by the calling thread.
+
+uint32_t GetParallelAnimatorMinimumCount()
+{
+  return EnvironmentVariable::GetUnsignedIntegerValue(PARALLEL_ANIMATOR_MINIMUM_COUNT_ENV, 0u);
+}
+} // namespace
+
+AnimatorScheduler::AnimatorScheduler()
+: mThreadPool(nullptr),
+  mMinimumAnimatorCount(GetParallelAnimatorMinimumCount())
+{
+}
+
+AnimatorScheduler::~AnimatorScheduler() = default;
+
+void AnimatorScheduler::SetThreadPool(Dali::ThreadPool* threadPool)
+{
+  mThreadPool = (threadPool && threadPool->GetWorkerCount() > 0u) ? threadPool : nullptr;
+}
+
+void AnimatorScheduler::SetMinimumAnimatorCount(uint32_t animatorCount)
+{
+  mMinimumAnimatorCount = animatorCount;
+}
+
+void AnimatorScheduler::Add(AnimatorBase& animator, float progress, float blendPoint, bool bake)
+{
+  mItems.push_back({&animator, progress, blendPoint, bake});
+}
+
+void AnimatorScheduler::Apply()
+{
+  if(IsEnabled() && mItems.size() >= mMinimumAnimatorCount)
+  {
+    DALI_TRACE_SCOPE(gTraceFilter, "DALI_ANIMATION_PARALLEL");
+
+    Schedule();
+
+    const uint32_t batchCount = static_cast<uint32_t>(mBatchOffsets.size()) - 1u;
+    for(uint32_t batch = 0u; batch < batchCount; ++batch)
+    {
+      const uint32_t begin = mBatchOffsets[batch];
+      const uint32_t end   = mBatchOffsets[batch + 1u];
+
+      Evaluate(begin, end);
+
+      // The next batch reads the values written here
+      for(uint32_t position = begin; position < end; ++position)
+      {
+        const Item& item = mItems[mOrder[position]];
+        item.animator->Commit(item.progress, item.bake);
+      }
+    }
+  }
+  else
+  {
+    for(auto&& item : mItems)
+    {
+      item.animator->Update(item.progress, item.blendPoint, item.bake);
+    }
+  }
+
+  mItems.clear();
+}
+
+void AnimatorScheduler::Schedule()
+{
+  const uint32_t count = static_cast<uint32_t>(mItems.size());
+
+  mBatches.resize(count);
+  mAnimatorCounts.clear();
+
+  // The n-th animator of a property reads the value written by the previous one
+  uint32_t batchCount = 0u;
+  for(uint32_t index = 0u; index < count; ++index)
+  {
+    const uint32_t batch = mAnimatorCounts[mItems[index].animator->GetTargetProperty()]++;
+
+    mBatches[index] = batch;
+    batchCount      = std::max(batchCount, batch + 1u);
+  }
+
+  // Sort the items by batch, keeping the application order within a batch
+  SortByBatch(mBatches, batchCount, mOrder, mBatchOffsets);
+}
+
+void AnimatorScheduler::Evaluate(uint32_t begin, uint32_t end)
+{
+  auto evaluate = [this](uint32_t taskBegin, uint32_t taskEnd)
+  {
+    for(uint32_t position = taskBegin; position < taskEnd; ++position)
+    {
+      const Item& item = mItems[mOrder[position]];
+      item.animator->Evaluate(item.progress, item.blendPoint);
+    }
+  };
+
+  ParallelFor(*mThreadPool, begin, end, MINIMUM_ANIMATORS_PER_TASK, evaluate);
+}
+
+} // namespace Dali::Internal::SceneGraph
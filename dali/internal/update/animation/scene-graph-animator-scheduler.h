@@ -0,0 +1,137 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_SCHEDULER_H
+#define DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_SCHEDULER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+class ThreadPool;
+
+namespace Internal
+{
+namespace SceneGraph
+{
+class AnimatorBase;
+class PropertyBase;
+
+/**
+ * Updates the animators of all the animations, evaluating the animators of different properties on worker threads.
+ *
+ * The animations add the updates of their animators, in the order they would have applied them. The updates are then
+ * split into batches, so that a batch animates each property once at most: the n-th animator of a property belongs to
+ * the n-th batch. The animators of a batch only read their own property, so they are evaluated concurrently, then the
+ * values are written by the calling thread in the order of addition; the results match AnimatorBase::Update().
+ *
+ * @note The animator and alpha functions must be thread-safe to enable it, so it is only used when
+ * DALI_PARALLEL_ANIMATOR_MINIMUM_COUNT is set and the update has worker threads.
+ */
+class AnimatorScheduler
+{
+public:
+  /**
+   * Constructor. The minimum animator count is read from the environment.
+   */
+  AnimatorScheduler();
+
+  /**
+   * Destructor.
+   */
+  ~AnimatorScheduler();
+
+  /**
+   * Sets the thread pool used to evaluate the animators.
+   * @param[in] threadPool The thread pool, or nullptr to update every animator serially
+   */
+  void SetThreadPool(Dali::ThreadPool* threadPool);
+
+  /**
+   * Sets the minimum number of animator updates required to use the worker threads.
+   * @param[in] animatorCount The number of animators, or 0 to update every animator serially
+   */
+  void SetMinimumAnimatorCount(uint32_t animatorCount);
+
+  /**
+   * Query whether the animators may be updated in parallel.
+   * @return True if it is worth adding the animator updates
+   */
+  bool IsEnabled() const
+  {
+    return mThreadPool && mMinimumAnimatorCount > 0u;
+  }
+
+  /**
+   * Adds the update of an animator, after the previously added ones; see AnimatorBase::Update().
+   * @param[in] animator The animator, which must not be orphan
+   * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
+   * @param[in] blendPoint A value between [0,1], The Animated property is animated as it blends until the progress reaches the blendPoint.
+   * @param[in] bake Bake.
+   */
+  void Add(AnimatorBase& animator, float progress, float blendPoint, bool bake);
+
+  /**
+   * Updates the added animators, then forgets them.
+   */
+  void Apply();
+
+private:
+  /**
+   * The parameters of an animator update.
+   */
+  struct Item
+  {
+    AnimatorBase* animator;
+    float         progress;
+    float         blendPoint;
+    bool          bake;
+  };
+
+  /**
+   * Assigns each animator update to a batch.
+   */
+  void Schedule();
+
+  /**
+   * Evaluates the animators of a batch on the worker threads and the calling thread.
+   * @param[in] begin The first position in mOrder
+   * @param[in] end The position after the last one
+   */
+  void Evaluate(uint32_t begin, uint32_t end);
+
+  std::vector<Item>     mItems;        ///< The animator updates, in application order
+  std::vector<uint32_t> mBatches;      ///< The batch of each item
+  std::vector<uint32_t> mOrder;        ///< The items sorted by batch, then by application order
+  std::vector<uint32_t> mBatchOffsets; ///< The start of each batch in mOrder, terminated by the item count
+
+  std::unordered_map<const PropertyBase*, uint32_t> mAnimatorCounts; ///< The number of animators of each property; scratch data of Schedule()
+
+  Dali::ThreadPool* mThreadPool;           ///< The worker threads, not owned
+  uint32_t          mMinimumAnimatorCount; ///< Below this number of animator updates, they are applied serially
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_SCHEDULER_H
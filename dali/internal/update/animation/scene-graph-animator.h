@@ -75,11 +75,13 @@ public:
   /**
    * Constructor.
    */
-  AnimatorBase(PropertyOwner*    propertyOwner,
-               AlphaFunction     alphaFunction,
-               const TimePeriod& timePeriod)
+  AnimatorBase(PropertyOwner*      propertyOwner,
+               const PropertyBase* property,
+               AlphaFunction       alphaFunction,
+               const TimePeriod&   timePeriod)
   : mLifecycleObserver(nullptr),
     mPropertyOwner(propertyOwner),
+    mTargetProperty(property),
     mDurationSeconds(timePeriod.durationSeconds),
     mIntervalDelaySeconds(timePeriod.delaySeconds),
     mCurrentProgress(0.f),
@@ -453,6 +455,15 @@ public:
     return (mPropertyOwner == nullptr);
   }
 
+  /**
+   * Retrieve the animated property.
+   * @return The property, which is only valid while the animator is not orphan
+   */
+  const PropertyBase* GetTargetProperty() const
+  {
+    return mTargetProperty;
+  }
+
   /**
    * Update the scene object attached to the animator.
    * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
@@ -460,28 +471,56 @@ public:
    * @param[in] bake Bake.
    */
   void Update(float progress, float blendPoint, bool bake)
+  {
+    Evaluate(progress, blendPoint);
+    Commit(progress, bake);
+  }
+
+  /**
+   * First part of Update(): computes the value of the property, without changing the scene object.
+   * Only the animated property is read, so animators of different properties may be evaluated concurrently.
+   * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
+   * @param[in] blendPoint A value between [0,1], The Animated property is animated as it blends until the progress reaches the blendPoint.
+   */
+  void Evaluate(float progress, float blendPoint)
+  {
+    float alpha = ApplyAlphaFunction(progress);
+
+    // PropertyType specific part
+    DoEvaluate(alpha, blendPoint);
+  }
+
+  /**
+   * Second part of Update(): writes the value computed by Evaluate() to the property.
+   * @param[in] progress The progress given to Evaluate().
+   * @param[in] bake Bake.
+   */
+  void Commit(float progress, bool bake)
   {
     if(mPropertyOwner)
     {
       mPropertyOwner->SetUpdated(true);
     }
 
-    float alpha = ApplyAlphaFunction(progress);
-
     // PropertyType specific part
-    DoUpdate(bake, alpha, blendPoint);
+    DoCommit(bake);
 
     mCurrentProgress = progress;
     mDelayed         = false;
   }
 
   /**
-   * Type specific part of the animator
-   * @param bake whether to bake or not
+   * Type specific part of Evaluate()
    * @param alpha value from alpha based on progress
    * @param blendPoint A value between [0,1], The Animated property is animated as it blends until the progress reaches the blendPoint.
    */
-  virtual void DoUpdate(bool bake, float alpha, float blendPoint) = 0;
+  virtual void DoEvaluate(float alpha, float blendPoint) = 0;
+
+  /**
+   * Type specific part of Commit()
+   * @param bake whether to bake or not
+   */
+  virtual void DoCommit(bool bake) = 0;
 
 protected:
   /**
@@ -497,8 +536,9 @@ protected:
     return 3.0f * (1.0f - t) * (1.0f - t) * t * p0 + 3.0f * (1.0f - t) * tSquare * p1 + tSquare * t;
   }
 
-  LifecycleObserver* mLifecycleObserver;
-  PropertyOwner*     mPropertyOwner;
+  LifecycleObserver*  mLifecycleObserver;
+  PropertyOwner*      mPropertyOwner;
+  const PropertyBase* mTargetProperty;
 
   float mDurationSeconds;
   float mIntervalDelaySeconds;
@@ -547,22 +587,28 @@ public:
   }
 
   /**
-   * @copydoc AnimatorBase::DoUpdate(bool bake, float alpha )
+   * @copydoc AnimatorBase::DoEvaluate(float alpha, float blendPoint)
    */
-  void DoUpdate(bool bake, float alpha, float blendPoint) final
+  void DoEvaluate(float alpha, float blendPoint) final
   {
     const PropertyType& current = mPropertyAccessor.Get();
 
     // need to cast the return value in case property is integer
-    const PropertyType result = static_cast<PropertyType>(mAnimatorFunction(alpha, blendPoint, current));
+    mResult = static_cast<PropertyType>(mAnimatorFunction(alpha, blendPoint, current));
+  }
 
+  /**
+   * @copydoc AnimatorBase::DoCommit(bool bake)
+   */
+  void DoCommit(bool bake) final
+  {
     if(bake)
     {
-      mPropertyAccessor.Bake(result);
+      mPropertyAccessor.Bake(mResult);
     }
     else
     {
-      mPropertyAccessor.Set(result);
+      mPropertyAccessor.Set(mResult);
     }
   }
 
@@ -575,9 +621,10 @@ private:
            AnimatorFunction  animatorFunction,
            AlphaFunction     alphaFunction,
            const TimePeriod& timePeriod)
-  : AnimatorBase(propertyOwner, alphaFunction, timePeriod),
+  : AnimatorBase(propertyOwner, property, alphaFunction, timePeriod),
     mAnimatorFunction(std::move(animatorFunction)),
-    mPropertyAccessor(property)
+    mPropertyAccessor(property),
+    mResult()
   {
     // WARNING - this object is created in the event-thread
     // The scene-graph mPropertyOwner object cannot be observed here
@@ -591,6 +638,7 @@ private:
 
 protected:
   PropertyAccessorType mPropertyAccessor;
+  PropertyType         mResult; ///< The value computed by DoEvaluate()
 };
 
 /**
@@ -627,22 +675,28 @@ public:
   }
 
   /**
-   * @copydoc AnimatorBase::DoUpdate(bool bake, float alpha )
+   * @copydoc AnimatorBase::DoEvaluate(float alpha, float blendPoint)
    */
-  void DoUpdate(bool bake, float alpha, float blendPoint) final
+  void DoEvaluate(float alpha, float blendPoint) final
   {
     const PropertyType& current = mPropertyAccessor.Get();
 
     // need to cast the return value in case property is integer
-    const PropertyType result = static_cast<PropertyType>(mAnimatorFunction(alpha, blendPoint, current));
+    mResult = static_cast<PropertyType>(mAnimatorFunction(alpha, blendPoint, current));
+  }
 
+  /**
+   * @copydoc AnimatorBase::DoCommit(bool bake)
+   */
+  void DoCommit(bool bake) final
+  {
     if(bake)
     {
-      mPropertyAccessor.Bake(result);
+      mPropertyAccessor.Bake(mResult);
     }
     else
     {
-      mPropertyAccessor.Set(result);
+      mPropertyAccessor.Set(mResult);
     }
   }
 
@@ -655,9 +709,10 @@ private:
                             AnimatorFunction  animatorFunction,
                             AlphaFunction     alphaFunction,
                             const TimePeriod& timePeriod)
-  : AnimatorBase(propertyOwner, alphaFunction, timePeriod),
+  : AnimatorBase(propertyOwner, property, alphaFunction, timePeriod),
     mAnimatorFunction(std::move(animatorFunction)),
-    mPropertyAccessor(property)
+    mPropertyAccessor(property),
+    mResult()
   {
     // WARNING - this object is created in the event-thread
     // The scene-graph mPropertyOwner object cannot be observed here
@@ -670,6 +725,7 @@ private:
 
 protected:
   PropertyAccessorType mPropertyAccessor;
+  PropertyType         mResult; ///< The value computed by DoEvaluate()
 };
 
 } // namespace SceneGraph
@@ -958,6 +1014,7 @@ struct KeyFrameIntegerFunctor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    mKeyFrames.PrepareInterpolation(interpolation);
   }
 
   int32_t operator()(float progress, float blendPoint, const int32_t& property)
@@ -989,6 +1046,7 @@ struct KeyFrameNumberFunctor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    mKeyFrames.PrepareInterpolation(interpolation);
   }
 
   float operator()(float progress, float blendPoint, const float& property)
@@ -1020,6 +1078,7 @@ struct KeyFrameVector2Functor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    mKeyFrames.PrepareInterpolation(interpolation);
   }
 
   Vector2 operator()(float progress, float blendPoint, const Vector2& property)
@@ -1051,6 +1110,7 @@ struct KeyFrameVector3Functor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    mKeyFrames.PrepareInterpolation(interpolation);
   }
 
   Vector3 operator()(float progress, float blendPoint, const Vector3& property)
@@ -1082,6 +1142,7 @@ struct KeyFrameVector4Functor
   : mKeyFrames(std::move(keyFrames)),
     mInterpolation(interpolation)
   {
+    mKeyFrames.PrepareInterpolation(interpolation);
   }
 
   Vector4 operator()(float progress, float blendPoint, const Vector4& property)
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-batch-scheduling.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/render/common/performance-monitor.h>
+
+namespace Dali::Internal::SceneGraph
+{
+void SortByBatch(const std::vector<uint32_t>& batches, uint32_t batchCount, std::vector<uint32_t>& order, std::vector<uint32_t>& batchOffsets)
+{
+  const uint32_t count = static_cast<uint32_t>(batches.size());
+
+  batchOffsets.assign(batchCount + 1u, 0u);
+  for(uint32_t index = 0u; index < count; ++index)
+  {
+    ++batchOffsets[batches[index] + 1u];
+  }
+  for(uint32_t batch = 0u; batch < batchCount; ++batch)
+  {
+    batchOffsets[batch + 1u] += batchOffsets[batch];
+  }
+
+  order.resize(count);
+  for(uint32_t index = 0u; index < count; ++index)
+  {
+    order[batchOffsets[batches[index]]++] = index;
+  }
+
+  // Restore the offsets, which have been advanced to the end of each batch
+  for(uint32_t batch = batchCount; batch > 0u; --batch)
+  {
+    batchOffsets[batch] = batchOffsets[batch - 1u];
+  }
+  batchOffsets[0] = 0u;
+}
+
+void ParallelFor(Dali::ThreadPool& threadPool, uint32_t begin, uint32_t end, uint32_t minimumCountPerTask, const std::function<void(uint32_t, uint32_t)>& function)
+{
+  const uint32_t count       = end - begin;
+  const uint32_t workerCount = static_cast<uint32_t>(threadPool.GetWorkerCount());
+  const uint32_t taskCount   = std::min(workerCount + 1u, count / minimumCountPerTask);
+
+  if(taskCount <= 1u)
+  {
+    function(begin, end);
+    return;
+  }
+
+  const uint32_t countPerTask = (count + taskCount - 1u) / taskCount;
+
+  // The calling thread takes the first chunk, the workers take the rest.
+  std::vector<SharedFuture> futures;
+  futures.reserve(taskCount - 1u);
+  for(uint32_t task = 1u; task < taskCount; ++task)
+  {
+    const uint32_t taskBegin = begin + task * countPerTask;
+    const uint32_t taskEnd   = std::min(end, taskBegin + countPerTask);
+    if(taskBegin < taskEnd)
+    {
+      futures.push_back(threadPool.SubmitTask(task - 1u, [&function, taskBegin, taskEnd](uint32_t)
+                                              {
+        function(taskBegin, taskEnd);
+        PERF_MONITOR_FLUSH_WORKER(); }));
+    }
+  }
+
+  function(begin, std::min(end, begin + countPerTask));
+
+  for(auto& future : futures)
+  {
+    future->Wait();
+  }
+}
+
+} // namespace Dali::Internal::SceneGraph
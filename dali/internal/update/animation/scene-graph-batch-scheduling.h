@@ -0,0 +1,60 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_BATCH_SCHEDULING_H
+#define DALI_INTERNAL_SCENE_GRAPH_BATCH_SCHEDULING_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Dali
+{
+class ThreadPool;
+
+namespace Internal
+{
+namespace SceneGraph
+{
+/**
+ * Sorts the items by batch, keeping the order of addition within a batch.
+ * @param[in] batches The batch of each item
+ * @param[in] batchCount The number of batches
+ * @param[out] order The indices of the items, sorted by batch
+ * @param[out] batchOffsets The start of each batch in order, terminated by the item count
+ */
+void SortByBatch(const std::vector<uint32_t>& batches, uint32_t batchCount, std::vector<uint32_t>& order, std::vector<uint32_t>& batchOffsets);
+
+/**
+ * Splits a range of positions into chunks, processed concurrently by the calling thread and the worker threads.
+ * The calling thread takes the first chunk, and waits for the workers before returning.
+ * @param[in] threadPool The worker threads
+ * @param[in] begin The first position
+ * @param[in] end The position after the last one
+ * @param[in] minimumCountPerTask Ranges with fewer positions than this per thread are processed by the calling thread alone
+ * @param[in] function Called with the first position and the position after the last one of each chunk
+ */
+void ParallelFor(Dali::ThreadPool& threadPool, uint32_t begin, uint32_t end, uint32_t minimumCountPerTask, const std::function<void(uint32_t, uint32_t)>& function);
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_BATCH_SCHEDULING_H
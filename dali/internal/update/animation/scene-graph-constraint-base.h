@@ -169,7 +169,36 @@ public:
   /**
    * Constrain the associated scene object.
    */
-  virtual void Apply() = 0;
+  void Apply()
+  {
+    Commit(Evaluate());
+  }
+
+  /**
+   * Computes the constrained value, without writing it to the target property.
+   * @note This may be called from a worker thread, if no other thread writes the inputs or the target meanwhile.
+   * @return True if a value has been computed, which Commit() must write
+   */
+  virtual bool Evaluate() = 0;
+
+  /**
+   * Writes the value computed by Evaluate() to the target property.
+   * @param[in] evaluated The result of Evaluate()
+   */
+  virtual void Commit(bool evaluated) = 0;
+
+  /**
+   * Retrieve the property written by the constraint.
+   * @return The target property, or nullptr if the constraint is disconnected
+   */
+  virtual const PropertyInputImpl* GetTargetProperty() const = 0;
+
+  /**
+   * Retrieve an input read by the constraint function.
+   * @param[in] index The index of the input
+   * @return The input, or nullptr if the index is out of range or the constraint is disconnected
+   */
+  virtual const PropertyInputImpl* GetInput(uint32_t index) const = 0;
 
   /**
    * Helper for internal test cases; only available for debug builds.
@@ -95,29 +95,29 @@ void ConstraintContainer::Apply()
     return;
   }
 
-  static std::vector<ConstraintIter> deactivatedIters;
   for(ConstraintIter iter = mActiveConstraints.Begin(), endIter = mActiveConstraints.End(); iter != endIter; ++iter)
   {
     ConstraintBase& constraint = **iter;
     DALI_LOG_CONSTRAINT_INFO("[%p] Apply SG[%p](r:%d, c:%d).\n", this, &constraint, constraint.GetApplyRate(), constraint.GetAppliedCount());
     constraint.Apply();
+  }
+
+  DeactivateAppliedConstraints();
+}
 
+void ConstraintContainer::DeactivateAppliedConstraints()
+{
+  // Release from the back, so that the remaining iterators stay valid.
+  for(ConstraintIter iter = mActiveConstraints.End(); iter != mActiveConstraints.Begin();)
+  {
+    --iter;
+    ConstraintBase& constraint = **iter;
     if(constraint.GetApplyRate() == Dali::Constraint::ApplyRate::APPLY_ONCE && constraint.GetAppliedCount() > 0u)
     {
-      deactivatedIters.push_back(iter);
+      mDeactiveConstraints.PushBack(mActiveConstraints.Release(iter));
     }
   }
 
-  DALI_LOG_CONSTRAINT_INFO("[%p] Apply act[%zu] deact[%zu] deact now[%zu]\n", this, mActiveConstraints.Count(), mDeactiveConstraints.Count(), deactivatedIters.size());
-
-  // FILO ordered iterator release.
-  // Since OwnerContainer is linear container, we could keep iter.
-  while(!deactivatedIters.empty())
-  {
-    auto iter = deactivatedIters.back();
-    deactivatedIters.pop_back();
-
-    mDeactiveConstraints.PushBack(mActiveConstraints.Release(iter));
-  }
+  DALI_LOG_CONSTRAINT_INFO("[%p] Deactivate act[%zu] deact[%zu]\n", this, mActiveConstraints.Count(), mDeactiveConstraints.Count());
 }
 } // namespace Dali::Internal::SceneGraph
@@ -57,8 +57,19 @@ public:
     return static_cast<uint32_t>(mActiveConstraints.Count());
   }
 
+  ConstraintBase* GetActiveConstraint(uint32_t index) const
+  {
+    return mActiveConstraints[index];
+  }
+
   void Apply();
 
+  /**
+   * Moves the APPLY_ONCE constraints which have been applied to the deactivated list.
+   * Apply() calls it; it must be called after applying the active constraints by other means.
+   */
+  void DeactivateAppliedConstraints();
+
 private:
   ConstraintContainer(const ConstraintContainer&)            = delete;
   ConstraintContainer& operator=(const ConstraintContainer&) = delete;
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-constraint-scheduler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/integration-api/trace.h>
+#include <dali/internal/common/environment-variable.h>
+#include <dali/internal/event/common/property-input-impl.h>
+#include <dali/internal/update/animation/scene-graph-batch-scheduling.h>
+#include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/animation/scene-graph-constraint-container.h>
+
+namespace Dali::Internal::SceneGraph
+{
+namespace
+{
+DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_UPDATE_PROCESS, false);
+
+constexpr const char* PARALLEL_CONSTRAINT_MINIMUM_COUNT_ENV = "DALI_PARALLEL_CONSTRAINT_MINIMUM_COUNT"; ///< With this number of active constraints or more, they are evaluated in parallel. 0 or unset disables it.
+
+constexpr uint32_t MINIMUM_CONSTRAINTS_PER_TASK = 8u; ///< Batches with fewer constraints than this per thread are evaluated by the calling thread.
+
+uint32_t GetParallelConstraintMinimumCount()
+{
+  return EnvironmentVariable::GetUnsignedIntegerValue(PARALLEL_CONSTRAINT_MINIMUM_COUNT_ENV, 0u);
+}
+} // namespace
+
+ConstraintScheduler::ConstraintScheduler()
+: mThreadPool(nullptr),
+  mMinimumConstraintCount(GetParallelConstraintMinimumCount())
+{
+}
+
+ConstraintScheduler::~ConstraintScheduler() = default;
+
+void ConstraintScheduler::SetThreadPool(Dali::ThreadPool* threadPool)
+{
+  mThreadPool = (threadPool && threadPool->GetWorkerCount() > 0u) ? threadPool : nullptr;
+}
+
+void ConstraintScheduler::SetMinimumConstraintCount(uint32_t constraintCount)
+{
+  mMinimumConstraintCount = constraintCount;
+}
+
+void ConstraintScheduler::Add(ConstraintContainer& constraints)
+{
+  const uint32_t count = constraints.ActivateCount();
+  if(count > 0u)
+  {
+    for(uint32_t index = 0u; index < count; ++index)
+    {
+      mConstraints.push_back(constraints.GetActiveConstraint(index));
+    }
+    mContainers.push_back(&constraints);
+  }
+}
+
+bool ConstraintScheduler::Apply()
+{
+  bool applied = false;
+
+  if(IsEnabled() && mConstraints.size() >= mMinimumConstraintCount && Schedule())
+  {
+    DALI_TRACE_SCOPE(gTraceFilter, "DALI_CONSTRAINT_PARALLEL");
+
+    mEvaluated.assign(mConstraints.size(), 0u);
+
+    const uint32_t batchCount = static_cast<uint32_t>(mBatchOffsets.size()) - 1u;
+    for(uint32_t batch = 0u; batch < batchCount; ++batch)
+    {
+      const uint32_t begin = mBatchOffsets[batch];
+      const uint32_t end   = mBatchOffsets[batch + 1u];
+
+      Evaluate(begin, end);
+
+      // The next batch reads the values written here
+      for(uint32_t position = begin; position < end; ++position)
+      {
+        const uint32_t index = mOrder[position];
+        mConstraints[index]->Commit(mEvaluated[index] != 0u);
+      }
+    }
+
+    for(auto&& container : mContainers)
+    {
+      container->DeactivateAppliedConstraints();
+    }
+
+    applied = true;
+  }
+
+  mConstraints.clear();
+  mContainers.clear();
+
+  return applied;
+}
+
+bool ConstraintScheduler::Schedule()
+{
+  const uint32_t count = static_cast<uint32_t>(mConstraints.size());
+
+  mBatches.resize(count);
+  mAccesses.clear();
+
+  uint32_t batchCount = 0u;
+  for(uint32_t index = 0u; index < count; ++index)
+  {
+    const ConstraintBase&    constraint = *mConstraints[index];
+    const PropertyInputImpl* target     = constraint.GetTargetProperty();
+
+    uint32_t batch = 0u;
+    if(target) // Otherwise the constraint is disconnected, and does nothing
+    {
+      // Follow the previous writers, and the readers of the previous value
+      const Access& targetAccess = mAccesses[target];
+      batch                      = std::max(targetAccess.writeEnd, targetAccess.readEnd);
+
+      // Follow the writers of the inputs
+      uint32_t inputIndex = 0u;
+      for(const PropertyInputImpl* input = constraint.GetInput(inputIndex); input; input = constraint.GetInput(++inputIndex))
+      {
+        if(input->IsInheritedProperty())
+        {
+          // The value depends on when the node tree update reaches the constraint
+          return false;
+        }
+
+        const Access& access = mAccesses[input];
+        batch                = std::max(batch, access.writeEnd);
+        if(input->IsComputedWhenRead())
+        {
+          // e.g. The world position is computed from the world matrix into a member when it is read
+          batch = std::max(batch, access.exclusiveEnd);
+        }
+      }
+
+      inputIndex = 0u;
+      for(const PropertyInputImpl* input = constraint.GetInput(inputIndex); input; input = constraint.GetInput(++inputIndex))
+      {
+        Access& access = mAccesses[input];
+        access.readEnd = std::max(access.readEnd, batch);
+        if(input->IsComputedWhenRead())
+        {
+          access.exclusiveEnd = batch + 1u;
+        }
+      }
+
+      mAccesses[target].writeEnd = batch + 1u;
+    }
+
+    mBatches[index] = batch;
+    batchCount      = std::max(batchCount, batch + 1u);
+  }
+
+  // Sort the constraints by batch, keeping the application order within a batch
+  SortByBatch(mBatches, batchCount, mOrder, mBatchOffsets);
+
+  return true;
+}
+
+void ConstraintScheduler::Evaluate(uint32_t begin, uint32_t end)
+{
+  auto evaluate = [this](uint32_t taskBegin, uint32_t taskEnd)
+  {
+    for(uint32_t position = taskBegin; position < taskEnd; ++position)
+    {
+      const uint32_t index = mOrder[position];
+      mEvaluated[index]    = mConstraints[index]->Evaluate() ? 1u : 0u;
+    }
+  };
+
+  ParallelFor(*mThreadPool, begin, end, MINIMUM_CONSTRAINTS_PER_TASK, evaluate);
+}
+
+} // namespace Dali::Internal::SceneGraph
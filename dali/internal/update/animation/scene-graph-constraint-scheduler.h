@@ -0,0 +1,142 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_SCHEDULER_H
+#define DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_SCHEDULER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+class ThreadPool;
+
+namespace Internal
+{
+class PropertyInputImpl;
+
+namespace SceneGraph
+{
+class ConstraintBase;
+class ConstraintContainer;
+
+/**
+ * Applies the constraints of several containers, evaluating the independent constraint functions on worker threads.
+ *
+ * The constraints are split into batches, from the properties they read and write: a batch only reads the properties
+ * written by the previous batches, so the constraint functions of a batch are evaluated concurrently. The values are
+ * then written by the calling thread, in the order of the containers, so the results match Apply() on each container.
+ *
+ * The scheduler declines, and the containers must be applied serially, when there are not enough constraints
+ * or when a constraint reads an inherited property (e.g. the world color), whose value depends on when the
+ * constraint is applied during the update of the node tree.
+ *
+ * @note The constraint functions must be thread-safe to enable it, so it is only used when
+ * DALI_PARALLEL_CONSTRAINT_MINIMUM_COUNT is set and the update has worker threads.
+ */
+class ConstraintScheduler
+{
+public:
+  /**
+   * Constructor. The minimum constraint count is read from the environment.
+   */
+  ConstraintScheduler();
+
+  /**
+   * Destructor.
+   */
+  ~ConstraintScheduler();
+
+  /**
+   * Sets the thread pool used to evaluate the constraints.
+   * @param[in] threadPool The thread pool, or nullptr to apply every constraint serially
+   */
+  void SetThreadPool(Dali::ThreadPool* threadPool);
+
+  /**
+   * Sets the minimum number of active constraints required to use the worker threads.
+   * @param[in] constraintCount The number of constraints, or 0 to apply every constraint serially
+   */
+  void SetMinimumConstraintCount(uint32_t constraintCount);
+
+  /**
+   * Query whether the constraints may be applied in parallel.
+   * @return True if it is worth collecting the containers
+   */
+  bool IsEnabled() const
+  {
+    return mThreadPool && mMinimumConstraintCount > 0u;
+  }
+
+  /**
+   * Adds the active constraints of a container, after those of the previously added containers.
+   * @param[in] constraints The container
+   */
+  void Add(ConstraintContainer& constraints);
+
+  /**
+   * Applies the constraints of the added containers, then forgets the containers.
+   * @return False if nothing has been applied, in which case the containers must be applied serially
+   */
+  bool Apply();
+
+private:
+  /**
+   * Accesses of the constraints to a property, while the batches are assigned.
+   */
+  struct Access
+  {
+    uint32_t writeEnd{0u};     ///< The batch after the last writer
+    uint32_t readEnd{0u};      ///< The batch of the last reader; a writer may share it since the values are written after evaluation
+    uint32_t exclusiveEnd{0u}; ///< The batch after the last reader of an input which caches its value, so it is not read concurrently
+  };
+
+  /**
+   * Assigns each constraint to a batch.
+   * @return False if the constraints must be applied serially
+   */
+  bool Schedule();
+
+  /**
+   * Evaluates the constraints of a batch on the worker threads and the calling thread.
+   * @param[in] begin The first position in mOrder
+   * @param[in] end The position after the last one
+   */
+  void Evaluate(uint32_t begin, uint32_t end);
+
+  std::vector<ConstraintBase*>      mConstraints;  ///< The active constraints, in application order
+  std::vector<ConstraintContainer*> mContainers;   ///< The added containers
+  std::vector<uint32_t>             mBatches;      ///< The batch of each constraint
+  std::vector<uint32_t>             mOrder;        ///< The constraints sorted by batch, then by application order
+  std::vector<uint32_t>             mBatchOffsets; ///< The start of each batch in mOrder, terminated by the constraint count
+  std::vector<uint8_t>              mEvaluated;    ///< The result of Evaluate() for each constraint
+
+  std::unordered_map<const PropertyInputImpl*, Access> mAccesses; ///< Scratch data of Schedule()
+
+  Dali::ThreadPool* mThreadPool;             ///< The worker threads, not owned
+  uint32_t          mMinimumConstraintCount; ///< Below this number of active constraints, they are applied serially
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_SCHEDULER_H
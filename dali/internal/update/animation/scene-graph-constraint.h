@@ -74,86 +74,112 @@ public:
   ~Constraint() override = default;
 
   /**
-   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::Apply()
+   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::Evaluate()
    */
-  void Apply() override
+  bool Evaluate() override
   {
-    if(!mDisconnected)
+    if(mDisconnected || !mFunc->InputsInitialized())
     {
-      if(mFunc->InputsInitialized())
+      return false;
+    }
+
+    bool applyRequired = false;
+    if(mApplyRate == Dali::Constraint::APPLY_ONCE)
+    {
+      if(mAppliedCount == 0u)
+      {
+        ++mAppliedCount;
+        applyRequired = true;
+      }
+    }
+    else
+    {
+      applyRequired = (((mAppliedCount++) % mApplyRate) == 0);
+    }
+
+    if(applyRequired)
+    {
+      mValue = mTargetProperty.Get();
+      mFunc->Apply(mValue);
+    }
+    return applyRequired;
+  }
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::Commit()
+   */
+  void Commit(bool evaluated) override
+  {
+    if(mDisconnected)
+    {
+      return;
+    }
+
+    if(!evaluated)
+    {
+      INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_SKIPPED);
+      return;
+    }
+
+    const PropertyType& current = mValue;
+    PropertyType        old     = mTargetProperty.Get();
+
+    // Compare with value of the previous frame
+    if constexpr(std::is_same_v<PropertyType, float>)
+    {
+      if(!Equals(old, current))
       {
-        bool applyRequired = false;
-        if(mApplyRate == Dali::Constraint::APPLY_ONCE)
+        if(!mObservedOwners.Empty())
         {
-          if(mAppliedCount == 0u)
-          {
-            ++mAppliedCount;
-            applyRequired = true;
-          }
+          // The first observer is the target of the constraint
+          mObservedOwners[0]->SetUpdated(true);
         }
-        else
+        // Optionally bake the final value
+        if(Dali::Constraint::BAKE == mRemoveAction)
         {
-          applyRequired = (((mAppliedCount++) % mApplyRate) == 0);
+          mTargetProperty.Bake(current);
         }
-
-        if(applyRequired)
+      }
+    }
+    else
+    {
+      if(old != current)
+      {
+        if(!mObservedOwners.Empty())
         {
-          PropertyType current = mTargetProperty.Get();
-          PropertyType old     = mTargetProperty.Get();
-
-          mFunc->Apply(current);
-
-          // Compare with value of the previous frame
-          if constexpr(std::is_same_v<PropertyType, float>)
-          {
-            if(!Equals(old, current))
-            {
-              if(!mObservedOwners.Empty())
-              {
-                // The first observer is the target of the constraint
-                mObservedOwners[0]->SetUpdated(true);
-              }
-              // Optionally bake the final value
-              if(Dali::Constraint::BAKE == mRemoveAction)
-              {
-                mTargetProperty.Bake(current);
-              }
-            }
-          }
-          else
-          {
-            if(old != current)
-            {
-              if(!mObservedOwners.Empty())
-              {
-                // The first observer is the target of the constraint
-                mObservedOwners[0]->SetUpdated(true);
-              }
-              // Optionally bake the final value
-              if(Dali::Constraint::BAKE == mRemoveAction)
-              {
-                mTargetProperty.Bake(current);
-              }
-            }
-          }
-
-          if(Dali::Constraint::DISCARD == mRemoveAction)
-          {
-            mTargetProperty.Set(current);
-          }
-
-          INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
+          // The first observer is the target of the constraint
+          mObservedOwners[0]->SetUpdated(true);
         }
-        else
+        // Optionally bake the final value
+        if(Dali::Constraint::BAKE == mRemoveAction)
         {
-          INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_SKIPPED);
+          mTargetProperty.Bake(current);
         }
       }
-      else
-      {
-        INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_SKIPPED);
-      }
     }
+
+    if(Dali::Constraint::DISCARD == mRemoveAction)
+    {
+      mTargetProperty.Set(current);
+    }
+
+    INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
+  }
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::GetTargetProperty()
+   */
+  const PropertyInputImpl* GetTargetProperty() const override
+  {
+    return mDisconnected ? nullptr : mTarget;
+  }
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::ConstraintBase::GetInput()
+   */
+  const PropertyInputImpl* GetInput(uint32_t index) const override
+  {
+    return mDisconnected ? nullptr : mFunc->GetInput(index);
   }
 
 private:
@@ -167,7 +193,9 @@ private:
              uint32_t                applyRate)
   : ConstraintBase(ownerContainer, removeAction, applyRate),
     mTargetProperty(&targetProperty),
-    mFunc(func)
+    mFunc(func),
+    mTarget(&targetProperty),
+    mValue()
   {
   }
 
@@ -190,6 +218,9 @@ protected:
   PropertyAccessorType mTargetProperty; ///< Raw-pointer to the target property. Not owned.
 
   ConstraintFunctionPtr mFunc;
+
+  const PropertyBase* mTarget; ///< The target property, as seen by the constraints which read it. Not owned.
+  PropertyType        mValue;  ///< The value computed by Evaluate()
 };
 
 } // namespace SceneGraph
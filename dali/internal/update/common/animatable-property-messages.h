@@ -20,6 +20,7 @@
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/common/animatable-property.h>
+#include <dali/internal/update/common/property-message-merging.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/property-resetter.h>
 #include <dali/internal/update/manager/update-manager.h>
@@ -85,6 +86,22 @@ public:
     mUpdateManager.AddPropertyResetter(resetter);
   }
 
+  /**
+   * Replaces the value of the message, if it calls the same member function.
+   * @param[in] member The member function of the new message
+   * @param[in] p The new value
+   * @return True if the value is replaced
+   */
+  bool Merge(MemberFunction member, typename ParameterType<P>::PassingType p)
+  {
+    if(member != memberFunction)
+    {
+      return false;
+    }
+    param = p;
+    return true;
+  }
+
 private:
   SceneGraph::UpdateManager&            mUpdateManager;
   const SceneGraph::PropertyOwner&      mPropertyOwner;
@@ -101,8 +118,14 @@ void BakeMessage(EventThreadServices&                     eventThreadServices,
 {
   using LocalType = MessageBakeReset<SceneGraph::AnimatableProperty<T>, T>;
 
+  // Only the last value is processed when the property is baked several times before the messages are flushed
+  if(MergePropertyMessage<LocalType>(eventThreadServices, &property, &SceneGraph::AnimatableProperty<T>::Bake, newValue))
+  {
+    return;
+  }
+
   // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(LocalType));
+  uint32_t* slot = ReservePropertyMessageSlot<LocalType>(eventThreadServices, &property, true);
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(eventThreadServices.GetUpdateManager(),
@@ -120,8 +143,8 @@ void BakeRelativeMessage(EventThreadServices&                     eventThreadSer
 {
   using LocalType = MessageBakeReset<SceneGraph::AnimatableProperty<T>, T>;
 
-  // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(LocalType));
+  // Reserve some memory inside the message queue; a relative bake can not be merged with another value
+  uint32_t* slot = ReservePropertyMessageSlot<LocalType>(eventThreadServices, &property, false);
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(eventThreadServices.GetUpdateManager(),
@@ -139,8 +162,14 @@ void SetXComponentMessage(EventThreadServices&                       eventThread
 {
   using LocalType = MessageBakeReset<SceneGraph::AnimatableProperty<T>, float>;
 
+  // Only the last value is processed when the property is baked several times before the messages are flushed
+  if(MergePropertyMessage<LocalType>(eventThreadServices, &property, &SceneGraph::AnimatableProperty<T>::BakeX, newValue))
+  {
+    return;
+  }
+
   // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(LocalType));
+  uint32_t* slot = ReservePropertyMessageSlot<LocalType>(eventThreadServices, &property, true);
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(eventThreadServices.GetUpdateManager(),
@@ -158,8 +187,14 @@ void SetYComponentMessage(EventThreadServices&                       eventThread
 {
   using LocalType = MessageBakeReset<SceneGraph::AnimatableProperty<T>, float>;
 
+  // Only the last value is processed when the property is baked several times before the messages are flushed
+  if(MergePropertyMessage<LocalType>(eventThreadServices, &property, &SceneGraph::AnimatableProperty<T>::BakeY, newValue))
+  {
+    return;
+  }
+
   // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(LocalType));
+  uint32_t* slot = ReservePropertyMessageSlot<LocalType>(eventThreadServices, &property, true);
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(eventThreadServices.GetUpdateManager(),
@@ -177,8 +212,14 @@ void SetZComponentMessage(EventThreadServices&                       eventThread
 {
   using LocalType = MessageBakeReset<SceneGraph::AnimatableProperty<T>, float>;
 
+  // Only the last value is processed when the property is baked several times before the messages are flushed
+  if(MergePropertyMessage<LocalType>(eventThreadServices, &property, &SceneGraph::AnimatableProperty<T>::BakeZ, newValue))
+  {
+    return;
+  }
+
   // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(LocalType));
+  uint32_t* slot = ReservePropertyMessageSlot<LocalType>(eventThreadServices, &property, true);
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(eventThreadServices.GetUpdateManager(),
@@ -196,8 +237,14 @@ void SetWComponentMessage(EventThreadServices&                       eventThread
 {
   using LocalType = MessageBakeReset<SceneGraph::AnimatableProperty<T>, float>;
 
+  // Only the last value is processed when the property is baked several times before the messages are flushed
+  if(MergePropertyMessage<LocalType>(eventThreadServices, &property, &SceneGraph::AnimatableProperty<T>::BakeW, newValue))
+  {
+    return;
+  }
+
   // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(LocalType));
+  uint32_t* slot = ReservePropertyMessageSlot<LocalType>(eventThreadServices, &property, true);
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(eventThreadServices.GetUpdateManager(),
@@ -70,6 +70,14 @@ public:
     return true;
   }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::IsInheritedProperty()
+   */
+  bool IsInheritedProperty() const override
+  {
+    return true;
+  }
+
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::GetVector4()
    */
@@ -191,6 +199,14 @@ public:
     return mInheritedFlag;
   }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::IsInheritedProperty()
+   */
+  bool IsInheritedProperty() const override
+  {
+    return true;
+  }
+
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::GetMatrix()
    */
@@ -78,6 +78,14 @@ public:
    */
   virtual bool IsClean() const = 0;
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  bool InputChanged() const override
+  {
+    return !IsClean();
+  }
+
 private:
   // Undefined
   PropertyBase(const PropertyBase& property);
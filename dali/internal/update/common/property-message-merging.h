@@ -0,0 +1,80 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_PROPERTY_MESSAGE_MERGING_H
+#define DALI_INTERNAL_SCENE_GRAPH_PROPERTY_MESSAGE_MERGING_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/queue/queue-benchmark-instrumentation.h>
+#include <dali/internal/event/common/event-thread-services.h>
+
+namespace Dali::Internal
+{
+/**
+ * Retrieves an identifier which is unique to a message type.
+ * @tparam MessageType The type of the message
+ * @return The identifier
+ */
+template<typename MessageType>
+const void* GetMessageTypeId()
+{
+  static const char id = 0;
+  return &id;
+}
+
+/**
+ * Merges a new value into the last message which modifies a property, when a property is set several times
+ * before the messages are flushed. The update thread then only processes the last value.
+ * @tparam MessageType The type of the message. It provides bool Merge(member, value), which replaces its value if it calls the same member function.
+ * @param[in] eventThreadServices The object used to send messages to the scene graph
+ * @param[in] property The property modified by the message
+ * @param[in] member The member function called by the new message
+ * @param[in] value The new value
+ * @return True if the value is merged, i.e. the new message must not be sent
+ */
+template<typename MessageType, typename MemberFunction, typename Value>
+bool MergePropertyMessage(EventThreadServices& eventThreadServices, const void* property, MemberFunction member, const Value& value)
+{
+  auto* lastMessage = reinterpret_cast<MessageType*>(eventThreadServices.FindLastPropertyMessage(property, GetMessageTypeId<MessageType>()));
+  if(lastMessage && lastMessage->Merge(member, value))
+  {
+    DALI_QB_COUNT(MQ_MERGED_PROPERTY_MESSAGES);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Reserves space for a message which modifies a property.
+ * @tparam MessageType The type of the message
+ * @param[in] eventThreadServices The object used to send messages to the scene graph
+ * @param[in] property The property modified by the message
+ * @param[in] mergeable Whether later values may be merged into this message; false e.g. for relative changes
+ * @return A pointer to the first char allocated for the message.
+ */
+template<typename MessageType>
+uint32_t* ReservePropertyMessageSlot(EventThreadServices& eventThreadServices, const void* property, bool mergeable)
+{
+  return eventThreadServices.ReservePropertyMessageSlot(sizeof(MessageType), property, mergeable ? GetMessageTypeId<MessageType>() : nullptr);
+}
+
+} // namespace Dali::Internal
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_PROPERTY_MESSAGE_MERGING_H
@@ -26,6 +26,7 @@
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/event/common/property-input-impl.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/common/property-message-merging.h>
 #include <dali/internal/update/common/property-owner.h>
 
 namespace Dali
@@ -87,8 +88,8 @@ public:
                    MemberFunction                         member,
                    typename ParameterType<P>::PassingType value)
   {
-    // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(AnimatablePropertyMessage));
+    // Reserve some memory inside the message queue; these messages are not merged with later values
+    uint32_t* slot = ReservePropertyMessageSlot<AnimatablePropertyMessage>(eventThreadServices, property, false);
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new(slot) AnimatablePropertyMessage(sceneObject, property, member, value);
@@ -161,8 +162,8 @@ public:
                    MemberFunction               member,
                    float                        value)
   {
-    // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(AnimatablePropertyComponentMessage));
+    // Reserve some memory inside the message queue; these messages are not merged with later values
+    uint32_t* slot = ReservePropertyMessageSlot<AnimatablePropertyComponentMessage>(eventThreadServices, property, false);
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new(slot) AnimatablePropertyComponentMessage(sceneObject, property, member, value);
@@ -123,6 +123,10 @@ void* MemoryPoolCollection::AllocateRawThreadSafe(MemoryPoolCollection::MemoryPo
     {
       return mImpl->mTextureSetMemoryPool.AllocateRawThreadSafe();
     }
+    case MemoryPoolCollection::MemoryPoolType::RENDER_ITEM:
+    {
+      return mImpl->mRenderItemMemoryPool.AllocateRawThreadSafe();
+    }
     case MemoryPoolCollection::MemoryPoolType::RENDER_RENDERER:
     {
       return mImpl->mRenderRendererMemoryPool.AllocateRawThreadSafe();
@@ -131,6 +135,10 @@ void* MemoryPoolCollection::AllocateRawThreadSafe(MemoryPoolCollection::MemoryPo
     {
       return mImpl->mRenderTextureMemoryPool.AllocateRawThreadSafe();
     }
+    case MemoryPoolCollection::MemoryPoolType::RENDER_UBO_VIEW:
+    {
+      return mImpl->mRenderUboViewMemoryPool.AllocateRawThreadSafe();
+    }
     default:
     {
       DALI_ASSERT_ALWAYS(0 && "Invalid memory pool type AllocateRawThreadSafe!");
@@ -193,6 +201,11 @@ void MemoryPoolCollection::FreeThreadSafe(MemoryPoolCollection::MemoryPoolType t
       mImpl->mTextureSetMemoryPool.FreeThreadSafe(static_cast<Dali::Internal::SceneGraph::TextureSet*>(object));
       break;
     }
+    case MemoryPoolCollection::MemoryPoolType::RENDER_ITEM:
+    {
+      mImpl->mRenderItemMemoryPool.FreeThreadSafe(static_cast<Dali::Internal::SceneGraph::RenderItem*>(object));
+      break;
+    }
     case MemoryPoolCollection::MemoryPoolType::RENDER_RENDERER:
     {
       mImpl->mRenderRendererMemoryPool.FreeThreadSafe(static_cast<Dali::Internal::Render::Renderer*>(object));
@@ -203,6 +216,11 @@ void MemoryPoolCollection::FreeThreadSafe(MemoryPoolCollection::MemoryPoolType t
       mImpl->mRenderTextureMemoryPool.FreeThreadSafe(static_cast<Dali::Internal::Render::Texture*>(object));
       break;
     }
+    case MemoryPoolCollection::MemoryPoolType::RENDER_UBO_VIEW:
+    {
+      mImpl->mRenderUboViewMemoryPool.FreeThreadSafe(static_cast<Dali::Internal::Render::UniformBufferView*>(object));
+      break;
+    }
     default:
     {
       DALI_ASSERT_ALWAYS(0 && "Invalid memory pool type FreeThreadSafe!");
@@ -57,6 +57,7 @@ PropertyNotification::PropertyNotification(const PropertyInputImpl* property,
   mConditionType(condition),
   mArguments(arguments),
   mValid(false),
+  mChecked(false),
   mNotifyMode(Dali::PropertyNotification::DISABLED),
   mConditionFunction(nullptr)
 {
@@ -121,8 +122,17 @@ void PropertyNotification::SetNotifyMode(NotifyMode notifyMode)
   mNotifyMode = notifyMode;
 }
 
-bool PropertyNotification::Check()
+bool PropertyNotification::Check(bool inputChanged)
 {
+  // The conditions only depend on the property value, so an unchanged property gives the previous result.
+  // The exception is a step which has just been crossed: it is not crossed again, so it becomes invalid.
+  const bool stepCondition = (mConditionType == PropertyCondition::Step) || (mConditionType == PropertyCondition::VariableStep);
+  if(!inputChanged && mChecked && !(stepCondition && mValid))
+  {
+    return false;
+  }
+  mChecked = true;
+
   bool notifyRequired = false;
   bool currentValid   = false;
 
@@ -140,7 +150,7 @@ bool PropertyNotification::Check()
     currentValid = mConditionFunction(input, mArguments);
   }
 
-  if(mValid != currentValid || (currentValid && ((mConditionType == PropertyCondition::Step) || (mConditionType == PropertyCondition::VariableStep))))
+  if(mValid != currentValid || (currentValid && stepCondition))
   {
     mValid = currentValid;
     //  means don't notify so notifyRequired stays false
@@ -83,12 +83,23 @@ public:
    */
   void SetNotifyMode(NotifyMode notifyMode);
 
+  /**
+   * Retrieve the property watched by this notification.
+   * @return The scene graph property
+   */
+  const PropertyInputImpl* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * Check this property notification condition,
    * and if true then dispatch notification.
+   * The condition is not evaluated again while the property is unchanged, unless it may give a different result.
+   * @param[in] inputChanged Whether the property may have changed, i.e. GetProperty()->InputChanged()
    * @return Whether the validity of this notification has changed.
    */
-  bool Check();
+  bool Check(bool inputChanged);
 
   /**
    * Returns the validity of the last condition check
@@ -140,6 +151,7 @@ protected:
   ConditionType            mConditionType;     ///< The ConditionType
   RawArgumentContainer     mArguments;         ///< The arguments.
   bool                     mValid;             ///< Whether this property notification is currently valid or not.
+  bool                     mChecked;           ///< Whether the condition has been evaluated at least once.
   NotifyMode               mNotifyMode;        ///< Whether to notify on invalid and/or valid
   ConditionFunction        mConditionFunction; ///< The Condition Function pointer to be evaluated.
 };
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/node-batch.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/common/message-buffer.h>
+#include <dali/internal/common/message.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace SceneGraph
+{
+NodeBatch::NodeBatch()
+: mNodes(),
+  mMessages(nullptr)
+{
+}
+
+NodeBatch::~NodeBatch()
+{
+  // The messages may refer to the nodes
+  DeleteMessages();
+}
+
+void NodeBatch::AddNode(OwnerPointer<Node>& node)
+{
+  mNodes.push_back(std::move(node));
+}
+
+void NodeBatch::SetMessages(MessageBuffer* messages)
+{
+  DeleteMessages();
+  mMessages = messages;
+}
+
+void NodeBatch::ProcessMessages()
+{
+  if(mMessages)
+  {
+    for(MessageBuffer::Iterator iter = mMessages->Begin(); iter.IsValid(); iter.Next())
+    {
+      MessageBase* message = reinterpret_cast<MessageBase*>(iter.Get());
+      message->Process();
+
+      // Call virtual destructor explictly; since delete will not be called after placement new
+      message->~MessageBase();
+    }
+
+    delete mMessages;
+    mMessages = nullptr;
+  }
+}
+
+void NodeBatch::DeleteMessages()
+{
+  if(mMessages)
+  {
+    for(MessageBuffer::Iterator iter = mMessages->Begin(); iter.IsValid(); iter.Next())
+    {
+      MessageBase* message = reinterpret_cast<MessageBase*>(iter.Get());
+      message->~MessageBase();
+    }
+
+    delete mMessages;
+    mMessages = nullptr;
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,111 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_NODE_BATCH_H
+#define DALI_INTERNAL_SCENE_GRAPH_NODE_BATCH_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/update/nodes/node.h>
+
+namespace Dali
+{
+namespace Internal
+{
+class MessageBuffer;
+
+namespace SceneGraph
+{
+/**
+ * The nodes created and the messages sent by the event thread while a batch is active,
+ * e.g. to populate a page of a list; they are sent to the update thread with one message.
+ *
+ * The nodes are added to the scene graph first, then the messages are processed in the order they were sent.
+ * As the messages can not refer to a node before it is created, this is equivalent to processing them one by one.
+ */
+class NodeBatch
+{
+public:
+  /**
+   * Constructor
+   */
+  NodeBatch();
+
+  /**
+   * Destructor, deletes the nodes and the messages which were not installed.
+   */
+  ~NodeBatch();
+
+  NodeBatch(const NodeBatch&)            = delete;
+  NodeBatch& operator=(const NodeBatch&) = delete;
+
+  /**
+   * Adds a node created by the event thread; the batch takes ownership.
+   * @param[in] node The new node
+   */
+  void AddNode(OwnerPointer<Node>& node);
+
+  /**
+   * Sets the messages sent while the batch was active; the batch takes ownership.
+   * @param[in] messages The buffer of the messages, may be nullptr
+   */
+  void SetMessages(MessageBuffer* messages);
+
+  /**
+   * Query whether the batch has neither node nor message.
+   * @return True if empty
+   */
+  bool IsEmpty() const
+  {
+    return mNodes.empty() && !mMessages;
+  }
+
+  /**
+   * Retrieves the nodes, to be added to the scene graph by the update thread.
+   * @return The nodes; the caller may take their ownership
+   */
+  std::vector<OwnerPointer<Node>>& GetNodes()
+  {
+    return mNodes;
+  }
+
+  /**
+   * Processes the messages; called by the update thread once the nodes are added.
+   */
+  void ProcessMessages();
+
+private:
+  /**
+   * Destroys the messages and the buffer.
+   */
+  void DeleteMessages();
+
+private:
+  std::vector<OwnerPointer<Node>> mNodes;    ///< The nodes, in the order of creation
+  MessageBuffer*                  mMessages; ///< The messages, owned
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_NODE_BATCH_H
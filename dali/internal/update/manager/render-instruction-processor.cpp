@@ -20,8 +20,11 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
+#include <dali/integration-api/trace.h>
+#include <dali/internal/common/environment-variable.h>
 #include <dali/internal/common/matrix-utils.h>
 #include <dali/internal/event/actors/layer-impl.h> // for the default sorting function
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-instruction-container.h>
 #include <dali/internal/render/common/render-instruction.h>
 #include <dali/internal/render/common/render-item.h>
@@ -35,11 +38,45 @@
 #include <dali/internal/update/rendering/scene-graph-texture-set.h>
 #include <dali/public-api/actors/layer.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 namespace
 {
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gRenderListLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_RENDER_LISTS");
 #endif
+
+DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_UPDATE_PROCESS, false);
+
+constexpr uint32_t MAX_OCCLUDERS = 8u; ///< The number of the largest occluders kept while culling a render list
+
+constexpr const char* RADIX_SORT_MINIMUM_ITEM_COUNT_ENV     = "DALI_RADIX_SORT_MINIMUM_ITEM_COUNT"; ///< Render lists with this number of items or more are radix sorted. 0 disables it.
+constexpr uint32_t    DEFAULT_RADIX_SORT_MINIMUM_ITEM_COUNT = 128u;                                ///< Below this, the comparison sort is faster than building the keys
+
+// The comparitor treats z values within a ranged epsilon as equal, which depends on their magnitude and is not transitive,
+// so no fixed quantization matches it. Dropping the lowest bits only absorbs the float rounding noise: transparent items
+// whose z values differ by less than the epsilon, but more than these bits, are ordered by z rather than by their state.
+constexpr uint32_t Z_VALUE_QUANTIZATION_BITS = 2u; ///< Low bits of the z value ignored by the radix sort
+constexpr uint32_t Z_VALUE_KEY_BITS          = 32u - Z_VALUE_QUANTIZATION_BITS;
+
+uint32_t GetRadixSortMinimumItemCount()
+{
+  return Dali::Internal::EnvironmentVariable::GetUnsignedIntegerValue(RADIX_SORT_MINIMUM_ITEM_COUNT_ENV, DEFAULT_RADIX_SORT_MINIMUM_ITEM_COUNT);
+}
+
+/**
+ * @return The number of bits needed to store the given value.
+ */
+inline uint32_t GetBitCount(uint64_t value)
+{
+  uint32_t bitCount = 0u;
+  for(; value != 0u; value >>= 1u)
+  {
+    ++bitCount;
+  }
+  return bitCount;
+}
 } // namespace
 
 namespace Dali
@@ -139,6 +176,49 @@ bool CompareItems3DWithClipping(const RenderInstructionProcessor::SortAttributes
   return lhs.renderItem->mNode->mClippingSortModifier < rhs.renderItem->mNode->mClippingSortModifier;
 }
 
+/**
+ * Checks whether a renderer only writes colors, so skipping it does not change how the following items are drawn.
+ * @param[in] renderer The renderer
+ * @return True if the renderer writes neither to the depth nor to the stencil buffer
+ */
+inline bool WritesColorOnly(const Renderer& renderer)
+{
+  const RenderMode::Type renderMode = renderer.GetStencilParameters().renderMode;
+  return (renderMode == RenderMode::AUTO || renderMode == RenderMode::COLOR) &&
+         renderer.GetDepthWriteMode() != DepthWriteMode::ON &&
+         renderer.GetDepthTestMode() != DepthTestMode::ON;
+}
+
+/**
+ * Calculates a view space rect of an area of a node whose plane is parallel to the view plane.
+ * @param[in] modelViewMatrix The model view matrix of the node
+ * @param[in] area The area in node space (center x, center y, width, height)
+ * @param[in] inner True to get the largest rect inside the area, false to get the smallest rect around it
+ * @return The rect (left, top, right, bottom)
+ */
+inline Vector4 CalculateViewSpaceRect(const Matrix& modelViewMatrix, const Vector4& area, bool inner)
+{
+  const float* m          = modelViewMatrix.AsFloat();
+  const float  halfWidth  = area.z * 0.5f;
+  const float  halfHeight = area.w * 0.5f;
+  const float  sign       = inner ? -1.0f : 1.0f;
+
+  const float centerX = m[0] * area.x + m[4] * area.y + m[12];
+  const float centerY = m[1] * area.x + m[5] * area.y + m[13];
+  const float extentX = fabsf(m[0]) * halfWidth + sign * fabsf(m[4]) * halfHeight;
+  const float extentY = fabsf(m[5]) * halfHeight + sign * fabsf(m[1]) * halfWidth;
+
+  return Vector4(centerX - extentX, centerY - extentY, centerX + extentX, centerY + extentY);
+}
+
+/**
+ * Checks whether a value of a model view matrix is zero, allowing for the rounding errors of the rotations.
+ */
+inline bool IsNearlyZero(float value)
+{
+  return fabsf(value) < Math::MACHINE_EPSILON_1000;
+}
+
 /**
  * Add a renderer to the list
  * @param renderPass render pass for this render instruction
@@ -194,7 +274,8 @@ inline void AddRendererToRenderList(uint32_t                  renderPass,
     return false;
   };
 
-  if(requiredInsideCheck())
+  const bool insideCheckRequired = requiredInsideCheck();
+  if(insideCheckRequired)
   {
     const Vector4& boundingSphere = node->GetBoundingSphere();
 
@@ -289,6 +370,20 @@ inline void AddRendererToRenderList(uint32_t                  renderPass,
       item.mModelViewMatrix = std::move(nodeModelViewMatrix);
 
       item.mIsUpdated = item.mIsUpdated || nodePartialRenderingData.mUpdated;
+
+      // Only plain 2D items take part in the occlusion culling. See RenderInstructionProcessor::CullOccludedItems
+      item.mIsOccluded   = false;
+      item.mIsOccludable = false;
+      item.mIsOccluder   = false;
+      if(insideCheckRequired && !isLayer3d && WritesColorOnly(*renderable.mRenderer.Get()))
+      {
+        item.mVisibleArea  = renderable.mRenderer->GetVisualTransformedUpdateArea(nodePartialRenderingData.mNodeInfomations.updatedPositionSize);
+        item.mIsOccludable = (item.mVisibleArea.z > 0.0f && item.mVisibleArea.w > 0.0f);
+        item.mIsOccluder   = isOpaque &&
+                           node->GetClippingDepth() == 0u &&
+                           node->GetScissorDepth() == 0u &&
+                           renderable.mRenderer->GetOccludingArea(renderPass, nodePartialRenderingData.mNodeInfomations.size, item.mOccludingArea);
+      }
     }
 
     node->SetCulled(false);
@@ -429,7 +524,8 @@ inline void UpdateReusedRenderListPartialUpdateData(RenderList& renderList,
 } // Anonymous namespace.
 
 RenderInstructionProcessor::RenderInstructionProcessor()
-: mSortingHelper()
+: mSortingHelper(),
+  mRadixSortMinimumItemCount(GetRadixSortMinimumItemCount())
 {
   // Set up a container of comparators for fast run-time selection.
   mSortComparitors.Reserve(3u);
@@ -441,6 +537,131 @@ RenderInstructionProcessor::RenderInstructionProcessor()
 
 RenderInstructionProcessor::~RenderInstructionProcessor() = default;
 
+inline bool RenderInstructionProcessor::RadixSortRenderItems(int comparitorIndex)
+{
+  const uint32_t renderableCount = static_cast<uint32_t>(mSortingHelper.size());
+
+  // The comparitors ignore the attributes, which only order the items they consider equal.
+  for(auto& attributes : mSortingHelper)
+  {
+    const auto& item = *attributes.renderItem.Get();
+    if(DALI_LIKELY(item.mRenderer))
+    {
+      item.mRenderer->SetSortAttributes(attributes);
+    }
+    else
+    {
+      attributes.shader   = nullptr;
+      attributes.geometry = nullptr;
+    }
+    attributes.textureSet = item.mTextureSet;
+  }
+
+  // Replace the attributes by their rank, so that the ids keep the order of the pointers compared by PartialCompareItems.
+  mRadixSortItems.resize(renderableCount);
+  for(auto& radixItem : mRadixSortItems)
+  {
+    radixItem.secondaryKey = 0u;
+  }
+
+  uint32_t   secondaryKeyBits = 0u;
+  const auto addStateIds      = [this, &secondaryKeyBits](auto getState)
+  {
+    mSortedStates.clear();
+    for(const auto& attributes : mSortingHelper)
+    {
+      mSortedStates.push_back(getState(attributes));
+    }
+    std::sort(mSortedStates.begin(), mSortedStates.end());
+    mSortedStates.erase(std::unique(mSortedStates.begin(), mSortedStates.end()), mSortedStates.end());
+
+    const uint32_t idBits = GetBitCount(mSortedStates.size() - 1u);
+    secondaryKeyBits += idBits;
+    for(uint32_t index = 0u; index < mSortingHelper.size(); ++index)
+    {
+      const auto id                         = std::lower_bound(mSortedStates.begin(), mSortedStates.end(), getState(mSortingHelper[index])) - mSortedStates.begin();
+      mRadixSortItems[index].secondaryKey = (mRadixSortItems[index].secondaryKey << idBits) | static_cast<uint64_t>(id);
+    }
+  };
+  addStateIds([](const SortAttributes& attributes) { return static_cast<const void*>(attributes.shader); });
+  addStateIds([](const SortAttributes& attributes) { return attributes.textureSet; });
+  addStateIds([](const SortAttributes& attributes) { return static_cast<const void*>(attributes.geometry); });
+  if(secondaryKeyBits > 64u)
+  {
+    return false;
+  }
+
+  if(comparitorIndex == 0)
+  {
+    // LAYER_UI : the depth index only
+    for(uint32_t index = 0u; index < renderableCount; ++index)
+    {
+      mRadixSortItems[index].primaryKey = static_cast<uint32_t>(mSortingHelper[index].depthIndex) ^ 0x80000000u;
+      mRadixSortItems[index].index      = index;
+    }
+  }
+  else
+  {
+    // LAYER_3D : [clipping sort modifier] [transparent] [depth index] [reversed z value]
+    // The opaque items only have their clipping sort modifier, as the comparitor ignores their depth.
+    int32_t  minimumDepthIndex = 0;
+    int32_t  maximumDepthIndex = 0;
+    uint32_t maximumModifier   = 0u;
+    bool     hasTransparent    = false;
+    for(const auto& attributes : mSortingHelper)
+    {
+      const auto& item = *attributes.renderItem.Get();
+      if(!item.mIsOpaque)
+      {
+        minimumDepthIndex = hasTransparent ? std::min(minimumDepthIndex, item.mDepthIndex) : item.mDepthIndex;
+        maximumDepthIndex = hasTransparent ? std::max(maximumDepthIndex, item.mDepthIndex) : item.mDepthIndex;
+        hasTransparent    = true;
+      }
+      maximumModifier = std::max(maximumModifier, item.mNode->mClippingSortModifier);
+    }
+
+    const uint32_t depthBits    = GetBitCount(static_cast<uint64_t>(static_cast<int64_t>(maximumDepthIndex) - minimumDepthIndex));
+    const uint32_t modifierBits = comparitorIndex == 2 ? GetBitCount(maximumModifier) : 0u;
+    if(modifierBits + 1u + depthBits + Z_VALUE_KEY_BITS > 64u)
+    {
+      return false;
+    }
+
+    const uint32_t transparentShift = depthBits + Z_VALUE_KEY_BITS;
+    const uint32_t modifierShift    = transparentShift + 1u;
+    for(uint32_t index = 0u; index < renderableCount; ++index)
+    {
+      const auto& attributes = mSortingHelper[index];
+      const auto& item       = *attributes.renderItem.Get();
+
+      uint64_t key = 0u;
+      if(!item.mIsOpaque)
+      {
+        const uint64_t depth  = static_cast<uint64_t>(static_cast<int64_t>(item.mDepthIndex) - minimumDepthIndex);
+        const uint64_t zValue = (~FloatToOrderedBits(attributes.zValue)) >> Z_VALUE_QUANTIZATION_BITS; // Far items first
+        key                   = (1ull << transparentShift) | (depth << Z_VALUE_KEY_BITS) | zValue;
+      }
+      if(modifierBits > 0u)
+      {
+        key |= static_cast<uint64_t>(item.mNode->mClippingSortModifier) << modifierShift;
+      }
+
+      mRadixSortItems[index].primaryKey = key;
+      mRadixSortItems[index].index      = index;
+    }
+  }
+
+  RadixSort(mRadixSortItems, mRadixSortBuffer);
+
+  mRadixSortedHelper.resize(renderableCount);
+  for(uint32_t index = 0u; index < renderableCount; ++index)
+  {
+    mRadixSortedHelper[index] = mSortingHelper[mRadixSortItems[index].index];
+  }
+  mSortingHelper.swap(mRadixSortedHelper);
+  return true;
+}
+
 inline void RenderInstructionProcessor::SortRenderItems(RenderList& renderList, Layer& layer, bool respectClippingOrder, bool isOrthographicCamera)
 {
   const uint32_t renderableCount = static_cast<uint32_t>(renderList.Count());
@@ -532,41 +753,46 @@ inline void RenderInstructionProcessor::SortRenderItems(RenderList& renderList,
   // If we don't need to sort, we can skip the sort.
   if(needToSort || needToSortWithAttributes)
   {
-    if(needToSort)
+    // Long lists are sorted by both the comparitor and the attributes at once, if their keys can be packed.
+    const bool radixSorted = mRadixSortMinimumItemCount > 0u && renderableCount >= mRadixSortMinimumItemCount && RadixSortRenderItems(comparitorIndex);
+    if(!radixSorted)
     {
-      std::stable_sort(mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[comparitorIndex]);
-    }
-    if(needToSortWithAttributes)
-    {
-      for(auto iter = mSortingHelper.begin(), endIter = mSortingHelper.end(); iter != endIter;)
+      if(needToSort)
       {
-        auto     jter  = iter;
-        uint32_t count = 0u;
-
-        // Collect the number of render items that has same order with *iter.
-        while(++jter != endIter && !mSortComparitors[comparitorIndex](*iter, *jter))
-        {
-          ++count;
-        }
-        if(count > 1u)
+        std::stable_sort(mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[comparitorIndex]);
+      }
+      if(needToSortWithAttributes)
+      {
+        for(auto iter = mSortingHelper.begin(), endIter = mSortingHelper.end(); iter != endIter;)
         {
-          // Set sort attributes here.
-          for(auto kter = iter; kter != jter; ++kter)
+          auto     jter  = iter;
+          uint32_t count = 0u;
+
+          // Collect the number of render items that has same order with *iter.
+          while(++jter != endIter && !mSortComparitors[comparitorIndex](*iter, *jter))
           {
-            const auto& item = *((*kter).renderItem.Get());
-            if(DALI_LIKELY(item.mRenderer))
+            ++count;
+          }
+          if(count > 1u)
+          {
+            // Set sort attributes here.
+            for(auto kter = iter; kter != jter; ++kter)
             {
-              item.mRenderer->SetSortAttributes(*kter);
+              const auto& item = *((*kter).renderItem.Get());
+              if(DALI_LIKELY(item.mRenderer))
+              {
+                item.mRenderer->SetSortAttributes(*kter);
+              }
+
+              // texture set
+              (*kter).textureSet = item.mTextureSet;
             }
 
-            // texture set
-            (*kter).textureSet = item.mTextureSet;
+            // Sort by partial attributes.
+            std::stable_sort(iter, jter, PartialCompareItems);
           }
-
-          // Sort by partial attributes.
-          std::stable_sort(iter, jter, PartialCompareItems);
+          iter = jter;
         }
-        iter = jter;
       }
     }
 
@@ -581,12 +807,89 @@ inline void RenderInstructionProcessor::SortRenderItems(RenderList& renderList,
   }
 }
 
+inline void RenderInstructionProcessor::CullOccludedItems(RenderList& renderList, bool isOrthographicCamera)
+{
+  const uint32_t renderableCount = static_cast<uint32_t>(renderList.Count());
+  uint32_t       culledCount     = 0u;
+
+  DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_OCCLUSION_CULLING", [&](std::ostringstream& oss)
+  { oss << "[" << renderableCount << "]"; });
+
+  mOccluders.clear();
+
+  // Items are drawn in the list order, so walk it from the front-most item to the back-most one.
+  for(uint32_t index = renderableCount; index-- > 0u;)
+  {
+    RenderItem& item = renderList.GetItem(index);
+    if(!item.mIsOccludable)
+    {
+      continue;
+    }
+
+    // The depth of the item is only constant if its plane is parallel to the view plane.
+    const float* m = item.mModelViewMatrix.AsFloat();
+    if(!IsNearlyZero(m[2]) || !IsNearlyZero(m[6]))
+    {
+      continue;
+    }
+
+    // Under a perspective camera, view space rects only compare at the same depth.
+    const Vector4 rect  = CalculateViewSpaceRect(item.mModelViewMatrix, item.mVisibleArea, false);
+    const float   depth = m[14];
+    for(const auto& occluder : mOccluders)
+    {
+      if((isOrthographicCamera || Equals(occluder.depth, depth)) &&
+         occluder.left <= rect.x && occluder.top <= rect.y && rect.z <= occluder.right && rect.w <= occluder.bottom)
+      {
+        item.mIsOccluded = true;
+        ++culledCount;
+        break;
+      }
+    }
+
+    // Only an axis aligned item covers its whole view space rect.
+    if(item.mIsOccluded || !item.mIsOccluder || !IsNearlyZero(m[1]) || !IsNearlyZero(m[4]))
+    {
+      continue;
+    }
+
+    const Vector4 occludingRect = CalculateViewSpaceRect(item.mModelViewMatrix, item.mOccludingArea, true);
+    if(occludingRect.x >= occludingRect.z || occludingRect.y >= occludingRect.w)
+    {
+      continue;
+    }
+
+    const Occluder occluder{occludingRect.x, occludingRect.y, occludingRect.z, occludingRect.w, depth};
+    if(mOccluders.size() < MAX_OCCLUDERS)
+    {
+      mOccluders.push_back(occluder);
+    }
+    else
+    {
+      // Keep the largest occluders, which are the most likely to hide the items behind.
+      auto smallest = std::min_element(mOccluders.begin(), mOccluders.end(), [](const Occluder& lhs, const Occluder& rhs)
+                                       { return lhs.GetArea() < rhs.GetArea(); });
+      if(smallest->GetArea() < occluder.GetArea())
+      {
+        *smallest = occluder;
+      }
+    }
+  }
+
+  DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_OCCLUSION_CULLING", [&](std::ostringstream& oss)
+  { oss << "[culled:" << culledCount << "]"; });
+
+  DALI_LOG_INFO(gRenderListLogFilter, Debug::Verbose, "CullOccludedItems() : %u of %u items culled\n", culledCount, renderableCount);
+}
+
 void RenderInstructionProcessor::Prepare(SortedLayerPointers&        sortedLayers,
                                          RenderTask&                 renderTask,
                                          bool                        cull,
                                          bool                        hasClippingNodes,
                                          RenderInstructionContainer& instructions)
 {
+  PERF_MONITOR_START(PerformanceMonitor::PREPARE_RENDERABLES);
+
   // Retrieve the RenderInstruction buffer from the RenderInstructionContainer
   // then populate with instructions.
   RenderInstruction& instruction             = renderTask.PrepareRenderInstruction();
@@ -638,6 +941,13 @@ void RenderInstructionProcessor::Prepare(SortedLayerPointers&        sortedLayer
 
         // We only use the clipping version of the sort comparitor if any clipping nodes exist within the RenderList.
         SortRenderItems(*renderList, layer, hasClippingNodes, isOrthographicCamera);
+
+        // Without depth test, an item of a 2D layer hides everything drawn before it.
+        // Items after the stopper node are not drawn, so they hide nothing.
+        if(cull && !isLayer3D && layer.IsDepthTestDisabled() && !stopperNode)
+        {
+          CullOccludedItems(*renderList, isOrthographicCamera);
+        }
       }
       else
       {
@@ -697,6 +1007,8 @@ void RenderInstructionProcessor::Prepare(SortedLayerPointers&        sortedLayer
   {
     instructions.PushBack(&instruction);
   }
+
+  PERF_MONITOR_END(PerformanceMonitor::PREPARE_RENDERABLES);
 }
 
 } // namespace SceneGraph
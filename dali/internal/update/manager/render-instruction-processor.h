@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 
+#include <dali/internal/common/radix-sort.h>
 #include <dali/internal/render/common/render-item-key.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 
@@ -123,13 +124,52 @@ private:
    */
   inline void SortRenderItems(RenderList& renderList, Layer& layer, bool respectClippingOrder, bool isOrthographicCamera);
 
+  /**
+   * @brief Sorts the sorting helper with packed keys and a radix sort, in the order of the comparitor.
+   * @note The z values are compared exactly, apart from their lowest bits, while the comparitor treats the z values within a ranged epsilon as equal.
+   * @param comparitorIndex The index of the comparitor which the order follows
+   * @return False if the keys of the items do not fit in the packed keys, and the helper is not sorted.
+   */
+  inline bool RadixSortRenderItems(int comparitorIndex);
+
+  /**
+   * @brief Flags the items of a 2D render list which are hidden by the opaque items drawn after them.
+   * Occluded items are kept in the list, so it can still be reused by the following frames.
+   * @param renderList The sorted render list
+   * @param isOrthographicCamera Whether the camera is orthographic or not.
+   */
+  inline void CullOccludedItems(RenderList& renderList, bool isOrthographicCamera);
+
+  /**
+   * @brief Structure to store the view space rect hidden by an opaque item.
+   */
+  struct Occluder
+  {
+    float GetArea() const
+    {
+      return (right - left) * (bottom - top);
+    }
+
+    float left;
+    float top;
+    float right;
+    float bottom;
+    float depth; ///< The view space z of the item
+  };
+
   /// Sort comparitor function pointer type.
   using ComparitorPointer = bool (*)(const SortAttributes&, const SortAttributes&);
 
   using SortingHelper = std::vector<SortAttributes>;
 
-  Dali::Vector<ComparitorPointer>           mSortComparitors; ///< Contains all sort comparitors, used for quick look-up
-  RenderInstructionProcessor::SortingHelper mSortingHelper;   ///< Helper used to sort Renderers
+  Dali::Vector<ComparitorPointer>           mSortComparitors;           ///< Contains all sort comparitors, used for quick look-up
+  RenderInstructionProcessor::SortingHelper mSortingHelper;             ///< Helper used to sort Renderers
+  RenderInstructionProcessor::SortingHelper mRadixSortedHelper;         ///< Helper receiving the Renderers sorted by the radix sort
+  std::vector<RadixSortItem>                mRadixSortItems;            ///< Packed keys of the Renderers
+  std::vector<RadixSortItem>                mRadixSortBuffer;           ///< Scratch memory of the radix sort
+  std::vector<const void*>                  mSortedStates;              ///< Helper used to give compact ids to the shaders, texture sets and geometries
+  std::vector<Occluder>                     mOccluders;                 ///< Helper used to cull occluded items
+  uint32_t                                  mRadixSortMinimumItemCount; ///< Render lists with this number of items or more use the radix sort. 0 if disabled
 };
 
 } // namespace SceneGraph
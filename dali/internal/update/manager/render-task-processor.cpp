@@ -19,7 +19,9 @@
 #include <dali/internal/update/manager/render-task-processor.h>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-instruction-container.h>
 #include <dali/internal/render/common/render-instruction.h>
 #include <dali/internal/render/common/render-item.h>
@@ -309,7 +311,10 @@ void ProcessTasks(RenderTaskList::RenderTaskContainer& taskContainer,
 
 } // Anonymous namespace.
 
-RenderTaskProcessor::RenderTaskProcessor() = default;
+RenderTaskProcessor::RenderTaskProcessor()
+: mThreadPool(nullptr)
+{
+}
 
 RenderTaskProcessor::~RenderTaskProcessor() = default;
 
@@ -318,6 +323,83 @@ bool RenderTaskProcessor::Process(RenderTaskList&             renderTasks,
                                   RenderInstructionContainer& instructions,
                                   bool                        renderToFboEnabled,
                                   bool                        isRenderingToFbo)
+{
+  return Process(renderTasks, sortedLayers, instructions, renderToFboEnabled, isRenderingToFbo, mRenderInstructionProcessor);
+}
+
+bool RenderTaskProcessor::Process(const std::vector<SceneRenderTasks>& scenes,
+                                  bool                                 renderToFboEnabled,
+                                  bool                                 isRenderingToFbo)
+{
+  const uint32_t sceneCount  = static_cast<uint32_t>(scenes.size());
+  const uint32_t workerCount = static_cast<uint32_t>(mWorkerInstructionProcessors.size());
+
+  auto processScene = [this, renderToFboEnabled, isRenderingToFbo](const SceneRenderTasks& scene, RenderInstructionProcessor& renderInstructionProcessor)
+  {
+    return Process(*scene.renderTasks, *scene.sortedLayers, *scene.instructions, renderToFboEnabled, isRenderingToFbo, renderInstructionProcessor);
+  };
+
+  bool keepRendering = false;
+  if(sceneCount <= 1u || workerCount == 0u)
+  {
+    for(auto&& scene : scenes)
+    {
+      keepRendering = processScene(scene, mRenderInstructionProcessor) || keepRendering;
+    }
+    return keepRendering;
+  }
+
+  // The calling thread takes the first scene, the workers take the rest.
+  // The tasks given to a worker run in order, so a worker can reuse its RenderInstructionProcessor.
+  mSceneKeepRendering.assign(sceneCount, 0u);
+
+  std::vector<SharedFuture> futures;
+  futures.reserve(sceneCount - 1u);
+  for(uint32_t index = 1u; index < sceneCount; ++index)
+  {
+    RenderInstructionProcessor& renderInstructionProcessor = *mWorkerInstructionProcessors[(index - 1u) % workerCount];
+    futures.push_back(mThreadPool->SubmitTask((index - 1u) % workerCount, [this, &scenes, &processScene, &renderInstructionProcessor, index](uint32_t)
+                                              {
+      mSceneKeepRendering[index] = processScene(scenes[index], renderInstructionProcessor) ? 1u : 0u;
+      PERF_MONITOR_FLUSH_WORKER(); }));
+  }
+
+  keepRendering = processScene(scenes[0], mRenderInstructionProcessor);
+
+  for(auto& future : futures)
+  {
+    future->Wait();
+  }
+
+  for(uint32_t index = 1u; index < sceneCount; ++index)
+  {
+    keepRendering = keepRendering || mSceneKeepRendering[index];
+  }
+
+  return keepRendering;
+}
+
+void RenderTaskProcessor::SetThreadPool(Dali::ThreadPool* threadPool)
+{
+  mThreadPool = threadPool;
+
+  const std::size_t workerCount = mThreadPool ? mThreadPool->GetWorkerCount() : 0u;
+  mWorkerInstructionProcessors.resize(workerCount);
+  for(auto&& processor : mWorkerInstructionProcessors)
+  {
+    if(!processor)
+    {
+      processor = std::make_unique<RenderInstructionProcessor>();
+    }
+  }
+}
+
+bool RenderTaskProcessor::Process(RenderTaskList&             renderTasks,
+                                  SortedLayerPointers&        sortedLayers,
+                                  RenderInstructionContainer& instructions,
+                                  bool                        renderToFboEnabled,
+                                  bool                        isRenderingToFbo,
+                                  RenderInstructionProcessor& renderInstructionProcessor)
 {
   RenderTaskList::RenderTaskContainer& taskContainer = renderTasks.GetTasks();
   bool                                 keepRendering = false;
@@ -341,7 +423,7 @@ bool RenderTaskProcessor::Process(RenderTaskList&             renderTasks,
   ProcessTasks(taskContainer,
                sortedLayers,
                instructions,
-               mRenderInstructionProcessor,
+               renderInstructionProcessor,
                keepRendering,
                renderToFboEnabled,
                isRenderingToFbo,
@@ -355,7 +437,7 @@ bool RenderTaskProcessor::Process(RenderTaskList&             renderTasks,
   ProcessTasks(taskContainer,
                sortedLayers,
                instructions,
-               mRenderInstructionProcessor,
+               renderInstructionProcessor,
                keepRendering,
                renderToFboEnabled,
                isRenderingToFbo,
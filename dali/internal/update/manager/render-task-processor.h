@@ -18,12 +18,18 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <memory>
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/internal/update/manager/render-instruction-processor.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 
 namespace Dali
 {
+class ThreadPool;
+
 namespace Internal
 {
 namespace SceneGraph
@@ -36,6 +42,16 @@ class RenderTaskList;
 class RenderTaskProcessor
 {
 public:
+  /**
+   * @brief The render-tasks of a scene, with the layers and the instruction container used to process them.
+   */
+  struct SceneRenderTasks
+  {
+    RenderTaskList*             renderTasks;
+    SortedLayerPointers*        sortedLayers;
+    RenderInstructionContainer* instructions;
+  };
+
   /**
    * @brief Constructor.
    */
@@ -63,6 +79,25 @@ public:
                bool                        renderToFboEnabled,
                bool                        isRenderingToFbo);
 
+  /**
+   * Process the render-tasks of several scenes; the output is a series of render instructions for each scene.
+   * The scenes do not share any node or layer, so they are processed concurrently if a thread pool is set.
+   * The render-tasks of a scene are still processed in order, as they share the layers of the scene.
+   * @param[in] scenes             The render-tasks of each scene.
+   * @param[in] renderToFboEnabled Whether rendering into the Frame Buffer Object is enabled (used to measure FPS above 60)
+   * @param[in] isRenderingToFbo   Whether this frame is being rendered into the Frame Buffer Object (used to measure FPS above 60)
+   * @return true if rendering should be kept, false otherwise.
+   */
+  bool Process(const std::vector<SceneRenderTasks>& scenes,
+               bool                                 renderToFboEnabled,
+               bool                                 isRenderingToFbo);
+
+  /**
+   * @brief Sets the thread pool used to process the scenes concurrently.
+   * @param[in] threadPool The thread pool, or nullptr to process the scenes on the calling thread only.
+   */
+  void SetThreadPool(Dali::ThreadPool* threadPool);
+
 private:
   /**
    * Undefine copy and assignment operators.
@@ -70,8 +105,25 @@ private:
   RenderTaskProcessor(const RenderTaskProcessor& renderTaskProcessor);            ///< No definition
   RenderTaskProcessor& operator=(const RenderTaskProcessor& renderTaskProcessor); ///< No definition
 
+private:
+  /**
+   * Process the list of render-tasks of a scene with the given RenderInstructionProcessor.
+   * @copydetails Process(RenderTaskList&, SortedLayerPointers&, RenderInstructionContainer&, bool, bool)
+   * @param[in] renderInstructionProcessor The RenderInstructionProcessor used to sort and handle the renderers for each layer.
+   */
+  bool Process(RenderTaskList&             renderTasks,
+               SortedLayerPointers&        sortedLayers,
+               RenderInstructionContainer& instructions,
+               bool                        renderToFboEnabled,
+               bool                        isRenderingToFbo,
+               RenderInstructionProcessor& renderInstructionProcessor);
+
 private:
   RenderInstructionProcessor mRenderInstructionProcessor; ///< An instance of the RenderInstructionProcessor used to sort and handle the renderers for each layer.
+
+  std::vector<std::unique_ptr<RenderInstructionProcessor>> mWorkerInstructionProcessors; ///< The RenderInstructionProcessor of each worker thread
+  std::vector<uint8_t>                                     mSceneKeepRendering;          ///< Whether rendering should be kept, for each scene processed concurrently
+  Dali::ThreadPool*                                        mThreadPool;                  ///< Thread pool for processing the scenes concurrently (not owned)
 };
 
 } // namespace SceneGraph
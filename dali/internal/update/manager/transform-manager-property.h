@@ -27,6 +27,36 @@ namespace Internal
 {
 namespace SceneGraph
 {
+/**
+ * Query whether the world matrix of a transform may have changed in the last update of the transform manager.
+ * A change of any component of the transform, e.g. its position or size, marks its world matrix dirty too.
+ * @param[in] transformManagerData The transform of the property
+ * @return False if the world matrix is known to be unchanged
+ */
+inline bool IsTransformWorldMatrixChanged(const TransformManagerData* transformManagerData)
+{
+  auto id = transformManagerData->Id();
+  if(!TransformManager::IsValidTransformId(id))
+  {
+    return true;
+  }
+
+  // The dirty flags of the last update which changed a world matrix are kept while the transform manager is clean
+  const TransformManager* manager = transformManagerData->Manager();
+  return manager->IsUpdated() && manager->IsWorldMatrixDirty(id);
+}
+
+/**
+ * Query whether a component of a transform, e.g. its position or size, may have changed in the last update of the transform manager.
+ * @param[in] transformManagerData The transform of the property
+ * @return False if the component is known to be unchanged
+ */
+inline bool IsTransformComponentChanged(const TransformManagerData* transformManagerData)
+{
+  // The world matrices of the transforms which are not on a scene are not updated, so their changes are unknown
+  return IsTransformWorldMatrixChanged(transformManagerData) || transformManagerData->Manager()->IsWorldIgnored(transformManagerData->Id());
+}
+
 template<typename T>
 struct TransformManagerPropertyHandler : public AnimatablePropertyBase
 {
@@ -195,6 +225,14 @@ struct TransformManagerPropertyVector3 final : public TransformManagerPropertyHa
     return Get();
   }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  bool InputChanged() const override
+  {
+    return IsTransformComponentChanged(GetTxManagerData());
+  }
+
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::GetValueAddress()
    */
@@ -298,6 +336,14 @@ public:
     return GetTxManagerData()->Manager()->GetQuaternionPropertyValue(GetTxManagerData()->Id());
   }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  bool InputChanged() const override
+  {
+    return IsTransformComponentChanged(GetTxManagerData());
+  }
+
   void Set(const Quaternion& value) override
   {
     return GetTxManagerData()->Manager()->SetQuaternionPropertyValue(GetTxManagerData()->Id(), value);
@@ -412,6 +458,22 @@ public:
    */
   ~TransformManagerVector3Input() override = default;
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  bool InputChanged() const override
+  {
+    return IsTransformWorldMatrixChanged(GetTxManagerData());
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::IsComputedWhenRead()
+   */
+  bool IsComputedWhenRead() const override
+  {
+    return true;
+  }
+
   /**
    * Helper function to get the transform components out of the world matrix.
    * It stores the value in the mValue member variable
@@ -514,6 +576,22 @@ public:
    */
   TransformManagerQuaternionInput() = default;
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  bool InputChanged() const override
+  {
+    return IsTransformWorldMatrixChanged(GetTxManagerData());
+  }
+
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::IsComputedWhenRead()
+   */
+  bool IsComputedWhenRead() const override
+  {
+    return true;
+  }
+
   /**
    * Helper function to get the orientation out of the world matrix.
    * It stores the result in the mValue member variable
@@ -609,6 +687,14 @@ public:
    */
   TransformManagerMatrixInput() = default;
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   */
+  bool InputChanged() const override
+  {
+    return IsTransformWorldMatrixChanged(GetTxManagerData());
+  }
+
   /**
    * @copydoc Dali::PropertyInput::GetMatrix()
    */
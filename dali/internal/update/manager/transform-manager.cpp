@@ -24,8 +24,10 @@
 #include <type_traits>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/internal/common/math.h>
 #include <dali/internal/common/matrix-utils.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/update/common/animatable-property.h> ///< for SET_FLAG and BAKE_FLAG
 #include <dali/public-api/common/constants.h>
 
@@ -53,6 +55,9 @@ static constexpr uint32_t STATIC_COMPONENT_FLAG = 0x01; ///< Indicates that the
 
 static constexpr uint16_t IGNORED_COMPONENTS_SCENE_ID = 0xffff; ///< Special marker for ignored components, which we move them as end of components.
 
+static constexpr uint32_t DEFAULT_PARALLEL_UPDATE_THRESHOLD = 8192u; ///< Below this number of valid components, the update is always serial.
+static constexpr uint32_t MINIMUM_COMPONENTS_PER_TASK       = 512u;  ///< Levels with fewer components than this per thread are updated by the calling thread.
+
 static constexpr TransformComponentBitField::FlagType DEFAULT_BIT_FILED_FLAGS = (static_cast<TransformComponentBitField::FlagType>(InheritanceMode::INHERIT_ALL) << TransformComponentBitField::INHERITANCE_MODE_SHIFT) |
                                                                                 (TransformComponentBitField::POSITION_USES_PIVOT_MASK << TransformComponentBitField::POSITION_USES_PIVOT_SHIFT);
 
@@ -232,6 +237,9 @@ inline void BakeTransfromPropertyIfChanged(T& current, T& base, TransformCompone
 TransformManager::TransformManager()
 : mComponentCount(0),
   mValidComponentCount(0),
+  mThreadPool(nullptr),
+  mParallelUpdateThreshold(DEFAULT_PARALLEL_UPDATE_THRESHOLD),
+  mChangeCount(0u),
   mDirtyFlags(CLEAN_FLAG),
   mReorder(false),
   mUpdated(false)
@@ -375,14 +383,44 @@ bool TransformManager::Update()
     mReorder = false;
   }
 
+  const bool parallel = mThreadPool && mThreadPool->GetWorkerCount() > 0u && mValidComponentCount >= mParallelUpdateThreshold;
+
   DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_TRANSFORM_UPDATE", [&](std::ostringstream& oss)
-  { oss << "[" << mComponentCount << ", i:" << (mComponentCount - mValidComponentCount) << "]"; });
+  { oss << "[" << mComponentCount << ", i:" << (mComponentCount - mValidComponentCount) << ", p:" << parallel << "]"; });
+
+  mUpdated = parallel ? UpdateComponentsParallel() : UpdateComponents(0u, mValidComponentCount);
+
+  mDirtyFlags >>= 1u; ///< age down.
+
+  if(mUpdated)
+  {
+    mChangeCount.fetch_add(1u, std::memory_order_release);
+  }
+
+  DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_TRANSFORM_UPDATE", [&](std::ostringstream& oss)
+  { oss << "[componentsChanged:" << mUpdated << "]"; });
+
+  return mUpdated;
+}
 
+void TransformManager::SetThreadPool(Dali::ThreadPool* threadPool)
+{
+  mThreadPool = threadPool;
+}
+
+void TransformManager::SetParallelUpdateThreshold(uint32_t componentCount)
+{
+  mParallelUpdateThreshold = componentCount;
+}
+
+bool TransformManager::UpdateComponents(uint32_t begin, uint32_t end)
+{
   // Iterate through all components to compute its world matrix
   Vector3 centerPosition;
   Vector3 localPosition;
   Matrix  localMatrix(false); ///< Temporal local matrix for apply transforms.
-  for(uint32_t i = 0; i < mValidComponentCount; ++i)
+  bool    updated = false;
+  for(uint32_t i = begin; i < end; ++i)
   {
     TransformComponentBitField::SetWorldMatrixDirtyBitField(mTxComponentBitField[i], false);
 
@@ -502,18 +540,70 @@ bool TransformManager::Update()
       mBoundingSpheres[i] = Vector4(mWorld[i].GetTranslation3(), centerToEdgeWorldSpace);
     }
 
-    mUpdated = mUpdated || worldMatrixDirty;
+    updated = updated || worldMatrixDirty;
 
     TransformComponentBitField::ComponentDirtyAging(mTxComponentBitField[i]);
     TransformComponentBitField::SetWorldMatrixDirtyBitField(mTxComponentBitField[i], worldMatrixDirty);
   }
 
-  mDirtyFlags >>= 1u; ///< age down.
+  return updated;
+}
 
-  DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_TRANSFORM_UPDATE", [&](std::ostringstream& oss)
-  { oss << "[componentsChanged:" << mUpdated << "]"; });
+bool TransformManager::UpdateComponentsParallel()
+{
+  const uint32_t workerCount = static_cast<uint32_t>(mThreadPool->GetWorkerCount());
 
-  return mUpdated;
+  std::vector<SharedFuture> futures;
+  std::vector<uint8_t>      taskUpdated(workerCount, 0u);
+  futures.reserve(workerCount);
+
+  bool updated = false;
+
+  // Components in the same (scene, level) group only depend on the previous groups, so each group
+  // can be split across the workers. Wait for the whole group before starting the next one.
+  const uint32_t groupCount = mLevelOffsets.Count() > 0u ? mLevelOffsets.Count() - 1u : 0u;
+  for(uint32_t group = 0u; group < groupCount; ++group)
+  {
+    const uint32_t begin = mLevelOffsets[group];
+    const uint32_t end   = mLevelOffsets[group + 1u];
+    const uint32_t count = end - begin;
+
+    const uint32_t taskCount = std::min(workerCount + 1u, count / MINIMUM_COMPONENTS_PER_TASK);
+    if(taskCount <= 1u)
+    {
+      updated = UpdateComponents(begin, end) || updated;
+      continue;
+    }
+
+    const uint32_t componentsPerTask = (count + taskCount - 1u) / taskCount;
+
+    // The calling thread takes the first chunk, the workers take the rest.
+    for(uint32_t task = 1u; task < taskCount; ++task)
+    {
+      const uint32_t taskBegin = begin + task * componentsPerTask;
+      const uint32_t taskEnd   = std::min(end, taskBegin + componentsPerTask);
+      uint8_t&       result    = taskUpdated[task - 1u];
+      futures.push_back(mThreadPool->SubmitTask(task - 1u, [this, taskBegin, taskEnd, &result](uint32_t)
+                                                {
+        result = UpdateComponents(taskBegin, taskEnd) ? 1u : 0u;
+        PERF_MONITOR_FLUSH_WORKER(); }));
+    }
+
+    updated = UpdateComponents(begin, begin + componentsPerTask) || updated;
+
+    for(auto& future : futures)
+    {
+      future->Wait();
+    }
+    futures.clear();
+
+    for(uint32_t task = 1u; task < taskCount; ++task)
+    {
+      updated = updated || taskUpdated[task - 1u];
+    }
+  }
+
+  return updated;
 }
 
 void TransformManager::SwapComponents(unsigned int i, unsigned int j)
@@ -619,6 +709,17 @@ void TransformManager::ReorderComponents()
 
   mValidComponentCount = mComponentCount - ignoredComponentCount;
 
+  // Keep the boundaries of each (scene, level) group for the parallel update.
+  mLevelOffsets.Clear();
+  for(uint32_t i = 0u; i < mValidComponentCount; ++i)
+  {
+    if(i == 0u || mOrderedComponents[i].sceneId != mOrderedComponents[i - 1u].sceneId || mOrderedComponents[i].level != mOrderedComponents[i - 1u].level)
+    {
+      mLevelOffsets.PushBack(i);
+    }
+  }
+  mLevelOffsets.PushBack(mValidComponentCount);
+
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
   // Since Resize() operation will make overhead when we create new Transform::Data, let we check shrink to fit trigger like this.
   if(DALI_UNLIKELY(static_cast<decltype(mTxComponentAnimatable)::SizeType>(mComponentCount) * Dali::VectorBase::SHRINK_REQUIRED_RATIO < mTxComponentAnimatable.Capacity()))
@@ -652,6 +753,7 @@ void TransformManager::ReorderComponents()
     mTxComponentAnimatableBaseValue.ShrinkToFit();
     mSizeBase.ShrinkToFit();
     mOrderedComponents.ShrinkToFit();
+    mLevelOffsets.ShrinkToFit();
   }
 #endif
 }
@@ -1096,6 +1198,99 @@ void TransformManager::BakeZVector3PropertyValue(TransformId id, TransformManage
   }
 }
 
+void TransformManager::GetVector3PropertyValues(const TransformId* ids, uint32_t count, TransformManagerProperty property, Vector3* values) const
+{
+  DALI_ASSERT_ALWAYS(property == TRANSFORM_PROPERTY_POSITION || property == TRANSFORM_PROPERTY_SCALE || property == TRANSFORM_PROPERTY_SIZE);
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    if(ids[i] != INVALID_TRANSFORM_ID)
+    {
+      const TransformId index(mIds[ids[i]]);
+      switch(property)
+      {
+        case TRANSFORM_PROPERTY_POSITION:
+        {
+          values[i] = mTxComponentAnimatable[index].mPosition;
+          break;
+        }
+        case TRANSFORM_PROPERTY_SCALE:
+        {
+          values[i] = mTxComponentAnimatable[index].mScale;
+          break;
+        }
+        default:
+        {
+          values[i] = mSize[index];
+          break;
+        }
+      }
+    }
+  }
+}
+
+void TransformManager::SetVector3PropertyValues(const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values)
+{
+  DALI_ASSERT_ALWAYS(property == TRANSFORM_PROPERTY_POSITION || property == TRANSFORM_PROPERTY_SCALE || property == TRANSFORM_PROPERTY_SIZE);
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    if(ids[i] != INVALID_TRANSFORM_ID)
+    {
+      const TransformId index(mIds[ids[i]]);
+      switch(property)
+      {
+        case TRANSFORM_PROPERTY_POSITION:
+        {
+          SetTransfromProperty(mTxComponentAnimatable[index].mPosition, mTxComponentBitField[index], mDirtyFlags, values[i]);
+          break;
+        }
+        case TRANSFORM_PROPERTY_SCALE:
+        {
+          SetTransfromProperty(mTxComponentAnimatable[index].mScale, mTxComponentBitField[index], mDirtyFlags, values[i]);
+          break;
+        }
+        default:
+        {
+          SetTransfromProperty(mSize[index], mTxComponentBitField[index], mDirtyFlags, values[i]);
+          break;
+        }
+      }
+    }
+  }
+}
+
+void TransformManager::BakeVector3PropertyValues(const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values)
+{
+  DALI_ASSERT_ALWAYS(property == TRANSFORM_PROPERTY_POSITION || property == TRANSFORM_PROPERTY_SCALE || property == TRANSFORM_PROPERTY_SIZE);
+
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    if(ids[i] != INVALID_TRANSFORM_ID)
+    {
+      const TransformId index(mIds[ids[i]]);
+      switch(property)
+      {
+        case TRANSFORM_PROPERTY_POSITION:
+        {
+          BakeTransfromProperty(mTxComponentAnimatable[index].mPosition, mTxComponentAnimatableBaseValue[index].mPosition, mTxComponentBitField[index], mDirtyFlags, values[i]);
+          break;
+        }
+        case TRANSFORM_PROPERTY_SCALE:
+        {
+          BakeTransfromProperty(mTxComponentAnimatable[index].mScale, mTxComponentAnimatableBaseValue[index].mScale, mTxComponentBitField[index], mDirtyFlags, values[i]);
+          break;
+        }
+        default:
+        {
+          BakeTransfromProperty(mSize[index], mSizeBase[index], mTxComponentBitField[index], mDirtyFlags, values[i]);
+          break;
+        }
+      }
+    }
+  }
+}
+
 Quaternion& TransformManager::GetQuaternionPropertyValue(TransformId id)
 {
   return mTxComponentAnimatable[mIds[id]].mOrientation;
@@ -1138,6 +1333,17 @@ void TransformManager::GetWorldMatrixAndSize(TransformId id, Matrix& worldMatrix
   size              = mSize[index];
 }
 
+void TransformManager::GetWorldMatrices(const TransformId* ids, uint32_t count, Matrix* worldMatrices) const
+{
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    if(ids[i] != INVALID_TRANSFORM_ID)
+    {
+      worldMatrices[i] = mWorld[mIds[ids[i]]];
+    }
+  }
+}
+
 void TransformManager::SetPositionUsesPivot(TransformId id, bool value)
 {
   TransformId index(mIds[id]);
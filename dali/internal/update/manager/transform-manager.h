@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <atomic>
+
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/free-list.h>
 #include <dali/public-api/common/constants.h>
@@ -28,6 +31,8 @@
 
 namespace Dali
 {
+class ThreadPool;
+
 namespace Internal
 {
 namespace SceneGraph
@@ -312,6 +317,16 @@ public:
     return TransformComponentBitField::IsWorldMatrixDirtyBitField(mTxComponentBitField[mIds[id]]);
   }
 
+  /**
+   * Checks if any world transform was updated in the last Update
+   * @note Update() skips the components when none of them is dirty, without clearing their world matrix dirty flags.
+   * @return true if any world matrix changed in the last update, false otherwise
+   */
+  bool IsUpdated() const
+  {
+    return mUpdated;
+  }
+
   /**
    * Sets position inheritance mode.
    * @param[in] id Id of the transform
@@ -335,10 +350,34 @@ public:
 
   /**
    * Recomputes all world transform matrices
+   * @note If a thread pool has been set and the number of valid components reaches the parallel update threshold,
+   * each hierarchy level is split across the worker threads. The result is identical to the serial update.
    * @return true if any component has been changed in this frame, false otherwise
    */
   bool Update();
 
+  /**
+   * @brief Sets the thread pool used to compute the world matrices in parallel.
+   * @param[in] threadPool The thread pool to use, or nullptr to always update serially. Not owned.
+   */
+  void SetThreadPool(Dali::ThreadPool* threadPool);
+
+  /**
+   * @brief Sets the minimum number of valid components required to use the parallel update.
+   * @param[in] componentCount The threshold. Scenes smaller than this are always updated serially.
+   */
+  void SetParallelUpdateThreshold(uint32_t componentCount);
+
+  /**
+   * @brief Retrieves the number of updates which have changed a world matrix or a size.
+   * @note This may be read from the event-thread, to know whether the data cached from the world matrices is out of date.
+   * @return The change count
+   */
+  uint32_t GetChangeCount() const
+  {
+    return mChangeCount.load(std::memory_order_acquire);
+  }
+
   /**
    * Resets all the animatable properties to its base value
    */
@@ -439,6 +478,33 @@ public:
    */
   void BakeZVector3PropertyValue(TransformId id, TransformManagerProperty property, float value);
 
+  /**
+   * Gets the values of a Vector3 property of several components
+   * @param[in] ids Ids of the transform components. INVALID_TRANSFORM_ID entries are skipped
+   * @param[in] count Number of ids
+   * @param[in] property The property. Only position, scale and size are supported
+   * @param[out] values Array of count values, in the order of ids
+   */
+  void GetVector3PropertyValues(const TransformId* ids, uint32_t count, TransformManagerProperty property, Vector3* values) const;
+
+  /**
+   * Sets the values of a Vector3 property of several components
+   * @param[in] ids Ids of the transform components. INVALID_TRANSFORM_ID entries are skipped
+   * @param[in] count Number of ids
+   * @param[in] property The property. Only position, scale and size are supported
+   * @param[in] values Array of count values, in the order of ids
+   */
+  void SetVector3PropertyValues(const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values);
+
+  /**
+   * Bakes the values of a Vector3 property of several components
+   * @param[in] ids Ids of the transform components. INVALID_TRANSFORM_ID entries are skipped
+   * @param[in] count Number of ids
+   * @param[in] property The property. Only position, scale and size are supported
+   * @param[in] values Array of count values, in the order of ids
+   */
+  void BakeVector3PropertyValues(const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values);
+
   /**
    * Get the value of a quaternion property
    * @param[in] id Id of the transform component
@@ -479,6 +545,14 @@ public:
    */
   const Vector4& GetBoundingSphere(TransformId id) const;
 
+  /**
+   * Gets the world transform matrices of several components
+   * @param[in] ids Ids of the transform components. INVALID_TRANSFORM_ID entries are skipped
+   * @param[in] count Number of ids
+   * @param[out] worldMatrices Array of count matrices, in the order of ids
+   */
+  void GetWorldMatrices(const TransformId* ids, uint32_t count, Matrix* worldMatrices) const;
+
   /**
    * Get the world matrix and size of a given component
    * @param[in] id Id of the transform component
@@ -556,6 +630,21 @@ private:
    */
   void ReorderComponents();
 
+  /**
+   * Computes the world matrix and bounding sphere of the components in [begin, end).
+   * @pre The parents of all the components in the range have already been updated.
+   * @param[in] begin Index of the first component
+   * @param[in] end Index after the last component
+   * @return true if any world matrix in the range changed, false otherwise
+   */
+  bool UpdateComponents(uint32_t begin, uint32_t end);
+
+  /**
+   * Computes the world matrices level by level, splitting each level across the worker threads.
+   * @return true if any world matrix changed, false otherwise
+   */
+  bool UpdateComponentsParallel();
+
   uint32_t mComponentCount;      ///< Total number of components
   uint32_t mValidComponentCount; ///< Total number of valid components
 
@@ -572,6 +661,12 @@ private:
   Vector<Vector3>                              mSizeBase;                       ///< Base value for the size of the components
 
   Vector<SOrderItem> mOrderedComponents; ///< Used to reorder components when hierarchy changes
+  Vector<uint32_t>   mLevelOffsets;      ///< Start index of each (scene, level) group of valid components, terminated by mValidComponentCount
+
+  Dali::ThreadPool* mThreadPool;              ///< Thread pool for the parallel update (not owned)
+  uint32_t          mParallelUpdateThreshold; ///< Minimum number of valid components to update in parallel
+
+  std::atomic<uint32_t> mChangeCount; ///< Incremented after each update which changed a component
 
   uint8_t mDirtyFlags;  ///< Dirty flags for all transform components. Age down at Update time.
   bool    mReorder : 1; ///< Flag to determine if the components have to reordered in the next Update
@@ -25,6 +25,7 @@
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
 #include <dali/internal/update/animation/scene-graph-constraint-container.h>
+#include <dali/internal/update/animation/scene-graph-constraint-scheduler.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/public-api/actors/actor-enumerations.h>
@@ -82,52 +83,145 @@ inline void UpdateNodeOpacity(Node& node, NodePropertyFlags nodeDirtyFlags)
   }
 }
 
-/**
- * This is called recursively for all children of the root Node
- */
-inline NodePropertyFlags UpdateNodes(Node&                   node,
-                                     NodePropertyFlags       parentFlags,
-                                     PropertyOwnerContainer& postPropertyOwners,
-                                     bool                    updated)
+/******************************************************************************
+ ************************** Flattened node tree *******************************
+ ******************************************************************************/
+
+void FlattenedNodeTree::Update(Layer& rootNode)
 {
-  if(node.IsIgnored()) // Do nothing if ignored.
+  if(!mDirty)
   {
-    return NodePropertyFlags::NOTHING;
+    return;
   }
+  mDirty = false;
 
-  // Apply constraints to the node
-  ConstrainPropertyOwner(node, true, postPropertyOwners);
+  mEntries.clear();
+  mEntries.push_back({&rootNode, &rootNode, 0u, 0u, NodePropertyFlags::NOTHING, false});
 
-  // Some dirty flags are inherited from parent
-  NodePropertyFlags nodeDirtyFlags = node.GetDirtyFlags() | node.GetInheritedDirtyFlags(parentFlags);
+  // Children are pushed in reverse order, so that they are visited in their container order
+  mPendingNodes.clear();
+  NodeContainer& rootChildren = rootNode.GetChildren();
+  for(auto iter = rootChildren.End(); iter != rootChildren.Begin();)
+  {
+    --iter;
+    mPendingNodes.emplace_back(*iter, 0u);
+  }
 
-  NodePropertyFlags cumulativeDirtyFlags = nodeDirtyFlags;
+  while(!mPendingNodes.empty())
+  {
+    const auto [node, parentIndex] = mPendingNodes.back();
+    mPendingNodes.pop_back();
 
-  UpdateNodeOpacity(node, nodeDirtyFlags);
+    const uint32_t index = static_cast<uint32_t>(mEntries.size());
+    mEntries.push_back({node, nullptr, parentIndex, 0u, NodePropertyFlags::NOTHING, false});
 
-  // Age down partial update data
-  node.GetPartialRenderingData().Aging();
+    NodeContainer& children = node->GetChildren();
+    for(auto iter = children.End(); iter != children.Begin();)
+    {
+      --iter;
+      mPendingNodes.emplace_back(*iter, index);
+    }
+  }
 
-  // For partial update, mark all children of an animating node as updated.
-  if(updated) // Only set to updated if parent was updated.
+  // Descendants are stored after their parent, so a backward pass completes every subtree before its parent.
+  const uint32_t count = static_cast<uint32_t>(mEntries.size());
+  for(uint32_t index = count; index > 0u;)
   {
-    node.SetUpdated(true);
+    --index;
+    Entry& entry = mEntries[index];
+    entry.subtreeEnd = std::max(entry.subtreeEnd, index + 1u);
+    if(index > 0u)
+    {
+      Entry& parent     = mEntries[entry.parentIndex];
+      parent.subtreeEnd = std::max(parent.subtreeEnd, entry.subtreeEnd);
+    }
   }
-  else if(node.Updated()) // Only propagate updated==true downwards.
+}
+
+/**
+ * Applies the constraints of all the descendants of the root node in one go, in depth-first order.
+ * @return True if the constraints have been applied, false if they must be applied by UpdateNodes()
+ */
+inline bool ConstrainNodes(FlattenedNodeTree::Entry* entries,
+                           uint32_t                  count,
+                           ConstraintScheduler&      constraintScheduler)
+{
+  for(uint32_t index = 1u; index < count;)
   {
-    updated = true;
+    FlattenedNodeTree::Entry& entry = entries[index];
+    Node&                     node  = *entry.node;
+
+    if(node.IsIgnored())
+    {
+      index = entry.subtreeEnd;
+      continue;
+    }
+
+    constraintScheduler.Add(node.GetConstraints());
+    ++index;
   }
 
-  // recurse children
-  NodeContainer& children = node.GetChildren();
-  const NodeIter endIter  = children.End();
-  for(NodeIter iter = children.Begin(); iter != endIter; ++iter)
+  return constraintScheduler.Apply();
+}
+
+/**
+ * Updates all the descendants of the root node, in depth-first order.
+ * The dirty flags of the root must have been stored in the first entry.
+ */
+inline NodePropertyFlags UpdateNodes(FlattenedNodeTree::Entry* entries,
+                                     uint32_t                  count,
+                                     bool                      constraintsApplied,
+                                     PropertyOwnerContainer&   postPropertyOwners)
+{
+  NodePropertyFlags cumulativeDirtyFlags = NodePropertyFlags::NOTHING;
+
+  for(uint32_t index = 1u; index < count;)
   {
-    Node& child = **iter;
-    cumulativeDirtyFlags |= UpdateNodes(child,
-                                        nodeDirtyFlags,
-                                        postPropertyOwners,
-                                        updated);
+    FlattenedNodeTree::Entry& entry = entries[index];
+    Node&                     node  = *entry.node;
+
+    if(node.IsIgnored()) // Do nothing if ignored, nor for the descendants.
+    {
+      index = entry.subtreeEnd;
+      continue;
+    }
+
+    const FlattenedNodeTree::Entry& parent = entries[entry.parentIndex];
+
+    // Apply constraints to the node
+    if(!constraintsApplied)
+    {
+      ConstrainPropertyOwner(node, true, postPropertyOwners);
+    }
+    else if(node.GetPostConstraintsActivatedCount() > 0u)
+    {
+      postPropertyOwners.PushBack(&node);
+    }
+
+    // Some dirty flags are inherited from parent
+    NodePropertyFlags nodeDirtyFlags = node.GetDirtyFlags() | node.GetInheritedDirtyFlags(parent.dirtyFlags);
+
+    cumulativeDirtyFlags |= nodeDirtyFlags;
+
+    UpdateNodeOpacity(node, nodeDirtyFlags);
+
+    // Age down partial update data
+    node.GetPartialRenderingData().Aging();
+
+    // For partial update, mark all children of an animating node as updated.
+    bool updated = parent.updated;
+    if(updated) // Only set to updated if parent was updated.
+    {
+      node.SetUpdated(true);
+    }
+    else if(node.Updated()) // Only propagate updated==true downwards.
+    {
+      updated = true;
+    }
+
+    entry.dirtyFlags = nodeDirtyFlags;
+    entry.updated    = updated;
+    ++index;
   }
 
   return cumulativeDirtyFlags;
@@ -137,6 +231,8 @@ inline NodePropertyFlags UpdateNodes(Node&                   node,
  * The root node is treated separately; it cannot inherit values since it has no parent
  */
 NodePropertyFlags UpdateNodeTree(Layer&                  rootNode,
+                                 FlattenedNodeTree&      nodeTree,
+                                 ConstraintScheduler*    constraintScheduler,
                                  PropertyOwnerContainer& postPropertyOwners)
 {
   DALI_ASSERT_DEBUG(rootNode.IsRoot());
@@ -163,98 +259,116 @@ NodePropertyFlags UpdateNodeTree(Layer&                  rootNode,
   // Age down partial update data
   rootNode.GetPartialRenderingData().Aging();
 
-  bool updated = rootNode.Updated();
+  nodeTree.Update(rootNode);
+  auto& entries = nodeTree.GetEntries();
 
-  // recurse children
-  NodeContainer& children = rootNode.GetChildren();
-  const NodeIter endIter  = children.End();
-  for(NodeIter iter = children.Begin(); iter != endIter; ++iter)
-  {
-    Node& child = **iter;
-    cumulativeDirtyFlags |= UpdateNodes(child,
-                                        nodeDirtyFlags,
-                                        postPropertyOwners,
-                                        updated);
-  }
+  entries[0].dirtyFlags = nodeDirtyFlags;
+  entries[0].updated    = rootNode.Updated();
+
+  const uint32_t count              = static_cast<uint32_t>(entries.size());
+  const bool     constraintsApplied = constraintScheduler && constraintScheduler->IsEnabled() && ConstrainNodes(entries.data(), count, *constraintScheduler);
+
+  cumulativeDirtyFlags |= UpdateNodes(entries.data(), count, constraintsApplied, postPropertyOwners);
 
   return cumulativeDirtyFlags;
 }
 
-inline void UpdateLayers(Node&             node,
-                         NodePropertyFlags parentFlags,
-                         Layer&            currentLayer)
+/**
+ * Updates the reusability flags and the world matrix change counts of the layers of all the descendants of the root layer, in depth-first order.
+ * The dirty flags and the layer of the root must have been stored in the first entry.
+ */
+inline void UpdateLayers(FlattenedNodeTree::Entry* entries,
+                         uint32_t                  count,
+                         uint32_t                  transformChangeCount)
 {
-  if(node.IsIgnored()) // Do nothing if ignored.
+  for(uint32_t index = 1u; index < count;)
   {
-    return;
-  }
+    FlattenedNodeTree::Entry& entry = entries[index];
+    Node&                     node  = *entry.node;
 
-  // Some dirty flags are inherited from parent
-  NodePropertyFlags nodeDirtyFlags = node.GetDirtyFlags() | node.GetInheritedDirtyFlags(parentFlags);
-  nodeDirtyFlags |= (node.IsWorldMatrixDirty() ? NodePropertyFlags::TRANSFORM : NodePropertyFlags::NOTHING);
+    if(node.IsIgnored()) // Do nothing if ignored, nor for the descendants.
+    {
+      index = entry.subtreeEnd;
+      continue;
+    }
 
-  Layer* nodeIsLayer(node.GetLayer());
-  Layer* layer = nodeIsLayer ? nodeIsLayer : &currentLayer;
-  if(nodeIsLayer)
-  {
-    layer->SetReuseRenderers(true);
-  }
-  DALI_ASSERT_DEBUG(nullptr != layer);
+    const FlattenedNodeTree::Entry& parent = entries[entry.parentIndex];
 
-  // if any child node has moved or had its sort modifier changed, layer is not clean and old frame cannot be reused
-  // also if node has been deleted, dont reuse old render items
-  if(layer->GetReuseRenderers())
-  {
-    if(nodeDirtyFlags != NodePropertyFlags::NOTHING)
+    // Some dirty flags are inherited from parent
+    const bool        worldMatrixDirty = node.IsWorldMatrixDirty();
+    NodePropertyFlags nodeDirtyFlags   = node.GetDirtyFlags() | node.GetInheritedDirtyFlags(parent.dirtyFlags);
+    nodeDirtyFlags |= (worldMatrixDirty ? NodePropertyFlags::TRANSFORM : NodePropertyFlags::NOTHING);
+
+    Layer* nodeIsLayer(node.GetLayer());
+    Layer* layer = nodeIsLayer ? nodeIsLayer : parent.layer;
+    if(nodeIsLayer)
     {
-      layer->SetReuseRenderers(false);
+      layer->SetReuseRenderers(true);
     }
-    else
+    DALI_ASSERT_DEBUG(nullptr != layer);
+
+    if(worldMatrixDirty)
+    {
+      layer->SetWorldMatrixChangeCount(transformChangeCount);
+    }
+
+    // if any child node has moved or had its sort modifier changed, layer is not clean and old frame cannot be reused
+    // also if node has been deleted, dont reuse old render items
+    if(layer->GetReuseRenderers())
     {
-      // If the node is not dirty, then check renderers
-      const uint32_t count = node.GetRendererCount();
-      for(uint32_t i = 0; i < count; ++i)
+      if(nodeDirtyFlags != NodePropertyFlags::NOTHING)
       {
-        SceneGraph::RendererKey renderer = node.GetRendererAt(i);
-        if(renderer->IsDirty())
+        layer->SetReuseRenderers(false);
+      }
+      else
+      {
+        // If the node is not dirty, then check renderers
+        const uint32_t rendererCount = node.GetRendererCount();
+        for(uint32_t i = 0; i < rendererCount; ++i)
         {
-          layer->SetReuseRenderers(false);
-          break;
+          SceneGraph::RendererKey renderer = node.GetRendererAt(i);
+          if(renderer->IsDirty())
+          {
+            layer->SetReuseRenderers(false);
+            break;
+          }
         }
       }
     }
-  }
 
-  // recurse children
-  NodeContainer& children = node.GetChildren();
-  const NodeIter endIter  = children.End();
-  for(NodeIter iter = children.Begin(); iter != endIter; ++iter)
-  {
-    Node& child = **iter;
-    UpdateLayers(child, nodeDirtyFlags, *layer);
+    entry.dirtyFlags = nodeDirtyFlags;
+    entry.layer      = layer;
+    ++index;
   }
 }
 
-void UpdateLayerTree(Layer& layer)
+void UpdateLayerTree(Layer& layer, FlattenedNodeTree& nodeTree)
 {
   if(DALI_UNLIKELY(layer.IsIgnored())) // almost never ever true
   {
     return;
   }
 
+  // The world matrix dirty flags are kept while the transform manager is clean, and then the change count is unchanged too
+  const uint32_t transformChangeCount = layer.GetTransformChangeCount();
+  const bool     worldMatrixDirty     = layer.IsWorldMatrixDirty();
+
   NodePropertyFlags nodeDirtyFlags = layer.GetDirtyFlags();
-  nodeDirtyFlags |= (layer.IsWorldMatrixDirty() ? NodePropertyFlags::TRANSFORM : NodePropertyFlags::NOTHING);
+  nodeDirtyFlags |= (worldMatrixDirty ? NodePropertyFlags::TRANSFORM : NodePropertyFlags::NOTHING);
 
   layer.SetReuseRenderers(nodeDirtyFlags == NodePropertyFlags::NOTHING);
-
-  // recurse children
-  NodeContainer& children = layer.GetChildren();
-  const NodeIter endIter  = children.End();
-  for(NodeIter iter = children.Begin(); iter != endIter; ++iter)
+  if(worldMatrixDirty)
   {
-    Node& child = **iter;
-    UpdateLayers(child, nodeDirtyFlags, layer);
+    layer.SetWorldMatrixChangeCount(transformChangeCount);
   }
+
+  nodeTree.Update(layer);
+  auto& entries = nodeTree.GetEntries();
+
+  entries[0].dirtyFlags = nodeDirtyFlags;
+  entries[0].layer      = &layer;
+
+  UpdateLayers(entries.data(), static_cast<uint32_t>(entries.size()), transformChangeCount);
 }
 
 } // namespace SceneGraph
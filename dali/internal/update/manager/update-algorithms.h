@@ -18,6 +18,11 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/internal/update/nodes/node-declarations.h>
 
@@ -27,6 +32,7 @@ namespace Internal
 {
 namespace SceneGraph
 {
+class ConstraintScheduler;
 class Layer;
 class PropertyOwner;
 
@@ -40,22 +46,76 @@ using PropertyOwnerContainer = Dali::Vector<PropertyOwner*>;
  */
 void ConstrainPropertyOwner(PropertyOwner& propertyOwner, bool isPreConstraint, PropertyOwnerContainer& postPropertyOwners);
 
+/**
+ * The nodes of a scene stored in depth-first order, so that they can be updated
+ * by linear passes rather than by recursing through the children containers.
+ * It must be marked dirty whenever the hierarchy changes; it is then rebuilt before its next use.
+ */
+class FlattenedNodeTree
+{
+public:
+  /**
+   * An entry per node. Parents are always stored before their descendants.
+   */
+  struct Entry
+  {
+    Node*             node;        ///< The node
+    Layer*            layer;       ///< The layer the node belongs to. Only valid during UpdateLayerTree()
+    uint32_t          parentIndex; ///< The index of the parent entry. The root entry is its own parent
+    uint32_t          subtreeEnd;  ///< The index after the last descendant of the node
+    NodePropertyFlags dirtyFlags;  ///< The dirty flags inherited by the children. Only valid during a traversal
+    bool              updated;     ///< Whether the children have to be marked as updated. Only valid during UpdateNodeTree()
+  };
+
+  /**
+   * Marks the tree to be rebuilt before its next use.
+   */
+  void SetDirty()
+  {
+    mDirty = true;
+  }
+
+  /**
+   * Rebuilds the entries if the hierarchy has changed since the last call.
+   * @param[in] rootNode The root of the tree
+   */
+  void Update(Layer& rootNode);
+
+  /**
+   * @return The entries, the first of which is the root
+   */
+  std::vector<Entry>& GetEntries()
+  {
+    return mEntries;
+  }
+
+private:
+  std::vector<Entry>                      mEntries;      ///< The nodes in depth-first order
+  std::vector<std::pair<Node*, uint32_t>> mPendingNodes; ///< Nodes to visit and their parent index, used while rebuilding
+  bool                                    mDirty{true};  ///< Whether the entries have to be rebuilt
+};
+
 /**
  * Update a tree of nodes
  * The inherited properties of each node are recalculated if necessary.
  * @param[in] rootNode The root of a tree of nodes.
+ * @param[in,out] nodeTree The flattened tree of the root node.
+ * @param[in] constraintScheduler Applies the constraints of the nodes in parallel if enabled, or nullptr.
  * @param[out] postPropertyOwner property owners those have post constraint.
  * @return The cumulative (ORed) dirty flags for the updated nodes
  */
 NodePropertyFlags UpdateNodeTree(Layer&                  rootNode,
+                                 FlattenedNodeTree&      nodeTree,
+                                 ConstraintScheduler*    constraintScheduler,
                                  PropertyOwnerContainer& postPropertyOwners);
 /**
  * This updates all the sub-layer's reusability flags without affecting
  * the root layer.
  *
  * @param layer The root layer
+ * @param[in,out] nodeTree The flattened tree of the root layer.
  */
-void UpdateLayerTree(Layer& layer);
+void UpdateLayerTree(Layer& layer, FlattenedNodeTree& nodeTree);
 
 } // namespace SceneGraph
 
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/set-wrapper.h>
 #include <algorithm>
+#include <memory>
 
 #if defined(LOW_SPEC_MEMORY_MANAGEMENT_ENABLED)
 #include <dali/devel-api/common/map-wrapper.h>
@@ -30,9 +31,11 @@
 #endif
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/trace.h>
 
+#include <dali/internal/common/environment-variable.h>
 #include <dali/internal/common/owner-key-container.h>
 
 #include <dali/internal/event/animation/animation-playlist.h>
@@ -40,6 +43,8 @@
 #include <dali/internal/event/common/property-notifier.h>
 #include <dali/internal/event/effects/shader-factory.h>
 
+#include <dali/internal/update/animation/scene-graph-animator-scheduler.h>
+#include <dali/internal/update/animation/scene-graph-constraint-scheduler.h>
 #include <dali/internal/update/common/discard-queue.h>
 #include <dali/internal/update/common/scene-graph-memory-pool-collection.h>
 #include <dali/internal/update/controllers/render-manager-dispatcher.h>
@@ -52,6 +57,7 @@
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/queue/update-message-queue.h>
 
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-manager.h>
 #include <dali/internal/render/renderers/render-uniform-block.h>
 #include <dali/internal/render/renderers/render-vertex-buffer.h>
@@ -90,6 +96,17 @@ namespace
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_UPDATE_PROCESS, false);
 
 DALI_INIT_TIME_CHECKER_FILTER_WITH_DEFAULT_THRESHOLD(gTimeCheckerFilter, DALI_UPDATE_PROCESS_THRESHOLD_TIME, 48);
+
+constexpr const char* UPDATE_WORKER_THREAD_COUNT_ENV = "DALI_UPDATE_WORKER_THREAD_COUNT"; ///< Number of worker threads used by the parallel update. 0 or unset disables it.
+
+/**
+ * @brief Reads the number of update worker threads from the environment.
+ * @return The number of worker threads, or 0 if the parallel update is disabled.
+ */
+uint32_t GetUpdateWorkerThreadCount()
+{
+  return Dali::Internal::EnvironmentVariable::GetUnsignedIntegerValue(UPDATE_WORKER_THREAD_COUNT_ENV, 0u);
+}
 } // namespace
 
 using namespace Dali::Integration;
@@ -199,6 +216,7 @@ struct UpdateManager::Impl
     OwnerPointer<RenderTaskList> taskList;        ///< Scene graph render task list
     SortedLayerPointers          sortedLayerList; ///< List of Layer pointers sorted by depth (one list of sorted layers per root)
     OwnerPointer<Scene>          scene;           ///< Scene graph object of the scene
+    FlattenedNodeTree            nodeTree;        ///< The nodes of the scene in depth-first order
   };
 
   Impl(NotificationManager&           notificationManager,
@@ -241,6 +259,23 @@ struct UpdateManager::Impl
   {
     // create first 'dummy' node
     nodes.PushBack(nullptr);
+
+    const uint32_t workerThreadCount = GetUpdateWorkerThreadCount();
+    if(workerThreadCount > 0u)
+    {
+      threadPool = std::make_unique<Dali::ThreadPool>();
+      if(threadPool->Initialize(workerThreadCount))
+      {
+        transformManager.SetThreadPool(threadPool.get());
+        renderTaskProcessor.SetThreadPool(threadPool.get());
+        constraintScheduler.SetThreadPool(threadPool.get());
+        animatorScheduler.SetThreadPool(threadPool.get());
+      }
+      else
+      {
+        threadPool.reset();
+      }
+    }
   }
 
   ~Impl()
@@ -248,6 +283,13 @@ struct UpdateManager::Impl
     // Ensure to scene context destroyed.
     ContextDestroyed();
 
+    // Stop the workers before any of the data they could touch is destroyed
+    transformManager.SetThreadPool(nullptr);
+    renderTaskProcessor.SetThreadPool(nullptr);
+    constraintScheduler.SetThreadPool(nullptr);
+    animatorScheduler.SetThreadPool(nullptr);
+    threadPool.reset();
+
     // Disconnect render tasks from nodes, before destroying the nodes
     for(auto&& scene : scenes)
     {
@@ -325,6 +367,22 @@ struct UpdateManager::Impl
     }
   }
 
+  /**
+   * @brief Marks the flattened node trees of all the scenes to be rebuilt.
+   *
+   * @note Should be called whenever a node is connected or disconnected.
+   */
+  void NodeHierarchyChanged()
+  {
+    for(auto&& scene : scenes)
+    {
+      if(scene)
+      {
+        scene->nodeTree.SetDirty();
+      }
+    }
+  }
+
   RenderManagerDispatcher        renderManagerDispatcher; ///< Used for passing functions to the render-manager
   NotificationManager&           notificationManager;     ///< Queues notification messages for the event-thread.
   TransformManager               transformManager;        ///< Used to update the transformation matrices of the nodes
@@ -368,6 +426,8 @@ struct UpdateManager::Impl
   OwnerContainer<Shader*>               shaders;               ///< A container of owned shaders
   OwnerContainer<Render::UniformBlock*> uniformBlocks;         ///< A container of owned uniformBlocks
 
+  std::unordered_map<const PropertyInputImpl*, bool> propertyInputChanged; ///< Whether each notified property has changed in the current frame; only valid in ProcessPropertyNotifications()
+
   DiscardQueue<Node*, OwnerContainer<Node*>>                                 nodeDiscardQueue; ///< Nodes are added here when disconnected from the scene-graph.
   DiscardQueue<Shader*, OwnerContainer<Shader*>>                             shaderDiscardQueue;
   DiscardQueue<Render::UniformBlock*, OwnerContainer<Render::UniformBlock*>> uniformBlockDiscardQueue;
@@ -377,12 +437,21 @@ struct UpdateManager::Impl
 
   std::vector<PropertyOwner*> updatedPropertyOwnerContainer; ///< List of updated property owner (not owned)
 
+  std::vector<RenderTaskProcessor::SceneRenderTasks> sceneRenderTasks; ///< The render-tasks of the scenes to process at the current frame
+
   CompleteNotificationInterface::ParameterList notifyRequiredAnimations; ///< A temperal container of complete notify required animations, like animation finished, stopped, or loop completed.
 
   OwnerPointer<PanGesture> panGestureProcessor; ///< Owned pan gesture processor; it lives for the lifecycle of UpdateManager
 
   MessageQueue messageQueue; ///< The messages queued from the event-thread
 
+  OwnerPointer<NodeBatch> nodeBatch;         ///< The batch collected by the event-thread
+  uint32_t                nodeBatchDepth{0}; ///< The number of nested BeginNodeBatch() calls; event-thread only
+
+  std::unique_ptr<Dali::ThreadPool> threadPool;          ///< Worker threads for the parallel update, only created if DALI_UPDATE_WORKER_THREAD_COUNT is set
+  ConstraintScheduler               constraintScheduler; ///< Applies the constraints of the nodes and custom objects on the worker threads, if enabled
+  AnimatorScheduler                 animatorScheduler;   ///< Updates the animators of all the animations on the worker threads, if enabled
+
   OwnerPointer<FrameCallbackProcessor> frameCallbackProcessor; ///< Owned FrameCallbackProcessor, only created if required.
 
   std::atomic<std::size_t>       renderInstructionCapacity{0u};
@@ -537,6 +606,18 @@ void UpdateManager::AddNode(OwnerPointer<Node>& node)
   rawNode->CreateTransform(&mImpl->transformManager);
 }
 
+void UpdateManager::InstallNodeBatch(OwnerPointer<NodeBatch>& batch)
+{
+  auto& nodes = batch->GetNodes();
+  mImpl->nodes.Reserve(mImpl->nodes.Count() + nodes.size());
+  for(auto& node : nodes)
+  {
+    AddNode(node);
+  }
+
+  batch->ProcessMessages();
+}
+
 void UpdateManager::ConnectNode(Node* parent, Node* node)
 {
   DALI_ASSERT_ALWAYS(nullptr != parent);
@@ -550,6 +631,8 @@ void UpdateManager::ConnectNode(Node* parent, Node* node)
 
   node->AddInitializeResetter(*this);
 
+  mImpl->NodeHierarchyChanged();
+
   // Inform the frame-callback-processor, if set, about the node-hierarchy changing
   if(mImpl->frameCallbackProcessor)
   {
@@ -567,6 +650,8 @@ void UpdateManager::DisconnectNode(Node* node)
 
   parent->DisconnectChild(*node);
 
+  mImpl->NodeHierarchyChanged();
+
   // Inform the frame-callback-processor, if set, about the node-hierarchy changing
   if(mImpl->frameCallbackProcessor)
   {
@@ -923,6 +1008,21 @@ uint32_t* UpdateManager::ReserveMessageSlot(uint32_t size, bool updateScene)
   return mImpl->messageQueue.ReserveMessageSlot(size, updateScene);
 }
 
+uint32_t* UpdateManager::ReservePropertyIndependentMessageSlot(uint32_t size, bool updateScene)
+{
+  return mImpl->messageQueue.ReservePropertyIndependentMessageSlot(size, updateScene);
+}
+
+uint32_t* UpdateManager::ReservePropertyMessageSlot(uint32_t size, const void* property, const void* messageTypeId)
+{
+  return mImpl->messageQueue.ReservePropertyMessageSlot(size, property, messageTypeId);
+}
+
+uint32_t* UpdateManager::FindLastPropertyMessage(const void* property, const void* messageTypeId) const
+{
+  return mImpl->messageQueue.FindLastPropertyMessage(property, messageTypeId);
+}
+
 std::size_t UpdateManager::GetUpdateMessageQueueCapacity() const
 {
   return mImpl->messageQueue.GetCapacity();
@@ -943,6 +1043,40 @@ void UpdateManager::EventProcessingFinished()
   mImpl->messageQueue.EventProcessingFinished();
 }
 
+void UpdateManager::BeginNodeBatch()
+{
+  if(mImpl->nodeBatchDepth++ == 0u)
+  {
+    mImpl->nodeBatch = new NodeBatch();
+    mImpl->messageQueue.BeginBatch();
+  }
+}
+
+void UpdateManager::EndNodeBatch()
+{
+  DALI_ASSERT_ALWAYS(mImpl->nodeBatchDepth > 0u && "EndNodeBatch() called without BeginNodeBatch()");
+
+  if(--mImpl->nodeBatchDepth == 0u)
+  {
+    OwnerPointer<NodeBatch> batch(mImpl->nodeBatch.Release());
+    batch->SetMessages(mImpl->messageQueue.EndBatch());
+    if(!batch->IsEmpty())
+    {
+      InstallNodeBatchMessage(*this, batch);
+    }
+  }
+}
+
+bool UpdateManager::IsNodeBatchActive() const
+{
+  return mImpl->nodeBatchDepth > 0u;
+}
+
+void UpdateManager::AddNodeToBatch(OwnerPointer<Node>& node)
+{
+  mImpl->nodeBatch->AddNode(node);
+}
+
 bool UpdateManager::FlushQueue()
 {
   return mImpl->messageQueue.FlushQueue();
@@ -950,6 +1084,8 @@ bool UpdateManager::FlushQueue()
 
 void UpdateManager::ResetProperties()
 {
+  PERF_MONITOR_START(PerformanceMonitor::RESET_PROPERTIES);
+
   // Clear the "animations finished" flag; This should be set if any (previously playing) animation is stopped
   mImpl->animationFinishedDuringUpdate = false;
 
@@ -980,6 +1116,8 @@ void UpdateManager::ResetProperties()
       propertyBase->ResetToBaseValue();
     }
   }
+
+  PERF_MONITOR_END(PerformanceMonitor::RESET_PROPERTIES);
 }
 
 bool UpdateManager::ProcessGestures(uint32_t lastVSyncTimeMilliseconds, uint32_t nextVSyncTimeMilliseconds)
@@ -1004,6 +1142,8 @@ bool UpdateManager::Animate(float elapsedSeconds)
     return animationActive;
   }
 
+  PERF_MONITOR_START(PerformanceMonitor::ANIMATE_NODES);
+
   auto&& iter = mImpl->animations.Begin();
 
   DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_ANIMATION_ANIMATE", [&](std::ostringstream& oss)
@@ -1011,13 +1151,16 @@ bool UpdateManager::Animate(float elapsedSeconds)
 
   DALI_TIME_CHECKER_BEGIN(gTimeCheckerFilter);
 
+  // The animators are updated at once after the animations, if they can be updated in parallel
+  AnimatorScheduler* animatorScheduler = mImpl->animatorScheduler.IsEnabled() ? &mImpl->animatorScheduler : nullptr;
+
   while(iter != mImpl->animations.End())
   {
     Animation* animation             = *iter;
     bool       finished              = false;
     bool       stopped               = false;
     bool       progressMarkerReached = false;
-    animation->Update(elapsedSeconds, stopped, finished, progressMarkerReached);
+    animation->Update(elapsedSeconds, stopped, finished, progressMarkerReached, animatorScheduler);
 
     animationActive = animationActive || animation->IsActive();
 
@@ -1054,6 +1197,11 @@ bool UpdateManager::Animate(float elapsedSeconds)
     }
   }
 
+  if(animatorScheduler)
+  {
+    animatorScheduler->Apply();
+  }
+
   // The application should be notified by NotificationManager, in another thread
   if(!mImpl->notifyRequiredAnimations.Empty())
   {
@@ -1068,11 +1216,33 @@ bool UpdateManager::Animate(float elapsedSeconds)
   DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_ANIMATION_ANIMATE", [&](std::ostringstream& oss)
   { oss << "[" << mImpl->animations.Count() << "]"; });
 
+  PERF_MONITOR_END(PerformanceMonitor::ANIMATE_NODES);
+
   return animationActive;
 }
 
 void UpdateManager::ConstrainCustomObjects(PropertyOwnerContainer& postPropertyOwners)
 {
+  ConstraintScheduler& constraintScheduler = mImpl->constraintScheduler;
+  if(constraintScheduler.IsEnabled())
+  {
+    for(auto&& object : mImpl->customObjects)
+    {
+      constraintScheduler.Add(object->GetConstraints());
+    }
+    if(constraintScheduler.Apply())
+    {
+      for(auto&& object : mImpl->customObjects)
+      {
+        if(object->GetPostConstraintsActivatedCount() > 0u)
+        {
+          postPropertyOwners.PushBack(object);
+        }
+      }
+      return;
+    }
+  }
+
   // Constrain custom objects (in construction order)
   for(auto&& object : mImpl->customObjects)
   {
@@ -1111,9 +1281,22 @@ void UpdateManager::ConstrainShaders(PropertyOwnerContainer& postPropertyOwners)
 
 void UpdateManager::ProcessPropertyNotifications()
 {
+  // The notifications are checked in registration order, but each property is queried whether it has changed only once per frame,
+  // however many notifications watch it.
+  auto& propertyInputChanged = mImpl->propertyInputChanged;
+  propertyInputChanged.clear();
+
   for(auto&& notification : mImpl->propertyNotifications)
   {
-    bool valid = notification->Check();
+    const PropertyInputImpl* property = notification->GetProperty();
+
+    auto iter = propertyInputChanged.find(property);
+    if(iter == propertyInputChanged.end())
+    {
+      iter = propertyInputChanged.emplace(property, property->InputChanged()).first;
+    }
+
+    bool valid = notification->Check(iter->second);
     if(valid)
     {
       mImpl->notificationManager.QueueMessage(PropertyChangedMessage(mImpl->propertyNotifier, notification->GetNotifyId(), notification->GetValidity()));
@@ -1214,6 +1397,8 @@ void UpdateManager::UpdateRenderers(PropertyOwnerContainer& postPropertyOwners)
 void UpdateManager::UpdateNodes(PropertyOwnerContainer& postPropertyOwners)
 {
   DALI_TIME_CHECKER_SCOPE(gTimeCheckerFilter, "DALI_UPDATE_NODES");
+  PERF_MONITOR_START(PerformanceMonitor::UPDATE_NODES);
+
   mImpl->nodeDirtyFlags = NodePropertyFlags::NOTHING;
 
   for(auto&& scene : mImpl->scenes)
@@ -1223,9 +1408,13 @@ void UpdateManager::UpdateNodes(PropertyOwnerContainer& postPropertyOwners)
       // Prepare resources, update shaders, for each node
       // And add the renderers to the sorted layers. Start from root, which is also a layer
       mImpl->nodeDirtyFlags |= UpdateNodeTree(*scene->root,
+                                              scene->nodeTree,
+                                              &mImpl->constraintScheduler,
                                               postPropertyOwners);
     }
   }
+
+  PERF_MONITOR_END(PerformanceMonitor::UPDATE_NODES);
 }
 
 void UpdateManager::UpdateLayers()
@@ -1235,7 +1424,7 @@ void UpdateManager::UpdateLayers()
   {
     if(scene && scene->root)
     {
-      SceneGraph::UpdateLayerTree(*scene->root);
+      SceneGraph::UpdateLayerTree(*scene->root, scene->nodeTree);
     }
   }
 }
@@ -1248,6 +1437,9 @@ uint32_t UpdateManager::Update(float    elapsedSeconds,
                                bool&    uploadOnly,
                                bool&    rendererAdded)
 {
+  PERF_MONITOR_NEXT_FRAME();
+  PERF_MONITOR_START(PerformanceMonitor::UPDATE);
+
   // Clear nodes/resources which were previously discarded
   mImpl->nodeDiscardQueue.Clear();
   mImpl->shaderDiscardQueue.Clear();
@@ -1390,13 +1582,11 @@ uint32_t UpdateManager::Update(float    elapsedSeconds,
       bool renderContinuously = false;
 
       mImpl->renderInstructionCapacity = 0u;
+      mImpl->sceneRenderTasks.clear();
       for(auto&& scene : mImpl->scenes)
       {
         if(scene && scene->root && scene->taskList && scene->scene)
         {
-          DALI_TIME_CHECKER_SCOPE(gTimeCheckerFilter, "DALI_PROCESS_RENDER_TASK");
-
-          DALI_TRACE_BEGIN(gTraceFilter, "DALI_PROCESS_RENDER_TASK");
           scene->scene->GetRenderInstructions().ResetAndReserve(static_cast<uint32_t>(scene->taskList->GetTasks().Count()));
 
           const bool sceneForceRendering = scene->scene->NeedsForceRendering();
@@ -1418,26 +1608,38 @@ uint32_t UpdateManager::Update(float    elapsedSeconds,
           // or keep rendering is requested
           if(!isAnimationRunning || animationActive || mImpl->renderingRequired || (mImpl->nodeDirtyFlags & RenderableUpdateFlags) || sceneKeepUpdating || sceneForceRendering)
           {
-            renderContinuously |= mImpl->renderTaskProcessor.Process(*scene->taskList,
-                                                                     scene->sortedLayerList,
-                                                                     scene->scene->GetRenderInstructions(),
-                                                                     renderToFboEnabled,
-                                                                     isRenderingToFbo);
-
-            mImpl->renderInstructionCapacity += scene->scene->GetRenderInstructions().GetCapacity();
+            mImpl->sceneRenderTasks.push_back({&(*scene->taskList), &scene->sortedLayerList, &scene->scene->GetRenderInstructions()});
             scene->scene->SetSkipRendering(false);
           }
           else
           {
             scene->scene->SetSkipRendering(true);
           }
-          DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_PROCESS_RENDER_TASK", [&](std::ostringstream& oss)
-          { oss << "[render instruction capacity : " << mImpl->renderInstructionCapacity << "]\n"; });
+        }
+      }
+
+      if(!mImpl->sceneRenderTasks.empty())
+      {
+        DALI_TIME_CHECKER_SCOPE(gTimeCheckerFilter, "DALI_PROCESS_RENDER_TASK");
+        DALI_TRACE_BEGIN(gTraceFilter, "DALI_PROCESS_RENDER_TASK");
+        PERF_MONITOR_START(PerformanceMonitor::PROCESS_RENDER_TASKS);
+
+        // The scenes are independent, so they may be processed concurrently.
+        renderContinuously = mImpl->renderTaskProcessor.Process(mImpl->sceneRenderTasks,
+                                                                renderToFboEnabled,
+                                                                isRenderingToFbo);
 
+        PERF_MONITOR_END(PerformanceMonitor::PROCESS_RENDER_TASKS);
+
+        for(auto&& sceneRenderTasks : mImpl->sceneRenderTasks)
+        {
+          mImpl->renderInstructionCapacity += sceneRenderTasks.instructions->GetCapacity();
 #if defined(DEBUG_ENABLED)
-          numberOfRenderInstructions += scene->scene->GetRenderInstructions().Count();
+          numberOfRenderInstructions += sceneRenderTasks.instructions->Count();
 #endif
         }
+        DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_PROCESS_RENDER_TASK", [&](std::ostringstream& oss)
+        { oss << "[scenes : " << mImpl->sceneRenderTasks.size() << ", render instruction capacity : " << mImpl->renderInstructionCapacity << "]\n"; });
       }
 
       if(renderContinuously)
@@ -1551,6 +1753,8 @@ uint32_t UpdateManager::Update(float    elapsedSeconds,
   // tell the update manager that we're done so the queue can be given to event thread
   mImpl->notificationManager.UpdateCompleted();
 
+  PERF_MONITOR_END(PerformanceMonitor::UPDATE);
+
   return keepUpdating;
 }
 
@@ -1657,9 +1861,15 @@ void UpdateManager::SetDepthIndices(OwnerPointer<NodeDepths>& nodeDepths)
   // note, this vector is already in depth order.
   // So if we reverse iterate, we can assume that
   // my descendant node's depth index are updated.
+  // When the depth tree is updated incrementally, it only contains
+  // the changed nodes, but always with their ancestors.
 
   // And also, This API is the last flushed message.
   // We can now setup the DESCENDENT_HIERARCHY_CHANGED flag here.
+  const auto compareDepthIndex = [](Node* a, Node* b)
+  { return a->GetDepthIndex() < b->GetDepthIndex(); };
+
+  bool reordered = false;
   for(auto rIter = nodeDepths->nodeDepths.rbegin(), rEndIter = nodeDepths->nodeDepths.rend(); rIter != rEndIter; rIter++)
   {
     auto* node = rIter->node;
@@ -1669,10 +1879,19 @@ void UpdateManager::SetDepthIndices(OwnerPointer<NodeDepths>& nodeDepths)
     {
       // Reorder children container only if sibiling order changed.
       NodeContainer& container = node->GetChildren();
-      std::sort(container.Begin(), container.End(), [](Node* a, Node* b)
-      { return a->GetDepthIndex() < b->GetDepthIndex(); });
+      if(!std::is_sorted(container.Begin(), container.End(), compareDepthIndex))
+      {
+        std::sort(container.Begin(), container.End(), compareDepthIndex);
+        reordered = true;
+      }
     }
   }
+
+  if(reordered)
+  {
+    // The flattened node trees of the scenes follow the order of the children
+    mImpl->NodeHierarchyChanged();
+  }
 }
 
 void UpdateManager::AddFrameCallback(OwnerPointer<FrameCallback>& frameCallback, const Node* rootNode)
@@ -40,6 +40,7 @@
 #include <dali/internal/update/common/scene-graph-property-notification.h>
 #include <dali/internal/update/common/scene-graph-scene.h>
 #include <dali/internal/update/gestures/scene-graph-pan-gesture.h>
+#include <dali/internal/update/manager/node-batch.h>                 // for OwnerPointer< NodeBatch >
 #include <dali/internal/update/manager/scene-graph-frame-callback.h> // for OwnerPointer< FrameCallback >
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
@@ -156,6 +157,12 @@ public:
    */
   void AddNode(OwnerPointer<Node>& node);
 
+  /**
+   * Add the nodes of a batch, then process its messages.
+   * @param[in] batch The batch; UpdateManager takes ownership of its nodes.
+   */
+  void InstallNodeBatch(OwnerPointer<NodeBatch>& batch);
+
   /**
    * Connect a Node to the scene-graph.
    * A disconnected Node has has no parent or children, and its properties cannot be animated/constrained.
@@ -433,6 +440,44 @@ public:
    */
   [[nodiscard]] uint32_t* ReserveMessageSlot(uint32_t size, bool updateScene = true);
 
+  /**
+   * @copydoc Dali::Internal::Update::MessageQueue::ReservePropertyIndependentMessageSlot()
+   */
+  [[nodiscard]] uint32_t* ReservePropertyIndependentMessageSlot(uint32_t size, bool updateScene = true);
+
+  /**
+   * @copydoc Dali::Internal::Update::MessageQueue::ReservePropertyMessageSlot()
+   */
+  [[nodiscard]] uint32_t* ReservePropertyMessageSlot(uint32_t size, const void* property, const void* messageTypeId);
+
+  /**
+   * @copydoc Dali::Internal::Update::MessageQueue::FindLastPropertyMessage()
+   */
+  uint32_t* FindLastPropertyMessage(const void* property, const void* messageTypeId) const;
+
+  /**
+   * Called by the event-thread to collect the nodes created and the messages queued until EndNodeBatch(),
+   * so that they are sent with one message. Calls can be nested; the batch is sent by the outermost EndNodeBatch().
+   */
+  void BeginNodeBatch();
+
+  /**
+   * Called by the event-thread to send the batch started by BeginNodeBatch().
+   */
+  void EndNodeBatch();
+
+  /**
+   * Query whether the nodes created by the event-thread are collected in a batch.
+   * @return True if a batch is active
+   */
+  bool IsNodeBatchActive() const;
+
+  /**
+   * Called by the event-thread to add a new node to the active batch.
+   * @param[in] node The new node; the batch takes ownership.
+   */
+  void AddNodeToBatch(OwnerPointer<Node>& node);
+
   /**
    * Called by the event-thread to signal that FlushQueue will be called
    * e.g. when it has finished event processing.
@@ -768,6 +813,13 @@ inline void UninstallRootMessage(UpdateManager& manager, const Layer* constRoot)
 
 inline void AddNodeMessage(UpdateManager& manager, OwnerPointer<Node>& node)
 {
+  // The nodes of a batch are added at once, before its messages are processed
+  if(manager.IsNodeBatchActive())
+  {
+    manager.AddNodeToBatch(node);
+    return;
+  }
+
   // Message has ownership of Node while in transit from event -> update
   using LocalType = MessageValue1<UpdateManager, OwnerPointer<Node>>;
 
@@ -778,6 +830,18 @@ inline void AddNodeMessage(UpdateManager& manager, OwnerPointer<Node>& node)
   new(slot) LocalType(&manager, &UpdateManager::AddNode, node);
 }
 
+inline void InstallNodeBatchMessage(UpdateManager& manager, OwnerPointer<NodeBatch>& batch)
+{
+  // Message has ownership of the batch while in transit from event -> update
+  using LocalType = MessageValue1<UpdateManager, OwnerPointer<NodeBatch>>;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot(sizeof(LocalType));
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new(slot) LocalType(&manager, &UpdateManager::InstallNodeBatch, batch);
+}
+
 inline void ConnectNodeMessage(UpdateManager& manager, const Node& constParent, const Node& constChild)
 {
   // Update thread can edit the object
@@ -1053,8 +1117,8 @@ inline void RequestRenderingMessage(UpdateManager& manager)
 {
   using LocalType = Message<UpdateManager>;
 
-  // Reserve some memory inside the message queue
-  uint32_t* slot = manager.ReserveMessageSlot(sizeof(LocalType));
+  // Reserve some memory inside the message queue; the request does not stop the merging of the property values set around it
+  uint32_t* slot = manager.ReservePropertyIndependentMessageSlot(sizeof(LocalType));
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(&manager, &UpdateManager::RequestRendering);
@@ -1302,8 +1366,8 @@ inline void AddResetterMessage(UpdateManager& manager, OwnerPointer<PropertyRese
 {
   using LocalType = MessageValue1<UpdateManager, OwnerPointer<PropertyResetterBase>>;
 
-  // Reserve some memory inside the message queue
-  uint32_t* slot = manager.ReserveMessageSlot(sizeof(LocalType));
+  // Reserve some memory inside the message queue; adding a resetter does not change the value of the property
+  uint32_t* slot = manager.ReservePropertyIndependentMessageSlot(sizeof(LocalType));
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new(slot) LocalType(&manager, &UpdateManager::AddPropertyResetter, resetter);
@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/update-proxy-impl.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali/internal/update/manager/update-manager.h>
 #include <dali/internal/update/manager/update-proxy-property-modifier.h>
@@ -29,6 +32,7 @@ namespace Internal
 UpdateProxy::UpdateProxy(SceneGraph::UpdateManager& updateManager, SceneGraph::TransformManager& transformManager, SceneGraphTravelerInterfacePtr traveler)
 : mLastCachedIdNodePair({0u, nullptr}),
   mDirtyNodes(),
+  mActorSets(),
   mUpdateManager(updateManager),
   mTransformManager(transformManager),
   mSceneGraphTraveler(traveler),
@@ -280,6 +284,13 @@ void UpdateProxy::NodeHierarchyChanged()
 {
   mLastCachedIdNodePair = {0u, nullptr};
   mPropertyModifier.reset();
+
+  // The nodes of the actor sets are looked up again when next used
+  for(auto&& actorSet : mActorSets)
+  {
+    actorSet.resolved       = false;
+    actorSet.colorResetters = false;
+  }
 }
 
 void UpdateProxy::Notify(Dali::UpdateProxy::NotifySyncPoint syncPoint)
@@ -340,6 +351,20 @@ void UpdateProxy::AddNodeResetters()
       mUpdateManager.AddNodeResetter(*node);
     }
   }
+
+  for(uint32_t i = 0u; i < mActorSets.size(); ++i)
+  {
+    if(mActorSets[i].used && mActorSets[i].colorModified)
+    {
+      for(auto&& node : GetActorSet(i + 1u)->nodes)
+      {
+        if(node)
+        {
+          mUpdateManager.AddNodeResetter(*node);
+        }
+      }
+    }
+  }
 }
 
 bool UpdateProxy::GetUpdateArea(uint32_t id, Vector4& updateArea) const
@@ -534,6 +559,226 @@ bool UpdateProxy::BakeCustomProperty(uint32_t id, ConstString propertyName, cons
   return success;
 }
 
+Dali::UpdateProxy::ActorSet UpdateProxy::CreateActorSet(const uint32_t* ids, uint32_t count)
+{
+  // Reuse the slot of a removed set, if any
+  auto iter = std::find_if(mActorSets.begin(), mActorSets.end(), [](const ActorSetNodes& actorSetNodes) { return !actorSetNodes.used; });
+  if(iter == mActorSets.end())
+  {
+    iter = mActorSets.emplace(mActorSets.end());
+  }
+
+  *iter = ActorSetNodes();
+  iter->ids.assign(ids, ids + count);
+  iter->used = true;
+
+  return static_cast<Dali::UpdateProxy::ActorSet>(iter - mActorSets.begin()) + 1u;
+}
+
+void UpdateProxy::RemoveActorSet(Dali::UpdateProxy::ActorSet actorSet)
+{
+  if(actorSet != Dali::UpdateProxy::INVALID_ACTOR_SET && actorSet <= mActorSets.size())
+  {
+    ActorSetNodes& actorSetNodes = mActorSets[actorSet - 1u];
+    if(actorSetNodes.used && actorSetNodes.colorModified)
+    {
+      // The nodes still need a resetter when this proxy is destroyed
+      mDirtyNodes.insert(mDirtyNodes.end(), actorSetNodes.ids.begin(), actorSetNodes.ids.end());
+    }
+    actorSetNodes = ActorSetNodes();
+  }
+}
+
+uint32_t UpdateProxy::GetPositions(Dali::UpdateProxy::ActorSet actorSet, Vector3* positions) const
+{
+  return GetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_POSITION, positions);
+}
+
+uint32_t UpdateProxy::SetPositions(Dali::UpdateProxy::ActorSet actorSet, const Vector3* positions)
+{
+  return SetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_POSITION, positions, false);
+}
+
+uint32_t UpdateProxy::BakePositions(Dali::UpdateProxy::ActorSet actorSet, const Vector3* positions)
+{
+  return SetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_POSITION, positions, true);
+}
+
+uint32_t UpdateProxy::GetSizes(Dali::UpdateProxy::ActorSet actorSet, Vector3* sizes) const
+{
+  return GetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_SIZE, sizes);
+}
+
+uint32_t UpdateProxy::SetSizes(Dali::UpdateProxy::ActorSet actorSet, const Vector3* sizes)
+{
+  return SetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_SIZE, sizes, false);
+}
+
+uint32_t UpdateProxy::BakeSizes(Dali::UpdateProxy::ActorSet actorSet, const Vector3* sizes)
+{
+  return SetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_SIZE, sizes, true);
+}
+
+uint32_t UpdateProxy::GetScales(Dali::UpdateProxy::ActorSet actorSet, Vector3* scales) const
+{
+  return GetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_SCALE, scales);
+}
+
+uint32_t UpdateProxy::SetScales(Dali::UpdateProxy::ActorSet actorSet, const Vector3* scales)
+{
+  return SetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_SCALE, scales, false);
+}
+
+uint32_t UpdateProxy::BakeScales(Dali::UpdateProxy::ActorSet actorSet, const Vector3* scales)
+{
+  return SetVector3Values(actorSet, SceneGraph::TRANSFORM_PROPERTY_SCALE, scales, true);
+}
+
+uint32_t UpdateProxy::GetColors(Dali::UpdateProxy::ActorSet actorSet, Vector4* colors) const
+{
+  uint32_t             count         = 0u;
+  const ActorSetNodes* actorSetNodes = GetActorSet(actorSet);
+  if(actorSetNodes)
+  {
+    const uint32_t nodeCount = static_cast<uint32_t>(actorSetNodes->nodes.size());
+    for(uint32_t i = 0u; i < nodeCount; ++i)
+    {
+      const SceneGraph::Node* node = actorSetNodes->nodes[i];
+      if(node)
+      {
+        colors[i] = node->mColor.Get();
+      }
+    }
+    count = actorSetNodes->foundCount;
+  }
+  return count;
+}
+
+uint32_t UpdateProxy::SetColors(Dali::UpdateProxy::ActorSet actorSet, const Vector4* colors)
+{
+  uint32_t       count         = 0u;
+  ActorSetNodes* actorSetNodes = GetActorSet(actorSet);
+  if(actorSetNodes)
+  {
+    const uint32_t nodeCount = static_cast<uint32_t>(actorSetNodes->nodes.size());
+    for(uint32_t i = 0u; i < nodeCount; ++i)
+    {
+      SceneGraph::Node* node = actorSetNodes->nodes[i];
+      if(node)
+      {
+        node->mColor.Set(colors[i]);
+        node->SetDirtyFlag(SceneGraph::NodePropertyFlags::COLOR);
+
+        // Only look for the existing resetters once, rather than on every frame
+        if(!actorSetNodes->colorResetters)
+        {
+          AddResetter(*node, node->mColor);
+        }
+      }
+    }
+    actorSetNodes->colorResetters = true;
+    actorSetNodes->colorModified  = true;
+    count                         = actorSetNodes->foundCount;
+  }
+  return count;
+}
+
+uint32_t UpdateProxy::BakeColors(Dali::UpdateProxy::ActorSet actorSet, const Vector4* colors)
+{
+  uint32_t       count         = 0u;
+  ActorSetNodes* actorSetNodes = GetActorSet(actorSet);
+  if(actorSetNodes)
+  {
+    const uint32_t nodeCount = static_cast<uint32_t>(actorSetNodes->nodes.size());
+    for(uint32_t i = 0u; i < nodeCount; ++i)
+    {
+      SceneGraph::Node* node = actorSetNodes->nodes[i];
+      if(node)
+      {
+        node->mColor.Bake(colors[i]);
+      }
+    }
+    count = actorSetNodes->foundCount;
+  }
+  return count;
+}
+
+uint32_t UpdateProxy::GetWorldMatrices(Dali::UpdateProxy::ActorSet actorSet, Matrix* worldMatrices) const
+{
+  uint32_t             count         = 0u;
+  const ActorSetNodes* actorSetNodes = GetActorSet(actorSet);
+  if(actorSetNodes)
+  {
+    mTransformManager.GetWorldMatrices(actorSetNodes->transformIds.data(), static_cast<uint32_t>(actorSetNodes->transformIds.size()), worldMatrices);
+    count = actorSetNodes->foundCount;
+  }
+  return count;
+}
+
+UpdateProxy::ActorSetNodes* UpdateProxy::GetActorSet(Dali::UpdateProxy::ActorSet actorSet) const
+{
+  if(actorSet == Dali::UpdateProxy::INVALID_ACTOR_SET || actorSet > mActorSets.size() || !mActorSets[actorSet - 1u].used)
+  {
+    return nullptr;
+  }
+
+  ActorSetNodes& actorSetNodes = mActorSets[actorSet - 1u];
+  if(!actorSetNodes.resolved)
+  {
+    const uint32_t count = static_cast<uint32_t>(actorSetNodes.ids.size());
+    actorSetNodes.nodes.resize(count);
+    actorSetNodes.transformIds.resize(count);
+    actorSetNodes.foundCount = 0u;
+
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      SceneGraph::Node* node        = mSceneGraphTraveler->FindNode(actorSetNodes.ids[i]);
+      actorSetNodes.nodes[i]        = node;
+      actorSetNodes.transformIds[i] = SceneGraph::INVALID_TRANSFORM_ID;
+      if(node)
+      {
+        actorSetNodes.transformIds[i] = node->GetTransformId();
+        ++actorSetNodes.foundCount;
+      }
+    }
+    actorSetNodes.resolved = true;
+  }
+  return &actorSetNodes;
+}
+
+uint32_t UpdateProxy::GetVector3Values(Dali::UpdateProxy::ActorSet actorSet, SceneGraph::TransformManagerProperty property, Vector3* values) const
+{
+  uint32_t             count         = 0u;
+  const ActorSetNodes* actorSetNodes = GetActorSet(actorSet);
+  if(actorSetNodes)
+  {
+    const SceneGraph::TransformManager& transformManager = mTransformManager; // To ensure we call the const getter
+    transformManager.GetVector3PropertyValues(actorSetNodes->transformIds.data(), static_cast<uint32_t>(actorSetNodes->transformIds.size()), property, values);
+    count = actorSetNodes->foundCount;
+  }
+  return count;
+}
+
+uint32_t UpdateProxy::SetVector3Values(Dali::UpdateProxy::ActorSet actorSet, SceneGraph::TransformManagerProperty property, const Vector3* values, bool bake)
+{
+  uint32_t             count         = 0u;
+  const ActorSetNodes* actorSetNodes = GetActorSet(actorSet);
+  if(actorSetNodes)
+  {
+    const uint32_t transformCount = static_cast<uint32_t>(actorSetNodes->transformIds.size());
+    if(bake)
+    {
+      mTransformManager.BakeVector3PropertyValues(actorSetNodes->transformIds.data(), transformCount, property, values);
+    }
+    else
+    {
+      mTransformManager.SetVector3PropertyValues(actorSetNodes->transformIds.data(), transformCount, property, values);
+    }
+    count = actorSetNodes->foundCount;
+  }
+  return count;
+}
+
 } // namespace Internal
 
 } // namespace Dali
@@ -218,6 +218,81 @@ public:
    */
   bool BakeCustomProperty(uint32_t id, ConstString propertyName, const Property::Value& value);
 
+  /**
+   * @copydoc Dali::UpdateProxy::CreateActorSet()
+   */
+  Dali::UpdateProxy::ActorSet CreateActorSet(const uint32_t* ids, uint32_t count);
+
+  /**
+   * @copydoc Dali::UpdateProxy::RemoveActorSet()
+   */
+  void RemoveActorSet(Dali::UpdateProxy::ActorSet actorSet);
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetPositions()
+   */
+  uint32_t GetPositions(Dali::UpdateProxy::ActorSet actorSet, Vector3* positions) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetPositions()
+   */
+  uint32_t SetPositions(Dali::UpdateProxy::ActorSet actorSet, const Vector3* positions);
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakePositions()
+   */
+  uint32_t BakePositions(Dali::UpdateProxy::ActorSet actorSet, const Vector3* positions);
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetSizes()
+   */
+  uint32_t GetSizes(Dali::UpdateProxy::ActorSet actorSet, Vector3* sizes) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetSizes()
+   */
+  uint32_t SetSizes(Dali::UpdateProxy::ActorSet actorSet, const Vector3* sizes);
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakeSizes()
+   */
+  uint32_t BakeSizes(Dali::UpdateProxy::ActorSet actorSet, const Vector3* sizes);
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetScales()
+   */
+  uint32_t GetScales(Dali::UpdateProxy::ActorSet actorSet, Vector3* scales) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetScales()
+   */
+  uint32_t SetScales(Dali::UpdateProxy::ActorSet actorSet, const Vector3* scales);
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakeScales()
+   */
+  uint32_t BakeScales(Dali::UpdateProxy::ActorSet actorSet, const Vector3* scales);
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetColors()
+   */
+  uint32_t GetColors(Dali::UpdateProxy::ActorSet actorSet, Vector4* colors) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetColors()
+   */
+  uint32_t SetColors(Dali::UpdateProxy::ActorSet actorSet, const Vector4* colors);
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakeColors()
+   */
+  uint32_t BakeColors(Dali::UpdateProxy::ActorSet actorSet, const Vector4* colors);
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetWorldMatrices()
+   */
+  uint32_t GetWorldMatrices(Dali::UpdateProxy::ActorSet actorSet, Matrix* worldMatrices) const;
+
 private:
   /**
    * @brief Retrieves the node with the specified ID.
@@ -227,6 +302,47 @@ private:
    */
   SceneGraph::Node* GetNodeWithId(uint32_t id) const;
 
+  /**
+   * Structure to store the nodes of a set of actors, looked up once per node hierarchy change
+   */
+  struct ActorSetNodes
+  {
+    std::vector<uint32_t>                ids;                   ///< The IDs of the actors
+    std::vector<SceneGraph::Node*>       nodes;                 ///< The nodes, or nullptr for the actors which were not found
+    std::vector<SceneGraph::TransformId> transformIds;          ///< The transform ids of the nodes, or INVALID_TRANSFORM_ID
+    uint32_t                             foundCount{0u};        ///< The number of actors which were found
+    bool                                 used{false};           ///< Whether this slot holds a set
+    bool                                 resolved{false};       ///< Whether the nodes match the current node hierarchy
+    bool                                 colorResetters{false}; ///< Whether the color resetters were added since the nodes were resolved
+    bool                                 colorModified{false};  ///< Whether the colors were set, so the nodes need a resetter when the proxy is destroyed
+  };
+
+  /**
+   * @brief Retrieves the set of actors, looking up its nodes if the node hierarchy changed.
+   * @param[in]  actorSet  The set of actors
+   * @return A pointer to the set, or nullptr if the set is not valid
+   */
+  ActorSetNodes* GetActorSet(Dali::UpdateProxy::ActorSet actorSet) const;
+
+  /**
+   * @brief Retrieves a transform property of every node of a set of actors.
+   * @param[in]   actorSet  The set of actors
+   * @param[in]   property  The property
+   * @param[out]  values    One value per actor of the set
+   * @return The number of actors of the set which were found
+   */
+  uint32_t GetVector3Values(Dali::UpdateProxy::ActorSet actorSet, SceneGraph::TransformManagerProperty property, Vector3* values) const;
+
+  /**
+   * @brief Sets or bakes a transform property of every node of a set of actors.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  property  The property
+   * @param[in]  values    One value per actor of the set
+   * @param[in]  bake      Whether to bake the values
+   * @return The number of actors of the set which were found
+   */
+  uint32_t SetVector3Values(Dali::UpdateProxy::ActorSet actorSet, SceneGraph::TransformManagerProperty property, const Vector3* values, bool bake);
+
   /**
    * @brief Adds a property-resetter for non-transform properties so that they can be reset to their base value every frame.
    * @param[in]  node          The node the property belongs to
@@ -247,8 +363,9 @@ private:
   class PropertyModifier;
   using PropertyModifierPtr = std::unique_ptr<PropertyModifier>;
 
-  mutable IdNodePair    mLastCachedIdNodePair; ///< Used to cache the last retrieved id-node pair.
-  std::vector<uint32_t> mDirtyNodes;           ///< Used to store the ID of the dirty nodes with non-transform property modifications.
+  mutable IdNodePair                 mLastCachedIdNodePair; ///< Used to cache the last retrieved id-node pair.
+  std::vector<uint32_t>              mDirtyNodes;           ///< Used to store the ID of the dirty nodes with non-transform property modifications.
+  mutable std::vector<ActorSetNodes> mActorSets;            ///< The sets of actors. An ActorSet is its index in this container plus one.
 
   SceneGraph::UpdateManager&     mUpdateManager;      ///< Reference to the Update Manager.
   SceneGraph::TransformManager&  mTransformManager;   ///< Reference to the Transform Manager.
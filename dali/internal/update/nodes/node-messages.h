@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/common/message.h>
+#include <dali/internal/update/common/property-message-merging.h>
 #include <dali/internal/update/manager/update-manager.h>
 #include <dali/internal/update/nodes/node.h>
 
@@ -78,8 +79,15 @@ public:
                    MemberFunction                         member,
                    typename ParameterType<P>::PassingType value)
   {
+    // Only the last value is processed when the property is baked several times before the messages are flushed
+    const bool mergeable = (member == &AnimatableProperty<P>::Bake);
+    if(mergeable && MergePropertyMessage<NodePropertyMessage>(eventThreadServices, property, member, value))
+    {
+      return;
+    }
+
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(NodePropertyMessage));
+    uint32_t* slot = ReservePropertyMessageSlot<NodePropertyMessage>(eventThreadServices, property, mergeable);
 
     auto& updateManager = eventThreadServices.GetUpdateManager();
 
@@ -107,6 +115,22 @@ public:
     (mProperty->*mMemberFunction)(mParam);
   }
 
+  /**
+   * Replaces the value of the message, if it calls the same member function.
+   * @param[in] member The member function of the new message.
+   * @param[in] value The new value.
+   * @return True if the value is replaced.
+   */
+  bool Merge(MemberFunction member, typename ParameterType<P>::PassingType value)
+  {
+    if(member != mMemberFunction)
+    {
+      return false;
+    }
+    mParam = value;
+    return true;
+  }
+
 private:
   /**
    * Create a message.
@@ -156,6 +180,7 @@ public:
    * @param[in] property The property to bake.
    * @param[in] member The member function of the object.
    * @param[in] value The new value of the X,Y,Z or W component.
+   * @note The member function must set the component, e.g. BakeX, as a later message may replace its value.
    */
   static void Send(EventThreadServices&         eventThreadServices,
                    const Node*                  node,
@@ -163,8 +188,14 @@ public:
                    MemberFunction               member,
                    float                        value)
   {
+    // Only the last value is processed when the component is baked several times before the messages are flushed
+    if(MergePropertyMessage<NodePropertyComponentMessage>(eventThreadServices, property, member, value))
+    {
+      return;
+    }
+
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(NodePropertyComponentMessage));
+    uint32_t* slot = ReservePropertyMessageSlot<NodePropertyComponentMessage>(eventThreadServices, property, true);
 
     auto& updateManager = eventThreadServices.GetUpdateManager();
 
@@ -192,6 +223,22 @@ public:
     (mProperty->*mMemberFunction)(mParam);
   }
 
+  /**
+   * Replaces the value of the message, if it calls the same member function.
+   * @param[in] member The member function of the new message.
+   * @param[in] value The new value.
+   * @return True if the value is replaced.
+   */
+  bool Merge(MemberFunction member, float value)
+  {
+    if(member != mMemberFunction)
+    {
+      return false;
+    }
+    mParam = value;
+    return true;
+  }
+
 private:
   /**
    * Create a message.
@@ -248,8 +295,15 @@ public:
                    MemberFunction                            member,
                    const P&                                  value)
   {
+    // Only the last value is processed when the property is baked several times before the messages are flushed
+    const bool mergeable = (member == &TransformManagerPropertyHandler<P>::Bake);
+    if(mergeable && MergePropertyMessage<NodeTransformPropertyMessage>(eventThreadServices, property, member, value))
+    {
+      return;
+    }
+
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(NodeTransformPropertyMessage));
+    uint32_t* slot = ReservePropertyMessageSlot<NodeTransformPropertyMessage>(eventThreadServices, property, mergeable);
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new(slot) NodeTransformPropertyMessage(eventThreadServices.GetUpdateManager(), node, property, member, value);
@@ -272,6 +326,22 @@ public:
     (mProperty->*mMemberFunction)(mParam);
   }
 
+  /**
+   * Replaces the value of the message, if it calls the same member function.
+   * @param[in] member The member function of the new message.
+   * @param[in] value The new value.
+   * @return True if the value is replaced.
+   */
+  bool Merge(MemberFunction member, const P& value)
+  {
+    if(member != mMemberFunction)
+    {
+      return false;
+    }
+    mParam = value;
+    return true;
+  }
+
 private:
   /**
    * Create a message.
@@ -328,8 +398,14 @@ public:
                    MemberFunction                            member,
                    float                                     value)
   {
+    // Only the last value is processed when the component is baked several times before the messages are flushed
+    if(MergePropertyMessage<NodeTransformComponentMessage>(eventThreadServices, property, member, value))
+    {
+      return;
+    }
+
     // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot(sizeof(NodeTransformComponentMessage));
+    uint32_t* slot = ReservePropertyMessageSlot<NodeTransformComponentMessage>(eventThreadServices, property, true);
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new(slot) NodeTransformComponentMessage(eventThreadServices.GetUpdateManager(), node, property, member, value);
@@ -352,6 +428,22 @@ public:
     (mProperty->*mMemberFunction)(mParam);
   }
 
+  /**
+   * Replaces the value of the message, if it calls the same member function.
+   * @param[in] member The member function of the new message.
+   * @param[in] value The new value.
+   * @return True if the value is replaced.
+   */
+  bool Merge(MemberFunction member, float value)
+  {
+    if(member != mMemberFunction)
+    {
+      return false;
+    }
+    mParam = value;
+    return true;
+  }
+
 private:
   /**
    * Create a message.
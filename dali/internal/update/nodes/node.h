@@ -798,6 +798,21 @@ public:
            (mTransformManagerData.Manager()->IsWorldMatrixDirty(mTransformManagerData.Id()));
   }
 
+  /**
+   * Retrieve the number of updates which have changed a world matrix or a size of the nodes
+   * sharing the transform manager of this node.
+   * @return The change count, or 0 if the node has no transform
+   */
+  uint32_t GetTransformChangeCount() const
+  {
+    if(DALI_LIKELY(TransformManager::IsValidTransformId(mTransformManagerData.Id())))
+    {
+      return mTransformManagerData.Manager()->GetChangeCount();
+    }
+
+    return 0u;
+  }
+
   /**
    * Retrieve the cached world-matrix of a node.
    * @return The world-matrix.
@@ -1145,6 +1160,14 @@ private: // from NodeDataProvider
     return GetUniformMap();
   }
 
+  /**
+   * @copydoc NodeDataProvider::IsNodeUpdated
+   */
+  bool IsNodeUpdated() const override
+  {
+    return Updated();
+  }
+
 private:
   // Delete copy and move
   Node(const Node&)                = delete;
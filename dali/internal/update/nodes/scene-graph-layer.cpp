@@ -40,6 +40,7 @@ Layer::Layer()
   mSortFunction(Internal::Layer::ZValue),
   mLastCamera(nullptr),
   mBehavior(Dali::Layer::LAYER_UI),
+  mWorldMatrixChangeCount(0u),
   mDepthTestDisabled(true),
   mIsDefaultSortFunction(true)
 {
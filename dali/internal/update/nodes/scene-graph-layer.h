@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <atomic>
+
 // INTERNAL INCLUDES
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/nodes/node.h>
@@ -172,6 +175,28 @@ public:
     return mAllChildTransformsClean;
   }
 
+  /**
+   * Records that the world matrix or the size of a node of this layer changed in this update.
+   * @param[in] changeCount The transform change count of this update, see Node::GetTransformChangeCount()
+   */
+  void SetWorldMatrixChangeCount(uint32_t changeCount)
+  {
+    if(mWorldMatrixChangeCount.load(std::memory_order_relaxed) != changeCount)
+    {
+      mWorldMatrixChangeCount.store(changeCount, std::memory_order_release);
+    }
+  }
+
+  /**
+   * Retrieve the transform change count of the last update which changed the world matrix or the size of a node of this layer.
+   * The nodes of the child layers are not included. Can be called from the event thread.
+   * @return The change count
+   */
+  uint32_t GetWorldMatrixChangeCount() const
+  {
+    return mWorldMatrixChangeCount.load(std::memory_order_acquire);
+  }
+
   /**
    * Checks if it is ok to reuse renderers. Renderers can be reused if ModelView transform for all the renderers
    * has not changed from previous use.
@@ -225,6 +250,8 @@ private:
 
   Dali::Layer::Behavior mBehavior; ///< The behavior of the layer
 
+  std::atomic<uint32_t> mWorldMatrixChangeCount; ///< The transform change count of the last update which changed a node of this layer
+
   bool mAllChildTransformsClean : 1; ///< True if all child nodes transforms are clean,
                                      ///  this allows us to cache render items when layer is "static"
   bool mDepthTestDisabled : 1;       ///< Whether depth test is disabled.
@@ -22,6 +22,7 @@
 #include <atomic> ///< for std::atomic
 #include <chrono> ///< for std::chrono::milliseconds
 #include <future> ///< for std::future and std::promise
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/vector-wrapper.h>
@@ -74,6 +75,16 @@ using MessageBufferIter = MessageBufferQueue::iterator;
 
 using MessageQueueMutex = Dali::Mutex;
 
+/**
+ * The last message which modifies a property in the current buffer.
+ */
+struct PropertyMessage
+{
+  std::size_t offset;        ///< The offset of the message in the buffer, as the buffer may be reallocated
+  const void* messageTypeId; ///< The type of the message
+  uint32_t    epoch;         ///< The message epoch when it was reserved
+};
+
 } // unnamed namespace
 
 namespace Update
@@ -89,8 +100,18 @@ struct MessageQueue::Impl
     queueWasEmpty(true),
     sceneUpdateFlag(false),
     sceneUpdate(0),
-    currentMessageBuffer(nullptr)
+    currentMessageBuffer(nullptr),
+    batchMessageBuffer(nullptr),
+    batchActive(false)
+  {
+  }
+
+  /**
+   * @return The buffer which holds the messages reserved now; may be nullptr
+   */
+  MessageBuffer* GetActiveBuffer() const
   {
+    return batchActive ? batchMessageBuffer : currentMessageBuffer;
   }
 
   ~Impl()
@@ -102,6 +123,13 @@ struct MessageQueue::Impl
       delete currentMessageBuffer;
     }
 
+    // Delete the batch which was not ended
+    if(batchMessageBuffer)
+    {
+      DeleteBufferContents(batchMessageBuffer);
+      delete batchMessageBuffer;
+    }
+
     // Delete the unprocessed buffers
     for(auto* buffer : processQueue)
     {
@@ -187,6 +215,12 @@ struct MessageQueue::Impl
   MessageBuffer*     currentMessageBuffer; ///< can be used without locking
   MessageBufferQueue freeQueue;            ///< buffers from the recycleQueue; can be used without locking
 
+  MessageBuffer* batchMessageBuffer; ///< The messages reserved since BeginBatch(); event thread only
+  bool           batchActive;        ///< Whether the messages are reserved in batchMessageBuffer
+
+  std::unordered_map<const void*, PropertyMessage> lastPropertyMessages; ///< The last message of each property in the active buffer; event thread only
+  uint32_t                                         messageEpoch{0u};     ///< Incremented by every message which may modify a property outside of a property message; event thread only
+
   /// Lockless SPSC ring of whole-buffer pointers - the fast path. A buffer is
   /// pushed here as ONE pointer per FlushQueue() call (O(1) regardless of how
   /// many messages it holds), matching the pre-lockless mutex design's actual
@@ -223,6 +257,16 @@ void MessageQueue::EventProcessingFinished()
 
 // Called from event thread
 uint32_t* MessageQueue::ReserveMessageSlot(uint32_t requestedSize, bool updateScene)
+{
+  // The message may modify a property too, e.g. an animation baking its final value when it stops,
+  // so the values set later can not be merged into the property messages reserved before it
+  ++mImpl->messageEpoch;
+
+  return ReservePropertyIndependentMessageSlot(requestedSize, updateScene);
+}
+
+// Called from event thread
+uint32_t* MessageQueue::ReservePropertyIndependentMessageSlot(uint32_t requestedSize, bool updateScene)
 {
   DALI_QB_SCOPE_TIMER(MQ_RESERVE_MESSAGE_SLOT);
 
@@ -233,6 +277,16 @@ uint32_t* MessageQueue::ReserveMessageSlot(uint32_t requestedSize, bool updateSc
     mImpl->sceneUpdateFlag = true;
   }
 
+  // The batch is sent with one message in the current buffer when it ends
+  if(mImpl->batchActive)
+  {
+    if(!mImpl->batchMessageBuffer)
+    {
+      mImpl->batchMessageBuffer = new MessageBuffer(INITIAL_BUFFER_SIZE);
+    }
+    return mImpl->batchMessageBuffer->ReserveMessageSlot(requestedSize);
+  }
+
   if(!mImpl->currentMessageBuffer)
   {
     // Pull any buffers ProcessMessages() has finished with out of recycleQueue (mutex-
@@ -295,6 +349,58 @@ uint32_t* MessageQueue::ReserveMessageSlot(uint32_t requestedSize, bool updateSc
   return mImpl->currentMessageBuffer->ReserveMessageSlot(requestedSize);
 }
 
+// Called from event thread
+uint32_t* MessageQueue::ReservePropertyMessageSlot(uint32_t requestedSize, const void* property, const void* messageTypeId)
+{
+  uint32_t* slot = ReservePropertyIndependentMessageSlot(requestedSize, true);
+
+  if(messageTypeId)
+  {
+    mImpl->lastPropertyMessages[property] = {mImpl->GetActiveBuffer()->GetSlotOffset(slot), messageTypeId, mImpl->messageEpoch};
+  }
+  else
+  {
+    mImpl->lastPropertyMessages.erase(property);
+  }
+
+  return slot;
+}
+
+// Called from event thread
+uint32_t* MessageQueue::FindLastPropertyMessage(const void* property, const void* messageTypeId) const
+{
+  auto iter = mImpl->lastPropertyMessages.find(property);
+  if(iter == mImpl->lastPropertyMessages.end() || iter->second.messageTypeId != messageTypeId || iter->second.epoch != mImpl->messageEpoch)
+  {
+    return nullptr;
+  }
+
+  return mImpl->GetActiveBuffer()->GetSlot(iter->second.offset);
+}
+
+// Called from event thread
+void MessageQueue::BeginBatch()
+{
+  DALI_ASSERT_DEBUG(!mImpl->batchActive && "Batches can not be nested");
+
+  // The messages reserved before are processed before the batch, so later values can not be merged into them
+  mImpl->lastPropertyMessages.clear();
+  mImpl->batchActive = true;
+}
+
+// Called from event thread
+MessageBuffer* MessageQueue::EndBatch()
+{
+  DALI_ASSERT_DEBUG(mImpl->batchActive && "BeginBatch() was not called");
+
+  mImpl->lastPropertyMessages.clear();
+  mImpl->batchActive = false;
+
+  MessageBuffer* batchBuffer = mImpl->batchMessageBuffer;
+  mImpl->batchMessageBuffer  = nullptr;
+  return batchBuffer;
+}
+
 // Called from event thread
 bool MessageQueue::FlushQueue()
 {
@@ -313,6 +419,12 @@ bool MessageQueue::FlushQueue()
   MessageBuffer* sourceBuffer = mImpl->currentMessageBuffer;
   mImpl->currentMessageBuffer = nullptr; // take ownership
 
+  // The messages now belong to the update thread, they can not be modified anymore
+  if(!mImpl->batchActive)
+  {
+    mImpl->lastPropertyMessages.clear();
+  }
+
   // If the overflow queue still has content from an earlier flush that
   // ProcessMessages() hasn't drained yet, this (newer) batch must NOT take the
   // fast path even though the ring may currently have room - ProcessMessages()
@@ -32,6 +32,7 @@ class RenderController;
 namespace Internal
 {
 class MessageBase;
+class MessageBuffer;
 
 namespace Update
 {
@@ -79,6 +80,48 @@ public:
    */
   [[nodiscard]] uint32_t* ReserveMessageSlot(uint32_t size, bool updateScene);
 
+  /**
+   * Reserve space for a message which does not read nor modify any property, e.g. a rendering request.
+   * Unlike ReserveMessageSlot(), later values may still be merged into the property messages reserved before it.
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] updateScene If set to true, denotes that the message will cause the scene graph node tree to require an update
+   * @return A pointer to the first char allocated for the message
+   */
+  [[nodiscard]] uint32_t* ReservePropertyIndependentMessageSlot(uint32_t size, bool updateScene);
+
+  /**
+   * Reserve space for a message which modifies a property.
+   * The message is the last one of the property until the queue is flushed, or another message is reserved for it.
+   * Later values are only merged into it while no message is reserved by ReserveMessageSlot().
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] property The property modified by the message
+   * @param[in] messageTypeId Identifies the type of the message, or nullptr if no later message may be merged into it
+   * @return A pointer to the first char allocated for the message
+   */
+  [[nodiscard]] uint32_t* ReservePropertyMessageSlot(uint32_t size, const void* property, const void* messageTypeId);
+
+  /**
+   * Retrieve the last message which modifies a property, so that a new value can be merged into it
+   * instead of queueing another message.
+   * @param[in] property The property
+   * @param[in] messageTypeId Identifies the type of the new message
+   * @return The last message of the property, or nullptr if there is none since the queue was flushed, if it has another type,
+   * or if another kind of message was reserved after it
+   */
+  uint32_t* FindLastPropertyMessage(const void* property, const void* messageTypeId) const;
+
+  /**
+   * Starts reserving the messages in a separate buffer, until EndBatch() is called.
+   * The batch is then sent with one message, after the messages reserved before BeginBatch().
+   */
+  void BeginBatch();
+
+  /**
+   * Stops reserving the messages in the batch buffer.
+   * @return The messages reserved since BeginBatch(), owned by the caller; nullptr if there is none
+   */
+  MessageBuffer* EndBatch();
+
   /**
    * Flushes the message queue
    * @return true if there are messages to process
@@ -849,6 +849,26 @@ Vector4 Renderer::GetVisualTransformedUpdateArea(const Vector4& originalUpdateAr
   return AdjustExtents(updateArea, mUpdateAreaExtents);
 }
 
+bool Renderer::GetOccludingArea(uint32_t renderPass, const Vector3& nodeSize, Vector4& occludingArea) noexcept
+{
+  if(!mVisualProperties || mDecoratedVisualCornerRadiusProperties || mDecoratedVisualBorderlineProperties || HasRenderCallback())
+  {
+    return false;
+  }
+
+  const auto& shaderData = mShader->GetShaderData(renderPass);
+  if(!shaderData || shaderData->HintEnabled(Dali::Shader::Hint::MODIFIES_GEOMETRY))
+  {
+    return false;
+  }
+
+  // Unlike the update area, the extents are not applied : they may not be drawn.
+  occludingArea = Vector4(0.0f, 0.0f, nodeSize.width, nodeSize.height);
+  mVisualProperties->GetVisualTransformedUpdateArea(occludingArea);
+
+  return occludingArea.z > 0.0f && occludingArea.w > 0.0f;
+}
+
 bool Renderer::IsObservingNodeDeactivated() const
 {
   // TODO : Could we use this feature for general renderer?
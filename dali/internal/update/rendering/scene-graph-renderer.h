@@ -468,6 +468,17 @@ public:
    */
   Vector4 GetVisualTransformedUpdateArea(const Vector4& originalUpdateArea) noexcept override;
 
+  /**
+   * @brief Retrieves the area of the node which the renderer covers, if it draws a plain quad.
+   * Only visual renderers without decoration (corner radius, borderline or blur) draw such a quad.
+   * The caller has to check that the renderer is opaque.
+   * @param[in] renderPass The render pass
+   * @param[in] nodeSize The size of the node
+   * @param[out] occludingArea The covered area in node space (center x, center y, width, height)
+   * @return True if the renderer covers its whole visual area
+   */
+  bool GetOccludingArea(uint32_t renderPass, const Vector3& nodeSize, Vector4& occludingArea) noexcept;
+
   uint32_t GetInstanceCount() const override
   {
     return mInstanceCount;
@@ -23,6 +23,10 @@
 #include <cstdint> // uint32_t
 #include <cstring> // memcpy
 
+#if defined(__SSE2__)
+#include <emmintrin.h> // SSE2 intrinsics, always available on x86-64
+#endif
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/matrix-utils.h>
 #include <dali/internal/render/common/performance-monitor.h>
@@ -274,7 +278,16 @@ Vector4 Matrix::operator*(const Vector4& rhs) const
 
   Vector4 temp;
 
-#if !defined(__ARM_NEON__) || defined(__APPLE__)
+#if defined(__SSE2__)
+
+  // Same order of operations as the scalar code below
+  __m128 result = _mm_mul_ps(_mm_loadu_ps(&mMatrix[0]), _mm_set1_ps(rhs.x));
+  result        = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&mMatrix[4]), _mm_set1_ps(rhs.y)));
+  result        = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&mMatrix[8]), _mm_set1_ps(rhs.z)));
+  result        = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(&mMatrix[12]), _mm_set1_ps(rhs.w)));
+  _mm_storeu_ps(temp.AsFloat(), result);
+
+#elif !defined(__ARM_NEON__) || defined(__APPLE__)
 
   temp.x = rhs.x * mMatrix[0] + rhs.y * mMatrix[4] + rhs.z * mMatrix[8] + rhs.w * mMatrix[12];
   temp.y = rhs.x * mMatrix[1] + rhs.y * mMatrix[5] + rhs.z * mMatrix[9] + rhs.w * mMatrix[13];
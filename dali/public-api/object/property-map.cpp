@@ -22,6 +22,7 @@
 #include <dali/integration-api/debug.h>
 #include <algorithm> // for std::find_if
 #include <limits>
+#include <memory>
 #include <unordered_map>
 
 // INTERNAL INCLUDES
@@ -47,11 +48,34 @@ using IndexValueContainer = std::vector<IndexValuePair>;
 constexpr std::size_t NOT_HASHED    = 0u;
 constexpr std::size_t ALWAYS_REHASH = std::numeric_limits<std::size_t>::max();
 
+constexpr std::size_t LOOKUP_INDEX_MINIMUM_COUNT = 16u; ///< Below this, a linear search is faster than hashing the key
+
 }; // unnamed namespace
 
 struct Property::Map::Impl
 {
 public:
+  /**
+   * Secondary index of the keys of a container, which keeps the position of the first element with each key.
+   * The elements appended after the index was built are indexed on the next lookup.
+   */
+  template<typename KeyType>
+  struct LookupIndex
+  {
+    void Reset()
+    {
+      positions.clear();
+      data             = nullptr;
+      indexedCount     = 0u;
+      hasDuplicateKeys = false;
+    }
+
+    std::unordered_map<KeyType, uint32_t> positions;
+    const void*                           data{nullptr}; ///< The storage of the container when it was indexed, as string keys are views of it
+    uint32_t                              indexedCount{0u};
+    bool                                  hasDuplicateKeys{false};
+  };
+
   std::size_t GetHash() const
   {
     std::size_t hash = mHash;
@@ -82,13 +106,104 @@ public:
     return hash;
   }
 
+  /**
+   * Drops the indices of the keys, after the containers were modified other than by appending.
+   */
+  void ResetLookupIndices()
+  {
+    if(mStringLookupIndex)
+    {
+      mStringLookupIndex->Reset();
+    }
+    if(mIndexLookupIndex)
+    {
+      mIndexLookupIndex->Reset();
+    }
+  }
+
 public:
   StringValueContainer mStringValueContainer;
   IndexValueContainer  mIndexValueContainer;
 
+  std::unique_ptr<LookupIndex<Dali::StringView>> mStringLookupIndex; ///< Created once the map has many string keys
+  std::unique_ptr<LookupIndex<Property::Index>>  mIndexLookupIndex;  ///< Created once the map has many index keys
+
   mutable std::size_t mHash{NOT_HASHED};
 };
 
+namespace
+{
+/**
+ * Brings the index of the container up to date, creating it once the container is large enough.
+ * @return True if the index can be used for the lookup
+ */
+template<typename KeyType, typename ContainerType>
+bool UpdateLookupIndex(std::unique_ptr<Property::Map::Impl::LookupIndex<KeyType>>& lookup, const ContainerType& container)
+{
+  if(container.size() < LOOKUP_INDEX_MINIMUM_COUNT)
+  {
+    return false;
+  }
+
+  if(!lookup)
+  {
+    lookup = std::make_unique<Property::Map::Impl::LookupIndex<KeyType>>();
+  }
+  if(lookup->data != container.data())
+  {
+    lookup->Reset();
+    lookup->data = container.data();
+  }
+  for(; lookup->indexedCount < container.size(); ++lookup->indexedCount)
+  {
+    if(!lookup->positions.emplace(KeyType(container[lookup->indexedCount].first), lookup->indexedCount).second)
+    {
+      lookup->hasDuplicateKeys = true;
+    }
+  }
+  return true;
+}
+
+/**
+ * Finds the first element of the container with the given key which satisfies the predicate.
+ */
+template<typename KeyType, typename ContainerType, typename Predicate>
+typename ContainerType::value_type* FindElement(std::unique_ptr<Property::Map::Impl::LookupIndex<KeyType>>& lookup, ContainerType& container, KeyType key, Predicate predicate)
+{
+  if(UpdateLookupIndex(lookup, container))
+  {
+    auto iter = lookup->positions.find(key);
+    if(iter == lookup->positions.end())
+    {
+      return nullptr;
+    }
+
+    auto& element = container[iter->second];
+    if(predicate(element))
+    {
+      return &element;
+    }
+    if(!lookup->hasDuplicateKeys)
+    {
+      return nullptr;
+    }
+    // Another element with the same key may satisfy the predicate
+  }
+
+  for(auto&& element : container)
+  {
+    if(element.first == key && predicate(element))
+    {
+      return &element;
+    }
+  }
+  return nullptr;
+}
+
+constexpr auto ANY_ELEMENT = [](const auto&) { return true; };
+
+} // unnamed namespace
+
 Property::Map::Map()
 : mImpl(new Impl)
 {
@@ -231,18 +346,16 @@ Property::Value* Property::Map::Find(Dali::StringView key) const
 {
   if(DALI_LIKELY(mImpl))
   {
-    for(auto&& iter : mImpl->mStringValueContainer)
+    auto element = FindElement(mImpl->mStringLookupIndex, mImpl->mStringValueContainer, key, ANY_ELEMENT);
+    if(element)
     {
-      if(key == iter.first)
+      if(mImpl->mHash != ALWAYS_REHASH)
       {
-        if(mImpl->mHash != ALWAYS_REHASH)
-        {
-          // Mark as we cannot assume that hash is valid anymore.
-          // Recalculate hash always after now.
-          mImpl->mHash = ALWAYS_REHASH;
-        }
-        return &iter.second;
+        // Mark as we cannot assume that hash is valid anymore.
+        // Recalculate hash always after now.
+        mImpl->mHash = ALWAYS_REHASH;
       }
+      return &element->second;
     }
   }
   return nullptr; // Not found
@@ -252,18 +365,16 @@ Property::Value* Property::Map::Find(Property::Index key) const
 {
   if(DALI_LIKELY(mImpl))
   {
-    for(auto&& iter : mImpl->mIndexValueContainer)
+    auto element = FindElement(mImpl->mIndexLookupIndex, mImpl->mIndexValueContainer, key, ANY_ELEMENT);
+    if(element)
     {
-      if(iter.first == key)
+      if(mImpl->mHash != ALWAYS_REHASH)
       {
-        if(mImpl->mHash != ALWAYS_REHASH)
-        {
-          // Mark as we cannot assume that hash is valid anymore.
-          // Recalculate hash always after now.
-          mImpl->mHash = ALWAYS_REHASH;
-        }
-        return &iter.second;
+        // Mark as we cannot assume that hash is valid anymore.
+        // Recalculate hash always after now.
+        mImpl->mHash = ALWAYS_REHASH;
       }
+      return &element->second;
     }
   }
   return nullptr; // Not found
@@ -283,18 +394,17 @@ Property::Value* Property::Map::Find(Dali::StringView key, Property::Type type)
 {
   if(DALI_LIKELY(mImpl))
   {
-    for(auto&& iter : mImpl->mStringValueContainer)
+    auto element = FindElement(mImpl->mStringLookupIndex, mImpl->mStringValueContainer, key, [type](const auto& pair)
+    { return pair.second.GetType() == type; });
+    if(element)
     {
-      if((iter.second.GetType() == type) && (key == iter.first))
+      if(mImpl->mHash != ALWAYS_REHASH)
       {
-        if(mImpl->mHash != ALWAYS_REHASH)
-        {
-          // Mark as we cannot assume that hash is valid anymore.
-          // Recalculate hash always after now.
-          mImpl->mHash = ALWAYS_REHASH;
-        }
-        return &iter.second;
+        // Mark as we cannot assume that hash is valid anymore.
+        // Recalculate hash always after now.
+        mImpl->mHash = ALWAYS_REHASH;
       }
+      return &element->second;
     }
   }
   return nullptr; // Not found
@@ -304,18 +414,17 @@ Property::Value* Property::Map::Find(Property::Index key, Property::Type type) c
 {
   if(DALI_LIKELY(mImpl))
   {
-    for(auto&& iter : mImpl->mIndexValueContainer)
+    auto element = FindElement(mImpl->mIndexLookupIndex, mImpl->mIndexValueContainer, key, [type](const auto& pair)
+    { return pair.second.GetType() == type; });
+    if(element)
     {
-      if((iter.second.GetType() == type) && (iter.first == key))
+      if(mImpl->mHash != ALWAYS_REHASH)
       {
-        if(mImpl->mHash != ALWAYS_REHASH)
-        {
-          // Mark as we cannot assume that hash is valid anymore.
-          // Recalculate hash always after now.
-          mImpl->mHash = ALWAYS_REHASH;
-        }
-        return &iter.second;
+        // Mark as we cannot assume that hash is valid anymore.
+        // Recalculate hash always after now.
+        mImpl->mHash = ALWAYS_REHASH;
       }
+      return &element->second;
     }
   }
   return nullptr; // Not found
@@ -327,6 +436,7 @@ void Property::Map::Clear()
   {
     mImpl->mStringValueContainer.clear();
     mImpl->mIndexValueContainer.clear();
+    mImpl->ResetLookupIndices();
     mImpl->mHash = NOT_HASHED;
   }
 }
@@ -347,6 +457,7 @@ bool Property::Map::Remove(Property::Index key)
         mImpl->mHash -= Dali::Internal::HashUtils::HashRawValue(key, valueHash);
       }
       mImpl->mIndexValueContainer.erase(iter);
+      mImpl->ResetLookupIndices();
       return true;
     }
   }
@@ -369,6 +480,7 @@ bool Property::Map::Remove(Dali::StringView key)
         mImpl->mHash -= Dali::Internal::HashUtils::HashStringView(ToStdStringView(key), valueHash);
       }
       mImpl->mStringValueContainer.erase(iter);
+      mImpl->ResetLookupIndices();
       return true;
     }
   }
@@ -415,12 +527,10 @@ const Property::Value& Property::Map::operator[](Dali::StringView key) const
 {
   DALI_ASSERT_ALWAYS(mImpl && "Cannot use an object previously used as an r-value");
 
-  for(auto&& iter : mImpl->mStringValueContainer)
+  auto element = FindElement(mImpl->mStringLookupIndex, mImpl->mStringValueContainer, key, ANY_ELEMENT);
+  if(element)
   {
-    if(iter.first == key)
-    {
-      return iter.second;
-    }
+    return element->second;
   }
 
   DALI_ABORT("Invalid Key");
@@ -440,12 +550,10 @@ Property::Value& Property::Map::operator[](Dali::StringView key)
     mImpl->mHash = ALWAYS_REHASH;
   }
 
-  for(auto&& iter : mImpl->mStringValueContainer)
+  auto element = FindElement(mImpl->mStringLookupIndex, mImpl->mStringValueContainer, key, ANY_ELEMENT);
+  if(element)
   {
-    if(iter.first == key)
-    {
-      return iter.second;
-    }
+    return element->second;
   }
 
   // Create and return reference to new value
@@ -457,12 +565,10 @@ const Property::Value& Property::Map::operator[](Property::Index key) const
 {
   DALI_ASSERT_ALWAYS(mImpl && "Cannot use an object previously used as an r-value");
 
-  for(auto&& iter : mImpl->mIndexValueContainer)
+  auto element = FindElement(mImpl->mIndexLookupIndex, mImpl->mIndexValueContainer, key, ANY_ELEMENT);
+  if(element)
   {
-    if(iter.first == key)
-    {
-      return iter.second;
-    }
+    return element->second;
   }
 
   DALI_ABORT("Invalid Key");
@@ -482,12 +588,10 @@ Property::Value& Property::Map::operator[](Property::Index key)
     mImpl->mHash = ALWAYS_REHASH;
   }
 
-  for(auto&& iter : mImpl->mIndexValueContainer)
+  auto element = FindElement(mImpl->mIndexLookupIndex, mImpl->mIndexValueContainer, key, ANY_ELEMENT);
+  if(element)
   {
-    if(iter.first == key)
-    {
-      return iter.second;
-    }
+    return element->second;
   }
 
   // Create and return reference to new value
@@ -512,6 +616,7 @@ Property::Map& Property::Map::operator=(const Property::Map& other)
       mImpl->mStringValueContainer = other.mImpl->mStringValueContainer;
       mImpl->mIndexValueContainer  = other.mImpl->mIndexValueContainer;
       mImpl->mHash                 = other.mImpl->mHash;
+      mImpl->ResetLookupIndices();
     }
   }
   return *this;
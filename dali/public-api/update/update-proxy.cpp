@@ -149,6 +149,81 @@ bool UpdateProxy::BakeCustomProperty(uint32_t id, const String& propertyName, co
   return mImpl.BakeCustomProperty(id, Dali::Internal::ConstString(propertyName), value);
 }
 
+UpdateProxy::ActorSet UpdateProxy::CreateActorSet(const uint32_t* ids, uint32_t count)
+{
+  return mImpl.CreateActorSet(ids, count);
+}
+
+void UpdateProxy::RemoveActorSet(ActorSet actorSet)
+{
+  mImpl.RemoveActorSet(actorSet);
+}
+
+uint32_t UpdateProxy::GetPositions(ActorSet actorSet, Vector3* positions) const
+{
+  return mImpl.GetPositions(actorSet, positions);
+}
+
+uint32_t UpdateProxy::SetPositions(ActorSet actorSet, const Vector3* positions)
+{
+  return mImpl.SetPositions(actorSet, positions);
+}
+
+uint32_t UpdateProxy::BakePositions(ActorSet actorSet, const Vector3* positions)
+{
+  return mImpl.BakePositions(actorSet, positions);
+}
+
+uint32_t UpdateProxy::GetSizes(ActorSet actorSet, Vector3* sizes) const
+{
+  return mImpl.GetSizes(actorSet, sizes);
+}
+
+uint32_t UpdateProxy::SetSizes(ActorSet actorSet, const Vector3* sizes)
+{
+  return mImpl.SetSizes(actorSet, sizes);
+}
+
+uint32_t UpdateProxy::BakeSizes(ActorSet actorSet, const Vector3* sizes)
+{
+  return mImpl.BakeSizes(actorSet, sizes);
+}
+
+uint32_t UpdateProxy::GetScales(ActorSet actorSet, Vector3* scales) const
+{
+  return mImpl.GetScales(actorSet, scales);
+}
+
+uint32_t UpdateProxy::SetScales(ActorSet actorSet, const Vector3* scales)
+{
+  return mImpl.SetScales(actorSet, scales);
+}
+
+uint32_t UpdateProxy::BakeScales(ActorSet actorSet, const Vector3* scales)
+{
+  return mImpl.BakeScales(actorSet, scales);
+}
+
+uint32_t UpdateProxy::GetColors(ActorSet actorSet, Vector4* colors) const
+{
+  return mImpl.GetColors(actorSet, colors);
+}
+
+uint32_t UpdateProxy::SetColors(ActorSet actorSet, const Vector4* colors)
+{
+  return mImpl.SetColors(actorSet, colors);
+}
+
+uint32_t UpdateProxy::BakeColors(ActorSet actorSet, const Vector4* colors)
+{
+  return mImpl.BakeColors(actorSet, colors);
+}
+
+uint32_t UpdateProxy::GetWorldMatrices(ActorSet actorSet, Matrix* worldMatrices) const
+{
+  return mImpl.GetWorldMatrices(actorSet, worldMatrices);
+}
+
 UpdateProxy::UpdateProxy(Internal::UpdateProxy& impl)
 : mImpl(impl)
 {
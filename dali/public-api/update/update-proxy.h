@@ -55,6 +55,13 @@ public:
   using NotifySyncPoint = int;
   static constexpr NotifySyncPoint INVALID_SYNC{-1};
 
+  /**
+   * Type to identify a set of actors created with CreateActorSet().
+   * @SINCE_2_5.37
+   */
+  using ActorSet = uint32_t;
+  static constexpr ActorSet INVALID_ACTOR_SET{0u};
+
   /**
    * @brief Given the Actor ID, this retrieves that Actor's local position.
    * @param[in]   id        The Actor ID
@@ -302,6 +309,151 @@ public:
    */
   bool BakeCustomProperty(uint32_t id, const String& propertyName, const Property::Value& value);
 
+  /**
+   * @brief Creates a set of actors whose data can then be accessed in bulk, e.g. with GetPositions().
+   *
+   * The Actors are looked up once rather than on every access, until the actor hierarchy changes.
+   * This is much cheaper than the methods taking a single Actor ID when many actors are updated every frame.
+   * The set can be kept and reused in the following frames, until it is removed or the frame callback is removed.
+   * @param[in]  ids    An array of Actor IDs
+   * @param[in]  count  The number of Actor IDs
+   * @return The set of actors
+   * @SINCE_2_5.37
+   */
+  ActorSet CreateActorSet(const uint32_t* ids, uint32_t count);
+
+  /**
+   * @brief Removes a set of actors created with CreateActorSet().
+   * @param[in]  actorSet  The set of actors
+   * @SINCE_2_5.37
+   */
+  void RemoveActorSet(ActorSet actorSet);
+
+  /**
+   * @brief Retrieves the local position of every Actor of a set.
+   * @param[in]   actorSet  The set of actors
+   * @param[out]  positions  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found. The elements of the Actors which were not found are left unchanged.
+   * @SINCE_2_5.37
+   */
+  uint32_t GetPositions(ActorSet actorSet, Vector3* positions) const;
+
+  /**
+   * @brief Allows setting the local position of every Actor of a set from the Frame callback function for the current frame only.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  positions  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   * @SINCE_2_5.37
+   */
+  uint32_t SetPositions(ActorSet actorSet, const Vector3* positions);
+
+  /**
+   * @brief Allows baking the local position of every Actor of a set from the Frame callback function.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  positions  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note The value is saved so will cause undesired effects if this property is being animated.
+   * @SINCE_2_5.37
+   */
+  uint32_t BakePositions(ActorSet actorSet, const Vector3* positions);
+
+  /**
+   * @brief Retrieves the local size of every Actor of a set.
+   * @param[in]   actorSet  The set of actors
+   * @param[out]  sizes  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found. The elements of the Actors which were not found are left unchanged.
+   * @SINCE_2_5.37
+   */
+  uint32_t GetSizes(ActorSet actorSet, Vector3* sizes) const;
+
+  /**
+   * @brief Allows setting the local size of every Actor of a set from the Frame callback function for the current frame only.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  sizes  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   * @SINCE_2_5.37
+   */
+  uint32_t SetSizes(ActorSet actorSet, const Vector3* sizes);
+
+  /**
+   * @brief Allows baking the local size of every Actor of a set from the Frame callback function.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  sizes  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note The value is saved so will cause undesired effects if this property is being animated.
+   * @SINCE_2_5.37
+   */
+  uint32_t BakeSizes(ActorSet actorSet, const Vector3* sizes);
+
+  /**
+   * @brief Retrieves the local scale of every Actor of a set.
+   * @param[in]   actorSet  The set of actors
+   * @param[out]  scales  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found. The elements of the Actors which were not found are left unchanged.
+   * @SINCE_2_5.37
+   */
+  uint32_t GetScales(ActorSet actorSet, Vector3* scales) const;
+
+  /**
+   * @brief Allows setting the local scale of every Actor of a set from the Frame callback function for the current frame only.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  scales  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   * @SINCE_2_5.37
+   */
+  uint32_t SetScales(ActorSet actorSet, const Vector3* scales);
+
+  /**
+   * @brief Allows baking the local scale of every Actor of a set from the Frame callback function.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  scales  An array of one Vector3 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note The value is saved so will cause undesired effects if this property is being animated.
+   * @SINCE_2_5.37
+   */
+  uint32_t BakeScales(ActorSet actorSet, const Vector3* scales);
+
+  /**
+   * @brief Retrieves the local color of every Actor of a set.
+   * @param[in]   actorSet  The set of actors
+   * @param[out]  colors  An array of one Vector4 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found. The elements of the Actors which were not found are left unchanged.
+   * @SINCE_2_5.37
+   */
+  uint32_t GetColors(ActorSet actorSet, Vector4* colors) const;
+
+  /**
+   * @brief Allows setting the local color of every Actor of a set from the Frame callback function for the current frame only.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  colors  An array of one Vector4 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   * @SINCE_2_5.37
+   */
+  uint32_t SetColors(ActorSet actorSet, const Vector4* colors);
+
+  /**
+   * @brief Allows baking the local color of every Actor of a set from the Frame callback function.
+   * @param[in]  actorSet  The set of actors
+   * @param[in]  colors  An array of one Vector4 per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found.
+   * @note The value is saved so will cause undesired effects if this property is being animated.
+   * @SINCE_2_5.37
+   */
+  uint32_t BakeColors(ActorSet actorSet, const Vector4* colors);
+
+  /**
+   * @brief Retrieves the world transformation matrix of every Actor of a set.
+   * @param[in]   actorSet       The set of actors
+   * @param[out]  worldMatrices  An array of one Matrix per Actor of the set, in the order of the IDs given to CreateActorSet()
+   * @return The number of Actors of the set which were found. The elements of the Actors which were not found are left unchanged.
+   * @SINCE_2_5.37
+   */
+  uint32_t GetWorldMatrices(ActorSet actorSet, Matrix* worldMatrices) const;
+
 public: // Not intended for application developers
   /// @cond internal
 